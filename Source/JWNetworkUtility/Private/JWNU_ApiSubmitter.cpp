@@ -0,0 +1,82 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#include "JWNU_ApiSubmitter.h"
+#include "JWNetworkUtility.h"
+
+DEFINE_LOG_CATEGORY(LogJWNU_ApiSubmitter);
+
+// ──────── FJWNU_ApiSubmission ────────
+
+FJWNU_ApiSubmission::FJWNU_ApiSubmission(const TSharedRef<FJWNU_RequestSubmissionQueue, ESPMode::ThreadSafe>& InQueue, const ENamedThreads::Type InCompletionThread)
+	: Queue(InQueue)
+	, CompletionThread(InCompletionThread)
+{
+}
+
+void FJWNU_ApiSubmission::Cancel()
+{
+	if (IsCompleted() || bCancelled.exchange(true, std::memory_order_acq_rel))
+	{
+		return;
+	}
+
+	// 핸들은 게임 스레드에서만 만질 수 있으므로 Job 취소도 제출 큐로 넘긴다
+	if (const TSharedPtr<FJWNU_RequestSubmissionQueue, ESPMode::ThreadSafe> PinnedQueue = Queue.Pin())
+	{
+		PinnedQueue->Submit(
+			[Self = AsShared()]()
+			{
+				Self->Handle.Cancel();
+				Self->Handle.Reset();
+			},
+			[]() {});
+	}
+}
+
+bool FJWNU_ApiSubmission::TryBeginDelivery()
+{
+	if (IsCancelled())
+	{
+		return false;
+	}
+	return bCompleted.exchange(true, std::memory_order_acq_rel) == false;
+}
+
+void FJWNU_ApiSubmission::DispatchToCompletionThread(TUniqueFunction<void()>&& InDelivery) const
+{
+	if (CompletionThread == ENamedThreads::GameThread && IsInGameThread())
+	{
+		InDelivery();
+		return;
+	}
+	AsyncTask(CompletionThread, MoveTemp(InDelivery));
+}
+
+// ──────── FJWNU_ApiSubmitter ────────
+
+TSharedPtr<FJWNU_ApiSubmitter, ESPMode::ThreadSafe> FJWNU_ApiSubmitter::Create(const UObject* WorldContextObject)
+{
+	check(IsInGameThread());
+
+	UJWNU_GIS_ApiClientService* ApiClientService = UJWNU_GIS_ApiClientService::Get(WorldContextObject);
+	if (ApiClientService == nullptr)
+	{
+		PRINT_LOG(LogJWNU_ApiSubmitter, Warning, TEXT("Failed to get api client service!"));
+		return nullptr;
+	}
+
+	UJWNU_GIS_HttpRequestJobProcessor* Processor = ApiClientService->GetGameInstance()->GetSubsystem<UJWNU_GIS_HttpRequestJobProcessor>();
+	if (Processor == nullptr)
+	{
+		PRINT_LOG(LogJWNU_ApiSubmitter, Warning, TEXT("Failed to get http request job processor!"));
+		return nullptr;
+	}
+
+	return MakeShared<FJWNU_ApiSubmitter, ESPMode::ThreadSafe>(ApiClientService, Processor->GetSubmissionQueue());
+}
+
+FJWNU_ApiSubmitter::FJWNU_ApiSubmitter(UJWNU_GIS_ApiClientService* InService, const TSharedRef<FJWNU_RequestSubmissionQueue, ESPMode::ThreadSafe>& InQueue)
+	: Service(InService)
+	, Queue(InQueue)
+{
+}
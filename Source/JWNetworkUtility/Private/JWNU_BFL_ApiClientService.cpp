@@ -1,9 +1,119 @@
 ﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
 
 #include "JWNU_BFL_ApiClientService.h"
-#include "JsonObjectConverter.h"
+#include "JWNU_JsonStructReader.h"
+#include "JWNU_JsonStructWriter.h"
 #include "JWNU_GIS_ApiClientService.h"
 #include "JWNU_HttpRequestJobHandle.h"
+#include "JWNU_GIS_HttpRequestJobProcessor.h"
+#include "Engine/GameInstance.h"
+#include "Async/Async.h"
+
+namespace JWNU_BFL_ApiClientService_Private
+{
+	/**
+	 * 블루프린트 이벤트와 요청 핸들은 게임 스레드 전용이므로, 다른 스레드에서 불렸다면 게임 스레드로 넘겨 실행한다.
+	 */
+	void RunOnGameThread(TUniqueFunction<void()>&& InTask)
+	{
+		if (IsInGameThread())
+		{
+			InTask();
+			return;
+		}
+		AsyncTask(ENamedThreads::GameThread, MoveTemp(InTask));
+	}
+}
+
+namespace JWNU_ApiBatch_Private
+{
+	/**
+	 * 배치 하나의 진행 상태. 요청 콜백들이 공유하며, 마지막 콜백이 끝나면 함께 사라진다.
+	 */
+	struct FBatchState : TSharedFromThis<FBatchState, ESPMode::ThreadSafe>
+	{
+		TWeakObjectPtr<const UObject> WorldContext;
+		TArray<FJWNU_ApiBatchRequest> Requests;
+		TArray<FJWNU_ApiBatchResult> Results;
+		TBitArray<> CompletedFlags;
+		FOnApiBatchCompletedBPEvent OnCompleted;
+		FOnApiBatchItemCompletedBPEvent OnItemCompleted;
+		int32 MaxConcurrency = 0;
+		int32 NextIndex = 0;
+		int32 RunningCount = 0;
+		int32 CompletedCount = 0;
+		bool bDispatching = false;
+
+		/**
+		 * 동시 실행 한도 안에서 남은 요청을 보낸다. 보내기 전에 실패해 곧바로 끝난 요청이 있어도 같은 루프에서 이어서 보낸다.
+		 */
+		void Dispatch()
+		{
+			if (bDispatching)
+			{
+				return;
+			}
+
+			bDispatching = true;
+			while (NextIndex < Requests.Num() && (MaxConcurrency <= 0 || RunningCount < MaxConcurrency))
+			{
+				const int32 Index = NextIndex++;
+				++RunningCount;
+				Send(Index);
+			}
+			bDispatching = false;
+
+			if (CompletedCount == Requests.Num())
+			{
+				OnCompleted.ExecuteIfBound(Results);
+			}
+		}
+
+		void Send(const int32 InIndex)
+		{
+			const FJWNU_ApiBatchRequest& Request = Requests[InIndex];
+			const TSharedRef<FBatchState, ESPMode::ThreadSafe> Self = AsShared();
+
+			const FOnHttpResponseDelegate ResponseCallback = FOnHttpResponseDelegate::CreateLambda([Self, InIndex](const EJWNU_HttpStatusCode StatusCode, const FString& ResponseBody)
+			{
+				FJWNU_ApiBatchResult& Result = Self->Results[InIndex];
+				Result.bSucceeded = true;
+				Result.StatusCode = StatusCode;
+				Result.ResponseBody = ResponseBody;
+				Self->OnRequestCompleted(InIndex);
+			});
+
+			const FOnApiErrorDelegate ErrorCallback = FOnApiErrorDelegate::CreateLambda([Self, InIndex](const FJWNU_ApiError& InError)
+			{
+				// 단건 CallApi 결과와 같은 상태 코드, 바디를 함께 채워 블루프린트 파싱 로직을 그대로 쓸 수 있게 한다
+				FJWNU_ApiBatchResult& Result = Self->Results[InIndex];
+				Result.bSucceeded = false;
+				Result.StatusCode = InError.TransportReason == EJWNU_TransportReason::NotSent ? EJWNU_HttpStatusCode::None : JWNU_IntToHttpStatusCode(InError.StatusCode);
+				Result.ResponseBody = InError.ToResponseBody();
+				Result.Error = InError;
+				Self->OnRequestCompleted(InIndex);
+			});
+
+			const FJWNU_RequestHandle Handle = UJWNU_GIS_ApiClientService::CallApi_NoTemplate(WorldContext.Get(), Request.Method, Request.ServiceType, Request.Endpoint, Request.ContentBody, Request.QueryParams,
+				ResponseCallback, FOnHttpRequestJobRetryDelegate(), Request.bRequiresAuth, nullptr, ErrorCallback);
+
+			// 서비스를 찾지 못해 콜백 없이 끝난 경우
+			if (Handle.IsValid() == false && CompletedFlags[InIndex] == false)
+			{
+				ErrorCallback.Execute(FJWNU_ApiError(TEXT("SERVICE_NOT_FOUND"), TEXT("Failed to get api client service")));
+			}
+		}
+
+		void OnRequestCompleted(const int32 InIndex)
+		{
+			CompletedFlags[InIndex] = true;
+			--RunningCount;
+			++CompletedCount;
+			OnItemCompleted.ExecuteIfBound(InIndex, Results[InIndex], CompletedCount);
+			Dispatch();
+		}
+	};
+}
 
 UJWNU_HttpRequestJobHandle* UJWNU_BFL_ApiClientService::SendHttpRequest(
 	const UObject* WorldContextObject,
@@ -15,29 +125,46 @@ UJWNU_HttpRequestJobHandle* UJWNU_BFL_ApiClientService::SendHttpRequest(
 	const FOnHttpResponseBPEvent& InOnHttpResponse,
 	const FOnHttpRequestJobRetryBPEvent& InOnHttpRequestJobRetry)
 {
+	// 요청 핸들 테이블에서 슬롯 할당 (서비스 플로우를 거치지 않으므로 응답 콜백에서 직접 반납한다)
+	const UJWNU_GIS_HttpClientHelper* HttpClientHelper = UJWNU_GIS_HttpClientHelper::Get(WorldContextObject);
+	const UJWNU_GIS_HttpRequestJobProcessor* JobProcessor = HttpClientHelper != nullptr ? HttpClientHelper->GetGameInstance()->GetSubsystem<UJWNU_GIS_HttpRequestJobProcessor>() : nullptr;
+	if (JobProcessor == nullptr)
+	{
+		return nullptr;
+	}
+	const FJWNU_RequestHandle Handle = JobProcessor->GetRequestTable()->Allocate();
+
 	// 블루프린트 이벤트를 다시 델리게이트로 감싼다
-	const FOnHttpRequestCompletedDelegate ResponseCallback = FOnHttpRequestCompletedDelegate::CreateLambda([InOnHttpResponse](const int32 StatusCode, const FString& ResponseBody)
+	// (URL 호출은 게임 스레드에서 완료되지만, 핸들 반납과 이벤트는 어느 경로로 오든 게임 스레드에서 실행한다)
+	const FOnHttpRequestCompletedDelegate ResponseCallback = FOnHttpRequestCompletedDelegate::CreateLambda([InOnHttpResponse, Handle](const int32 StatusCode, const FString& ResponseBody)
 	{
-		InOnHttpResponse.ExecuteIfBound(JWNU_IntToHttpStatusCode(StatusCode), ResponseBody);
+		JWNU_BFL_ApiClientService_Private::RunOnGameThread([InOnHttpResponse, Handle, StatusCode, ResponseBody]()
+		{
+			Handle.Release();
+			InOnHttpResponse.ExecuteIfBound(JWNU_IntToHttpStatusCode(StatusCode), ResponseBody);
+		});
 	});
 
 	// 블루프린트 이벤트를 다시 델리게이트로 감싼다
 	const FOnHttpRequestJobRetryDelegate RetryCallback = FOnHttpRequestJobRetryDelegate::CreateLambda([InOnHttpRequestJobRetry](const int32 AttemptNumber)
 	{
-		InOnHttpRequestJobRetry.ExecuteIfBound(AttemptNumber);
+		JWNU_BFL_ApiClientService_Private::RunOnGameThread([InOnHttpRequestJobRetry, AttemptNumber]()
+		{
+			InOnHttpRequestJobRetry.ExecuteIfBound(AttemptNumber);
+		});
 	});
 
 	// HTTP 리퀘스트
 	UJWNU_HttpRequestJob* Job = UJWNU_GIS_HttpClientHelper::SendRequest_RawResponse(WorldContextObject, InMethod, InURL, InAuthToken, InContentBody, InQueryParams, ResponseCallback, RetryCallback);
 	if (Job == nullptr)
 	{
+		Handle.Release();
 		return nullptr;
 	}
 
-	// Handle 생성 및 바인딩
-	UJWNU_HttpRequestJobHandle* Handle = NewObject<UJWNU_HttpRequestJobHandle>(Job->GetOuter());
-	Handle->BindJob(Job);
-	return Handle;
+	// Job 바인딩 후 블루프린트 핸들로 감싼다
+	Handle.BindJob(Job);
+	return UJWNU_HttpRequestJobHandle::Wrap(Handle);
 }
 
 UJWNU_HttpRequestJobHandle* UJWNU_BFL_ApiClientService::CallApi(
@@ -63,8 +190,29 @@ UJWNU_HttpRequestJobHandle* UJWNU_BFL_ApiClientService::CallApi(
 		InOnHttpRequestJobRetry.ExecuteIfBound(AttemptNumber);
 	});
 
-	// HTTP 리퀘스트
-	return UJWNU_GIS_ApiClientService::CallApi_NoTemplate(WorldContextObject, InMethod, InServiceType, InEndpoint, InContentBody, InQueryParams, ResponseCallback, RetryCallback, bRequiresAuth);
+	// HTTP 리퀘스트 (네이티브 핸들을 블루프린트 핸들로 감싼다)
+	return UJWNU_HttpRequestJobHandle::Wrap(UJWNU_GIS_ApiClientService::CallApi_NoTemplate(WorldContextObject, InMethod, InServiceType, InEndpoint, InContentBody, InQueryParams, ResponseCallback, RetryCallback, bRequiresAuth));
+}
+
+void UJWNU_BFL_ApiClientService::CallApiBatch(
+	const UObject* WorldContextObject,
+	const TArray<FJWNU_ApiBatchRequest>& InRequests,
+	const int32 InMaxConcurrency,
+	const FOnApiBatchCompletedBPEvent& InOnCompleted,
+	const FOnApiBatchItemCompletedBPEvent& InOnItemCompleted)
+{
+	using namespace JWNU_ApiBatch_Private;
+
+	// 요청마다 블루프린트 이벤트를 감싸지 않고, 배치 상태 하나를 모든 콜백이 공유한다
+	const TSharedRef<FBatchState, ESPMode::ThreadSafe> Batch = MakeShared<FBatchState, ESPMode::ThreadSafe>();
+	Batch->WorldContext = WorldContextObject;
+	Batch->Requests = InRequests;
+	Batch->Results.SetNum(InRequests.Num());
+	Batch->CompletedFlags.Init(false, InRequests.Num());
+	Batch->OnCompleted = InOnCompleted;
+	Batch->OnItemCompleted = InOnItemCompleted;
+	Batch->MaxConcurrency = InMaxConcurrency;
+	Batch->Dispatch();
 }
 
 void UJWNU_BFL_ApiClientService::LoadRefreshTokenContainer(
@@ -166,7 +314,8 @@ bool UJWNU_BFL_ApiClientService::Generic_ConvertStructToJsonString(const FProper
 {
 	if (const FStructProperty* StructProp = CastField<FStructProperty>(StructProperty))
 	{
-		if (FJsonObjectConverter::UStructToJsonObjectString(StructProp->Struct, StructPtr, OutJsonString))
+		// 캐싱된 스키마로 직접 직렬화 (FJsonObjectConverter와 동일한 들여쓰기 출력)
+		if (FJWNU_JsonStructWriter::WriteString(StructProp->Struct, StructPtr, OutJsonString, true))
 		{
 			OutConvertResult = EJWNU_ConvertStructToJsonResult::Success;
 			return true;
@@ -181,27 +330,21 @@ bool UJWNU_BFL_ApiClientService::Generic_ConvertStructToJsonString(const FProper
 }
 bool UJWNU_BFL_ApiClientService::Generic_ConvertJsonStringToStruct(const FString& JsonString, EJWNU_ConvertJsonToStructResult& OutConvertResult, const FProperty* StructProperty, void* StructPtr)
 {
-	TSharedPtr<FJsonObject> JsonObject;
-	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
-	
-	if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid())
+	const FStructProperty* StructProp = CastField<FStructProperty>(StructProperty);
+	if (StructProp == nullptr)
 	{
-		if (const FStructProperty* StructProp = CastField<FStructProperty>(StructProperty))
-		{
-			if (FJsonObjectConverter::JsonObjectToUStruct(JsonObject.ToSharedRef(), StructProp->Struct, StructPtr))
-			{
-				OutConvertResult = EJWNU_ConvertJsonToStructResult::Success;
-				return true;
-			}
-			
-			OutConvertResult = EJWNU_ConvertJsonToStructResult::Fail;
-			return false;
-		}
-		
 		OutConvertResult = EJWNU_ConvertJsonToStructResult::NoMatch;
 		return false;
 	}
-	
-	OutConvertResult = EJWNU_ConvertJsonToStructResult::InvalidJSON;
+
+	// DOM을 거치지 않고 구조체 메모리에 직접 역직렬화
+	FJWNU_JsonReadError ReadError;
+	if (FJWNU_JsonStructReader::ReadString(JsonString, StructProp->Struct, StructPtr, &ReadError))
+	{
+		OutConvertResult = EJWNU_ConvertJsonToStructResult::Success;
+		return true;
+	}
+
+	OutConvertResult = ReadError.bSyntaxError ? EJWNU_ConvertJsonToStructResult::InvalidJSON : EJWNU_ConvertJsonToStructResult::Fail;
 	return false;
 }
@@ -0,0 +1,71 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#include "JWNU_Coroutine.h"
+#include "JWNetworkUtility.h"
+
+DEFINE_LOG_CATEGORY(LogJWNU_Coroutine);
+
+void FJWNU_TaskState::Cancel()
+{
+	if (bDone || IsCancelled())
+	{
+		return;
+	}
+
+	// 프레임 파괴 중 마지막 참조가 사라지지 않도록 유지
+	const TSharedRef<FJWNU_TaskState, ESPMode::ThreadSafe> KeepAlive = AsShared();
+	bCancelled.store(true, std::memory_order_release);
+	PRINT_LOG(LogJWNU_Coroutine, Verbose, TEXT("Coroutine cancelled. (Suspended: %s)"), bSuspended ? TEXT("true") : TEXT("false"));
+
+	// 취소 가능한 지점에서 대기 중이라면 즉시 파괴, 실행 중이라면 다음 대기 지점에서 파괴
+	if (bSuspended)
+	{
+		DestroyCancelledFrame();
+	}
+
+	// 이 작업을 기다리던 코루틴은 결과를 받을 수 없으므로 함께 취소
+	Continuation = nullptr;
+	if (const TSharedPtr<FJWNU_TaskState, ESPMode::ThreadSafe> Awaiting = AwaitingState.Pin())
+	{
+		AwaitingState.Reset();
+		Awaiting->Cancel();
+	}
+}
+
+void FJWNU_TaskState::SetContinuation(const std::coroutine_handle<> InContinuation, FJWNU_TaskState& InAwaitingState)
+{
+	check(Continuation == nullptr);
+	Continuation = InContinuation;
+	AwaitingState = InAwaitingState.AsShared();
+}
+
+void FJWNU_TaskState::ClearContinuation()
+{
+	Continuation = nullptr;
+	AwaitingState.Reset();
+}
+
+std::coroutine_handle<> FJWNU_TaskState::MarkDone()
+{
+	bDone = true;
+	bSuspended = false;
+	Frame = nullptr;
+	AwaitingState.Reset();
+
+	const std::coroutine_handle<> Next = Continuation;
+	Continuation = nullptr;
+	return Next;
+}
+
+void FJWNU_TaskState::DestroyCancelledFrame()
+{
+	const TSharedRef<FJWNU_TaskState, ESPMode::ThreadSafe> KeepAlive = AsShared();
+	bSuspended = false;
+	if (Frame)
+	{
+		// 지역 변수와 대기 객체의 소멸자가 진행 중인 요청과 하위 작업을 취소한다
+		const std::coroutine_handle<> ToDestroy = Frame;
+		Frame = nullptr;
+		ToDestroy.destroy();
+	}
+}
@@ -0,0 +1,62 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#include "JWNU_Endpoint.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+
+FJWNU_EndpointInfo::FJWNU_EndpointInfo(
+	const uint64 InId,
+	const TCHAR* InPathTemplate,
+	const EJWNU_HttpMethod InMethod,
+	const EJWNU_ServiceType InServiceType,
+	const bool bInRequiresAuth,
+	const FApplyPolicyFunc InApplyPolicy)
+	: Id(InId)
+	, PathTemplate(InPathTemplate)
+	, Method(InMethod)
+	, ServiceType(InServiceType)
+	, bRequiresAuth(bInRequiresAuth)
+	, ApplyPolicyFunc(InApplyPolicy)
+{
+	// 경로 템플릿을 {패러미터} 자리 기준으로 리터럴 조각으로 분해 (형식은 컴파일 타임에 검사됨)
+	FString Fragment;
+	for (const TCHAR* Cur = InPathTemplate; *Cur != 0; ++Cur)
+	{
+		if (*Cur == TEXT('{'))
+		{
+			LiteralFragments.Add(MoveTemp(Fragment));
+			Fragment.Reset();
+			while (*Cur != 0 && *Cur != TEXT('}'))
+			{
+				++Cur;
+			}
+			if (*Cur == 0)
+			{
+				break;
+			}
+			continue;
+		}
+		Fragment.AppendChar(*Cur);
+	}
+	LiteralFragments.Add(MoveTemp(Fragment));
+}
+
+void FJWNU_EndpointInfo::AppendPath(FStringBuilderBase& OutPath, const TConstArrayView<FStringView> InPathParams) const
+{
+	check(InPathParams.Num() == GetPathParamCount());
+
+	OutPath.Append(LiteralFragments[0]);
+	for (int32 Index = 0; Index < InPathParams.Num(); ++Index)
+	{
+		// 패러미터 값에 '/'나 '?'가 섞여도 경로가 깨지지 않도록 인코딩
+		OutPath.Append(FGenericPlatformHttp::UrlEncode(InPathParams[Index]));
+		OutPath.Append(LiteralFragments[Index + 1]);
+	}
+}
+
+void FJWNU_EndpointInfo::ApplyPolicy(FJWNU_RequestConfig& InOutConfig) const
+{
+	if (ApplyPolicyFunc)
+	{
+		ApplyPolicyFunc(InOutConfig);
+	}
+}
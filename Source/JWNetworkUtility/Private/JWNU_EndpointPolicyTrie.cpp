@@ -0,0 +1,74 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#include "JWNU_EndpointPolicyTrie.h"
+#include "Algo/BinarySearch.h"
+
+void FJWNU_EndpointPolicyTrie::Build(const TConstArrayView<FString> InPrefixes)
+{
+	Nodes.Reset();
+	EdgeChars.Reset();
+	EdgeTargets.Reset();
+
+	// 1. 맵 기반의 임시 트라이에 모든 접두사 삽입
+	TArray<TMap<TCHAR, int32>> BuildChildren;
+	BuildChildren.AddDefaulted();
+	Nodes.AddDefaulted();
+	for (int32 PrefixIndex = 0; PrefixIndex < InPrefixes.Num(); ++PrefixIndex)
+	{
+		int32 NodeIndex = 0;
+		for (const TCHAR Char : InPrefixes[PrefixIndex])
+		{
+			if (const int32* Found = BuildChildren[NodeIndex].Find(Char))
+			{
+				NodeIndex = *Found;
+				continue;
+			}
+			const int32 NewIndex = Nodes.AddDefaulted();
+			BuildChildren.AddDefaulted();
+			BuildChildren[NodeIndex].Add(Char, NewIndex);
+			NodeIndex = NewIndex;
+		}
+		Nodes[NodeIndex].Value = PrefixIndex;
+	}
+
+	// 2. 노드별 자식 간선을 정렬해 연속 배열로 압축
+	for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+	{
+		TMap<TCHAR, int32>& Children = BuildChildren[NodeIndex];
+		Children.KeySort(TLess<TCHAR>());
+		Nodes[NodeIndex].FirstEdge = EdgeChars.Num();
+		Nodes[NodeIndex].NumEdges = Children.Num();
+		for (const TPair<TCHAR, int32>& Child : Children)
+		{
+			EdgeChars.Add(Child.Key);
+			EdgeTargets.Add(Child.Value);
+		}
+	}
+}
+
+int32 FJWNU_EndpointPolicyTrie::FindLongestPrefix(const FStringView InPath) const
+{
+	if (Nodes.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	int32 Result = Nodes[0].Value;
+	int32 NodeIndex = 0;
+	for (const TCHAR Char : InPath)
+	{
+		const FNode& Node = Nodes[NodeIndex];
+		const TConstArrayView<TCHAR> Edges(EdgeChars.GetData() + Node.FirstEdge, Node.NumEdges);
+		const int32 EdgeIndex = Algo::BinarySearch(Edges, Char);
+		if (EdgeIndex == INDEX_NONE)
+		{
+			break;
+		}
+		NodeIndex = EdgeTargets[Node.FirstEdge + EdgeIndex];
+		if (Nodes[NodeIndex].Value != INDEX_NONE)
+		{
+			Result = Nodes[NodeIndex].Value;
+		}
+	}
+	return Result;
+}
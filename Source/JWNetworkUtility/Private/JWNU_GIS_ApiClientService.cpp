@@ -3,10 +3,63 @@
 #include "JWNU_GIS_ApiClientService.h"
 #include "JWNU_GIS_ApiHostProvider.h"
 #include "Engine/GameInstance.h"
-#include "JWNU_HttpRequestJobHandle.h"
+#include "JWNU_GIS_HttpRequestJobProcessor.h"
+#include "Tasks/Task.h"
+#include "UObject/StructOnScope.h"
+#include "UObject/UnrealType.h"
 
 DEFINE_LOG_CATEGORY(LogJWNU_GIS_ApiClientService);
 
+void UJWNU_GIS_ApiClientService::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// 세션 복구에 필요한 서브시스템을 먼저 초기화 (IdentityProvider는 이 시점에 키스토어 백그라운드 로드를 시작한다)
+	Collection.InitializeDependency<UJWNU_GIS_ApiHostProvider>();
+	UJWNU_GIS_HttpRequestJobProcessor* JobProcessor = Collection.InitializeDependency<UJWNU_GIS_HttpRequestJobProcessor>();
+	UJWNU_GIS_ApiIdentityProvider* IdentityProvider = Collection.InitializeDependency<UJWNU_GIS_ApiIdentityProvider>();
+
+	// 요청 핸들 슬롯은 프로세서가 소유한 테이블에서 빌린다
+	RequestTable = JobProcessor->GetRequestTable();
+
+	if (bRestoreSessionOnStartup == false || IdentityProvider == nullptr)
+	{
+		bSessionReady = true;
+		return;
+	}
+
+	// 키스토어 로드가 끝나는 즉시 세션 복구 시작
+	if (IdentityProvider->IsKeystoreLoaded())
+	{
+		RestoreSession();
+	}
+	else
+	{
+		IdentityProvider->GetOnKeystoreLoaded().AddUObject(this, &UJWNU_GIS_ApiClientService::RestoreSession);
+	}
+}
+
+void UJWNU_GIS_ApiClientService::Deinitialize()
+{
+	if (SessionRestoreTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(SessionRestoreTickerHandle);
+		SessionRestoreTickerHandle.Reset();
+	}
+
+	RequestTable.Reset();
+
+	if (const UGameInstance* GameInstance = GetGameInstance())
+	{
+		if (UJWNU_GIS_ApiIdentityProvider* IdentityProvider = GameInstance->GetSubsystem<UJWNU_GIS_ApiIdentityProvider>())
+		{
+			IdentityProvider->GetOnKeystoreLoaded().RemoveAll(this);
+		}
+	}
+
+	Super::Deinitialize();
+}
+
 UJWNU_GIS_ApiClientService* UJWNU_GIS_ApiClientService::Get(const UObject* WorldContextObject)
 {
 	// 월드 컨텍스트 오브젝트 이상
@@ -36,27 +89,27 @@ UJWNU_GIS_ApiClientService* UJWNU_GIS_ApiClientService::Get(const UObject* World
 	return GameInstance->GetSubsystem<UJWNU_GIS_ApiClientService>();
 }
 
-UJWNU_HttpRequestJobHandle* UJWNU_GIS_ApiClientService::CallApi_NoTemplate(
+FJWNU_RequestHandle UJWNU_GIS_ApiClientService::CallApi_NoTemplate(
 	const UObject* WorldContextObject,
 	const EJWNU_HttpMethod InMethod,
 	const EJWNU_ServiceType InServiceType,
-	const FString& InEndpoint,
-	const FString& InContentBody,
+	const FStringView InEndpoint,
+	FJWNU_RequestBody InContentBody,
 	const TMap<FString, FString>& InQueryParams,
 	const FOnHttpResponseDelegate& OnHttpResponse,
 	const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry,
-	const bool bRequiresAuth)
+	const bool bRequiresAuth,
+	const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext,
+	const FOnApiErrorDelegate& OnApiError,
+	const TOptional<FJWNU_RequestConfig>& InRequestConfig)
 {
 	// 객체 획득
 	UJWNU_GIS_ApiClientService* Self = Get(WorldContextObject);
 	if (Self == nullptr)
 	{
-		return nullptr;
+		return FJWNU_RequestHandle();
 	}
 
-	// Handle 생성
-	UJWNU_HttpRequestJobHandle* Handle = NewObject<UJWNU_HttpRequestJobHandle>(Self);
-
 	// 호스트 프로바이더에서 호스트 획득
 	FString ProvidedHost;
 	if (const auto HostProvider = UJWNU_GIS_ApiHostProvider::Get(WorldContextObject))
@@ -64,153 +117,569 @@ UJWNU_HttpRequestJobHandle* UJWNU_GIS_ApiClientService::CallApi_NoTemplate(
 		if (HostProvider->GetHost(InServiceType, ProvidedHost) == false)
 		{
 			PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Failed to get host!"));
-			const FString FakeResponseBody = TEXT("{\"success\": false, \"code\": \"HOST_NOT_FOUND\", \"message\": \"Failed to get host from provider\"}");
-			OnHttpResponse.ExecuteIfBound(EJWNU_HttpStatusCode::None, FakeResponseBody);
-			return nullptr;
+			DeliverNoTemplateError(OnHttpResponse, OnApiError, FJWNU_ApiError(TEXT("HOST_NOT_FOUND"), TEXT("Failed to get host from provider")));
+			return FJWNU_RequestHandle();
 		}
 	}
 
-	// API URL 구축
-	const FString ConstructedURL = ProvidedHost + InEndpoint;
+	// API 요청 기술자 구축 (호출당 한 번만 만들고, 재시도와 리프레시 후 재전송에서는 참조만 넘긴다)
+	ProvidedHost.Append(InEndpoint.GetData(), InEndpoint.Len());
+	const FJWNU_RequestDescriptorRef Request = UJWNU_GIS_HttpClientHelper::MakeRequestDescriptor(WorldContextObject, InMethod, InServiceType, MoveTemp(ProvidedHost), MoveTemp(InContentBody), InQueryParams, nullptr, InRequestConfig.GetPtrOrNull());
+
+	// 요청 슬롯 할당 (결과 콜백 직전에 반납된다)
+	const FJWNU_RequestHandle Handle = Self->AllocateRequestHandle();
+	if (Handle.IsValid() == false)
+	{
+		DeliverNoTemplateError(OnHttpResponse, OnApiError, FJWNU_ApiError(TEXT("SERVICE_SHUTTING_DOWN"), TEXT("Api client service is shutting down")));
+		return FJWNU_RequestHandle();
+	}
 
 	// 인증이 필요하지 않은 경우, 토큰 로직을 건너뛰고 바로 실행
 	if (bRequiresAuth == false)
 	{
-		Self->CallApi_NoTemplate_Execution(InMethod, InServiceType, ConstructedURL, TEXT(""), InContentBody, InQueryParams, OnHttpResponse, Handle, OnHttpRequestJobRetry, false);
+		Self->CallApi_NoTemplate_Execution(Request, nullptr, TEXT(""), OnHttpResponse, OnApiError, Handle, OnHttpRequestJobRetry, false);
 		return Handle;
 	}
 
-	// 토큰 프로바이더에서 엑세스 토큰 획득
-	FJWNU_AccessTokenContainer ProvidedAccessTokenContainer;
-	if (const auto TokenProvider = UJWNU_GIS_ApiIdentityProvider::Get(WorldContextObject))
+	// 인증 컨텍스트 결정 (지정하지 않았다면 토큰 프로바이더의 기본 컨텍스트)
+	TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe> IdentityContext = InIdentityContext;
+	if (IdentityContext.IsValid() == false)
 	{
-		if (TokenProvider->GetAccessTokenContainer(InServiceType, ProvidedAccessTokenContainer) == false)
+		if (const auto TokenProvider = UJWNU_GIS_ApiIdentityProvider::Get(WorldContextObject))
+		{
+			IdentityContext = TokenProvider->GetDefaultIdentityContext();
+		}
+		else
 		{
-			PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Failed to get access token!"));
-			const FString FakeResponseBody = TEXT("{\"success\": false, \"code\": \"TOKEN_NOT_FOUND\", \"message\": \"Failed to get access token from provider\"}");
-			OnHttpResponse.ExecuteIfBound(EJWNU_HttpStatusCode::None, FakeResponseBody);
-			return nullptr;
+			PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Failed to get token provider!"));
+			Handle.Release();
+			DeliverNoTemplateError(OnHttpResponse, OnApiError, FJWNU_ApiError(TEXT("PROVIDER_NOT_FOUND"), TEXT("Failed to get token provider")));
+			return FJWNU_RequestHandle();
 		}
 	}
-	else
+
+	// 인증 컨텍스트에서 엑세스 토큰 획득
+	FJWNU_AccessTokenContainer ProvidedAccessTokenContainer;
+	if (IdentityContext->GetAccessTokenContainer(InServiceType, ProvidedAccessTokenContainer) == false)
 	{
-		PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Failed to get token provider!"));
-		const FString FakeResponseBody = TEXT("{\"success\": false, \"code\": \"PROVIDER_NOT_FOUND\", \"message\": \"Failed to get token provider\"}");
-		OnHttpResponse.ExecuteIfBound(EJWNU_HttpStatusCode::None, FakeResponseBody);
-		return nullptr;
+		PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Failed to get access token!"));
+		Handle.Release();
+		DeliverNoTemplateError(OnHttpResponse, OnApiError, FJWNU_ApiError(TEXT("TOKEN_NOT_FOUND"), TEXT("Failed to get access token from provider")));
+		return FJWNU_RequestHandle();
 	}
 
 	// 토큰 만료 또는 리프레시 진행 중인 경우 잡 큐에 적재
 	const int64 CurrentUnixTime = FDateTime::UtcNow().ToUnixTimestamp();
 	const bool bTokenExpired = ProvidedAccessTokenContainer.ExpiresAt > 0 && CurrentUnixTime >= (ProvidedAccessTokenContainer.ExpiresAt - 30);
-	if (bTokenExpired || Self->RefreshInProgressFlags.FindOrAdd(InServiceType))
+	if (bTokenExpired || IdentityContext->RefreshInProgressFlags.FindOrAdd(InServiceType))
 	{
 		PRINT_LOG(LogJWNU_GIS_ApiClientService, Display, TEXT("Access token expired or refresh in progress, queuing job..."));
 		JWNU_SCREEN_DEBUG(-1, 5.0f, FColor::Yellow, TEXT("[JWNU] Access Token Expired — Queuing refresh for %s"), *UEnum::GetValueAsString(InServiceType));
-		Handle->MarkWaitingForRefresh();
 		FJWNU_PendingJob Job;
-		Job.RequestInfo.ServiceType = InServiceType;
-		Job.RequestInfo.Method = InMethod;
-		Job.RequestInfo.URL = ConstructedURL;
-		Job.RequestInfo.ContentBody = InContentBody;
-		Job.RequestInfo.QueryParams = InQueryParams;
-		Job.OnTokenReady = [Self, InMethod, InServiceType, ConstructedURL, InContentBody, InQueryParams, OnHttpResponse, OnHttpRequestJobRetry, Handle](const FString& NewAccessToken)
+		Job.Request = Request;
+		Job.Handle = Handle;
+		Job.OnTokenReady = [Self, Request, IdentityContext, OnHttpResponse, OnApiError, OnHttpRequestJobRetry, Handle](const FString& NewAccessToken)
 		{
-			if (Handle->IsCancelled()) { Handle->ClearWaitingForRefresh(); return; }
-			Handle->ClearWaitingForRefresh();
-			Self->CallApi_NoTemplate_Execution(InMethod, InServiceType, ConstructedURL, NewAccessToken, InContentBody, InQueryParams, OnHttpResponse, Handle, OnHttpRequestJobRetry, false);
+			if (Handle.IsRunning() == false) { return; }
+			Self->CallApi_NoTemplate_Execution(Request, IdentityContext, NewAccessToken, OnHttpResponse, OnApiError, Handle, OnHttpRequestJobRetry, false);
 		};
-		Job.OnTokenFailed = [OnHttpResponse, Handle](const FString& ErrorCode, const FString& ErrorMessage)
+		Job.OnTokenFailed = [OnHttpResponse, OnApiError, Handle](const FJWNU_ApiError& InError)
 		{
-			Handle->ClearWaitingForRefresh();
-			const FString FakeResponseBody = FString::Printf(TEXT("{\"success\": false, \"code\": \"%s\", \"message\": \"%s\"}"), *ErrorCode, *ErrorMessage);
-			OnHttpResponse.ExecuteIfBound(EJWNU_HttpStatusCode::None, FakeResponseBody);
+			if (Handle.IsRunning() == false) { return; }
+			Handle.Release();
+			DeliverNoTemplateError(OnHttpResponse, OnApiError, InError);
 		};
-		Self->RequestTokenRefresh(InServiceType, MoveTemp(Job));
+		Self->RequestTokenRefresh(IdentityContext.ToSharedRef(), InServiceType, MoveTemp(Job));
 		return Handle;
 	}
 
-	Self->CallApi_NoTemplate_Execution(InMethod, InServiceType, ConstructedURL, ProvidedAccessTokenContainer.AccessToken, InContentBody, InQueryParams, OnHttpResponse, Handle, OnHttpRequestJobRetry, true);
+	Self->CallApi_NoTemplate_Execution(Request, IdentityContext, ProvidedAccessTokenContainer.AccessToken, OnHttpResponse, OnApiError, Handle, OnHttpRequestJobRetry, true);
 	return Handle;
 }
 
 void UJWNU_GIS_ApiClientService::CallApi_NoTemplate_Execution(
+	const FJWNU_RequestDescriptorRef& InRequest,
+	const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext,
+	const FString& InAccessToken,
+	const FOnHttpResponseDelegate& OnHttpResponse,
+	const FOnApiErrorDelegate& OnApiError,
+	const FJWNU_RequestHandle& InHandle,
+	const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry,
+	const bool bTryTokenRefreshing)
+{
+	// 성공 응답 콜백 (실패는 아래 에러 콜백으로 분리되어 바디를 읽지 않는다)
+	const auto Callback = FOnHttpRequestCompletedDelegate::CreateWeakLambda(this,
+		[OnHttpResponse, InHandle](const int32 StatusCode, const FString& ResponseBody)
+		{
+			InHandle.Release();
+			OnHttpResponse.ExecuteIfBound(JWNU_IntToHttpStatusCode(StatusCode), ResponseBody);
+		});
+
+	// 에러 콜백 (토큰 리프레시를 시도하는 경우에만 401을 처리)
+	const auto FailureCallback = FOnHttpRequestFailedDelegate::CreateWeakLambda(this,
+		[this, InRequest, InIdentityContext, OnHttpResponse, OnApiError, OnHttpRequestJobRetry, InHandle, bTryTokenRefreshing](const FJWNU_ApiError& InError)
+		{
+			if (bTryTokenRefreshing && InError.StatusCode == 401 && InIdentityContext.IsValid())
+			{
+				PRINT_LOG(LogJWNU_GIS_ApiClientService, Display, TEXT("401 detected, queuing job and triggering token refresh..."));
+				JWNU_SCREEN_DEBUG(-1, 5.0f, FColor::Orange, TEXT("[JWNU] 401 Unauthorized — Triggering token refresh for %s"), *UEnum::GetValueAsString(InRequest->GetServiceType()));
+				FJWNU_PendingJob Job;
+				Job.Request = InRequest;
+				Job.Handle = InHandle;
+				Job.OnTokenReady = [this, InRequest, InIdentityContext, OnHttpResponse, OnApiError, OnHttpRequestJobRetry, InHandle](const FString& NewAccessToken)
+				{
+					if (InHandle.IsRunning() == false) { return; }
+					CallApi_NoTemplate_Execution(InRequest, InIdentityContext, NewAccessToken, OnHttpResponse, OnApiError, InHandle, OnHttpRequestJobRetry, false);
+				};
+				Job.OnTokenFailed = [OnHttpResponse, OnApiError, InHandle](const FJWNU_ApiError& InRefreshError)
+				{
+					if (InHandle.IsRunning() == false) { return; }
+					InHandle.Release();
+					DeliverNoTemplateError(OnHttpResponse, OnApiError, InRefreshError);
+				};
+				RequestTokenRefresh(InIdentityContext.ToSharedRef(), InRequest->GetServiceType(), MoveTemp(Job));
+				return;
+			}
+
+			InHandle.Release();
+			DeliverNoTemplateError(OnHttpResponse, OnApiError, InError);
+		});
+
+	// Http 리퀘스트
+	UJWNU_HttpRequestJob* Job = UJWNU_GIS_HttpClientHelper::SendRequest_CustomResponse(GetWorld(), InRequest, InAccessToken, Callback, OnHttpRequestJobRetry, FailureCallback);
+	if (Job == nullptr)
+	{
+		// 프로세서를 찾지 못해 콜백 없이 끝난 경우
+		InHandle.Release();
+		return;
+	}
+	InHandle.BindJob(Job);
+}
+
+FJWNU_RequestHandle UJWNU_GIS_ApiClientService::AllocateRequestHandle() const
+{
+	// 종료 중이라면 빈 핸들 (호출자는 요청을 보내지 않고 에러로 끝낸다)
+	if (RequestTable.IsValid() == false)
+	{
+		PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Request table is released, service is shutting down."));
+		return FJWNU_RequestHandle();
+	}
+	return RequestTable->Allocate();
+}
+
+void UJWNU_GIS_ApiClientService::DeliverNoTemplateError(const FOnHttpResponseDelegate& OnHttpResponse, const FOnApiErrorDelegate& OnApiError, const FJWNU_ApiError& InError)
+{
+	if (OnApiError.IsBound())
+	{
+		OnApiError.Execute(InError);
+		return;
+	}
+
+	// 에러 델리게이트가 없는 호출자(블루프린트, BFL)에게만 호환용 JSON 바디를 만들어 전달
+	const EJWNU_HttpStatusCode StatusCode = InError.TransportReason == EJWNU_TransportReason::NotSent ? EJWNU_HttpStatusCode::None : JWNU_IntToHttpStatusCode(InError.StatusCode);
+	OnHttpResponse.ExecuteIfBound(StatusCode, InError.ToResponseBody());
+}
+
+FJWNU_RequestHandle UJWNU_GIS_ApiClientService::CallApi_Typed(
+	const UObject* WorldContextObject,
 	const EJWNU_HttpMethod InMethod,
 	const EJWNU_ServiceType InServiceType,
-	const FString& InURL, const FString& InAccessToken,
-	const FString& InContentBody,
+	const FStringView InEndpoint,
+	FJWNU_RequestBody InContentBody,
 	const TMap<FString, FString>& InQueryParams,
-	const FOnHttpResponseDelegate& OnHttpResponse,
-	UJWNU_HttpRequestJobHandle* InHandle,
+	const FJWNU_ResponseThunkRef& InThunk,
+	const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry,
+	const bool bRequiresAuth,
+	const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext,
+	const FJWNU_EndpointInfo* InEndpointInfo,
+	const FJWNU_RequestConfig* InConfigOverride)
+{
+	// 객체 획득
+	UJWNU_GIS_ApiClientService* Self = Get(WorldContextObject);
+	if (Self == nullptr)
+	{
+		return FJWNU_RequestHandle();
+	}
+
+	// 호스트 프로바이더에서 호스트 획득
+	FString ProvidedHost;
+	if (const auto HostProvider = UJWNU_GIS_ApiHostProvider::Get(WorldContextObject))
+	{
+		if (HostProvider->GetHost(InServiceType, ProvidedHost) == false)
+		{
+			PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Failed to get host!"));
+			DeliverTypedError(*InThunk, FJWNU_ApiError(TEXT("HOST_NOT_FOUND"), TEXT("Failed to get host from provider")));
+			return FJWNU_RequestHandle();
+		}
+	}
+
+	// API 요청 기술자 구축 (호출당 한 번만 만들고, 재시도와 리프레시 후 재전송에서는 참조만 넘긴다)
+	ProvidedHost.Append(InEndpoint.GetData(), InEndpoint.Len());
+	const FJWNU_RequestDescriptorRef Request = UJWNU_GIS_HttpClientHelper::MakeRequestDescriptor(WorldContextObject, InMethod, InServiceType, MoveTemp(ProvidedHost), MoveTemp(InContentBody), InQueryParams, InEndpointInfo, InConfigOverride);
+
+	// 요청 슬롯 할당 (결과 콜백 직전에 반납된다)
+	const FJWNU_RequestHandle Handle = Self->AllocateRequestHandle();
+	if (Handle.IsValid() == false)
+	{
+		DeliverTypedError(*InThunk, FJWNU_ApiError(TEXT("SERVICE_SHUTTING_DOWN"), TEXT("Api client service is shutting down")));
+		return FJWNU_RequestHandle();
+	}
+
+	// 인증이 필요하지 않은 경우, 토큰 로직을 건너뛰고 바로 실행
+	if (bRequiresAuth == false)
+	{
+		Self->CallApi_Typed_Execution(Request, nullptr, TEXT(""), InThunk, Handle, OnHttpRequestJobRetry, false);
+		return Handle;
+	}
+
+	// 인증 컨텍스트 결정 (지정하지 않았다면 토큰 프로바이더의 기본 컨텍스트)
+	TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe> IdentityContext = InIdentityContext;
+	if (IdentityContext.IsValid() == false)
+	{
+		if (const auto TokenProvider = UJWNU_GIS_ApiIdentityProvider::Get(WorldContextObject))
+		{
+			IdentityContext = TokenProvider->GetDefaultIdentityContext();
+		}
+		else
+		{
+			PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Failed to get token provider!"));
+			Handle.Release();
+			DeliverTypedError(*InThunk, FJWNU_ApiError(TEXT("PROVIDER_NOT_FOUND"), TEXT("Failed to get token provider")));
+			return FJWNU_RequestHandle();
+		}
+	}
+
+	// 인증 컨텍스트에서 엑세스 토큰 획득
+	FJWNU_AccessTokenContainer ProvidedAccessTokenContainer;
+	if (IdentityContext->GetAccessTokenContainer(InServiceType, ProvidedAccessTokenContainer) == false)
+	{
+		PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Failed to get access token!"));
+		Handle.Release();
+		DeliverTypedError(*InThunk, FJWNU_ApiError(TEXT("TOKEN_NOT_FOUND"), TEXT("Failed to get access token from provider")));
+		return FJWNU_RequestHandle();
+	}
+
+	// 토큰 만료 또는 리프레시 진행 중인 경우 잡 큐에 적재
+	const int64 CurrentUnixTime = FDateTime::UtcNow().ToUnixTimestamp();
+	const bool bTokenExpired = ProvidedAccessTokenContainer.ExpiresAt > 0 && CurrentUnixTime >= (ProvidedAccessTokenContainer.ExpiresAt - 30);
+	if (bTokenExpired || IdentityContext->RefreshInProgressFlags.FindOrAdd(InServiceType))
+	{
+		PRINT_LOG(LogJWNU_GIS_ApiClientService, Display, TEXT("Access token expired or refresh in progress, queuing job..."));
+		JWNU_SCREEN_DEBUG(-1, 5.0f, FColor::Yellow, TEXT("[JWNU] Access Token Expired — Queuing refresh for %s"), *UEnum::GetValueAsString(InServiceType));
+		FJWNU_PendingJob Job;
+		Job.Request = Request;
+		Job.Handle = Handle;
+		Job.OnTokenReady = [Self, Request, IdentityContext, InThunk, OnHttpRequestJobRetry, Handle](const FString& NewAccessToken)
+		{
+			if (Handle.IsRunning() == false) { return; }
+			Self->CallApi_Typed_Execution(Request, IdentityContext, NewAccessToken, InThunk, Handle, OnHttpRequestJobRetry, false);
+		};
+		Job.OnTokenFailed = [InThunk, Handle](const FJWNU_ApiError& InError)
+		{
+			if (Handle.IsRunning() == false) { return; }
+			Handle.Release();
+			DeliverTypedError(*InThunk, InError);
+		};
+		Self->RequestTokenRefresh(IdentityContext.ToSharedRef(), InServiceType, MoveTemp(Job));
+		return Handle;
+	}
+
+	// 실제 처리
+	Self->CallApi_Typed_Execution(Request, IdentityContext, ProvidedAccessTokenContainer.AccessToken, InThunk, Handle, OnHttpRequestJobRetry, true);
+	return Handle;
+}
+
+FJWNU_RequestHandle UJWNU_GIS_ApiClientService::CallEndpoint_Typed(
+	const UObject* WorldContextObject,
+	const FJWNU_EndpointInfo& InEndpointInfo,
+	const TConstArrayView<FStringView> InPathParams,
+	FJWNU_RequestBody InContentBody,
+	const TMap<FString, FString>& InQueryParams,
+	const FJWNU_ResponseThunkRef& InThunk,
+	const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry,
+	const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext,
+	const FJWNU_RequestConfig* InConfigOverride)
+{
+	// 미리 분해해 둔 경로 조각 사이에 패러미터만 끼워 넣어 경로 조합
+	TStringBuilder<256> Path;
+	InEndpointInfo.AppendPath(Path, InPathParams);
+	return CallApi_Typed(WorldContextObject, InEndpointInfo.GetMethod(), InEndpointInfo.GetServiceType(), Path.ToView(), MoveTemp(InContentBody), InQueryParams, InThunk, OnHttpRequestJobRetry, InEndpointInfo.RequiresAuth(), InIdentityContext, &InEndpointInfo, InConfigOverride);
+}
+
+void UJWNU_GIS_ApiClientService::CallApi_Typed_Execution(
+	const FJWNU_RequestDescriptorRef& InRequest,
+	const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext,
+	const FString& InAccessToken,
+	const FJWNU_ResponseThunkRef& InThunk,
+	const FJWNU_RequestHandle& InHandle,
 	const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry,
 	const bool bTryTokenRefreshing)
 {
-	if (bTryTokenRefreshing)
-	{
-		// 원래 요청 정보 저장 (401 발생 시 재시도용)
-		FJWNU_PendingApiRequest PendingRequest;
-		PendingRequest.ServiceType = InServiceType;
-		PendingRequest.Method = InMethod;
-		PendingRequest.URL = InURL;
-		PendingRequest.ContentBody = InContentBody;
-		PendingRequest.QueryParams = InQueryParams;
-
-		// 401 상태 코드를 처리할 수 있는 콜백
-		const auto CallbackManage401 = FOnHttpRequestCompletedDelegate::CreateWeakLambda(this,
-			[this, PendingRequest, OnHttpResponse, OnHttpRequestJobRetry, InHandle](const int32 StatusCode, const FString& ResponseBody)
+	// 스트리밍 배열 호출이라면 바디를 모으지 않는 전송 경로로
+	if (InThunk->MakeStreamSink)
+	{
+		CallApi_Stream_Execution(InRequest, InIdentityContext, InAccessToken, InThunk, InHandle, OnHttpRequestJobRetry, bTryTokenRefreshing);
+		return;
+	}
+
+	// 성공 응답 콜백 (UTF-8 바이트를 언리얼 구조체로 바로 파싱 후 전달)
+	const auto Callback = FOnHttpRequestCompletedUtf8Delegate::CreateWeakLambda(this,
+		[this, InThunk, InHandle](const int32 StatusCode, TArray<uint8>&& ResponseBytes)
+		{
+			ParseAndDeliverTypedResponse(MoveTemp(ResponseBytes), InThunk, InHandle);
+		});
+
+	// 에러 콜백 (JSON 왕복 없이 코드와 메시지를 구조체에 바로 채운다, 토큰 리프레시를 시도하는 경우에만 401을 처리)
+	const FOnHttpRequestFailedDelegate FailureCallback = MakeTypedFailureCallback(InRequest, InIdentityContext, InThunk, InHandle, OnHttpRequestJobRetry, bTryTokenRefreshing);
+
+	// Http 리퀘스트
+	UJWNU_HttpRequestJob* Job = UJWNU_GIS_HttpClientHelper::SendRequest_Utf8Response(GetWorld(), InRequest, InAccessToken, Callback, OnHttpRequestJobRetry, FailureCallback);
+	if (Job == nullptr)
+	{
+		// 프로세서를 찾지 못해 콜백 없이 끝난 경우
+		InHandle.Release();
+		return;
+	}
+	InHandle.BindJob(Job);
+}
+
+void UJWNU_GIS_ApiClientService::CallApi_Stream_Execution(
+	const FJWNU_RequestDescriptorRef& InRequest,
+	const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext,
+	const FString& InAccessToken,
+	const FJWNU_ResponseThunkRef& InThunk,
+	const FJWNU_RequestHandle& InHandle,
+	const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry,
+	const bool bTryTokenRefreshing)
+{
+	// 시도마다 원소 수신기와 토크나이저를 새로 만든다 (리프레시 후 재전송은 배열을 처음부터 다시 받는다)
+	const FJWNU_StreamElementSinkRef Sink = InThunk->MakeStreamSink(TWeakObjectPtr<const UObject>(this), InHandle);
+	const TSharedRef<FJWNU_JsonArrayStreamReader, ESPMode::ThreadSafe> Reader = MakeShared<FJWNU_JsonArrayStreamReader, ESPMode::ThreadSafe>(InThunk->StreamArrayFieldName,
+		[Sink](const UTF8CHAR* InData, const int32 InNum)
+		{
+			return Sink->AddElement(InData, InNum);
+		});
+
+	// 바디 스트림 콜백 (HTTP 스레드)
+	const FOnHttpResponseStreamDelegate StreamCallback = FOnHttpResponseStreamDelegate::CreateLambda([Reader](const uint8* InData, const int64 InNum)
+	{
+		return Reader->Feed(InData, InNum);
+	});
+
+	// 완료 콜백 (게임 스레드, 2XX 전용). 공통 응답 필드는 스트림에서 모은 봉투에서 얻는다
+	const auto Callback = FOnHttpRequestCompletedDelegate::CreateWeakLambda(this,
+		[this, Reader, Sink, InThunk, InHandle](const int32 StatusCode, const FString& ResponseBody)
+		{
+			FJWNU_RES_Base Result;
+			ParseStreamEnvelope(*Reader, Result);
+			FinishStream(Sink, InHandle, [InThunk, Result = MoveTemp(Result)]()
 			{
-				if (StatusCode == 401)
-				{
-					PRINT_LOG(LogJWNU_GIS_ApiClientService, Display, TEXT("401 detected, queuing job and triggering token refresh..."));
-					JWNU_SCREEN_DEBUG(-1, 5.0f, FColor::Orange, TEXT("[JWNU] 401 Unauthorized — Triggering token refresh for %s"), *UEnum::GetValueAsString(PendingRequest.ServiceType));
-					InHandle->MarkWaitingForRefresh();
-					FJWNU_PendingJob Job;
-					Job.RequestInfo = PendingRequest;
-					Job.OnTokenReady = [this, PendingRequest, OnHttpResponse, OnHttpRequestJobRetry, InHandle](const FString& NewAccessToken)
-					{
-						if (InHandle->IsCancelled()) { InHandle->ClearWaitingForRefresh(); return; }
-						InHandle->ClearWaitingForRefresh();
-						CallApi_NoTemplate_Execution(PendingRequest.Method, PendingRequest.ServiceType, PendingRequest.URL, NewAccessToken, PendingRequest.ContentBody, PendingRequest.QueryParams, OnHttpResponse, InHandle, OnHttpRequestJobRetry, false);
-					};
-					Job.OnTokenFailed = [OnHttpResponse, InHandle](const FString& ErrorCode, const FString& ErrorMessage)
-					{
-						InHandle->ClearWaitingForRefresh();
-						const FString FakeResponseBody = FString::Printf(TEXT("{\"success\": false, \"code\": \"%s\", \"message\": \"%s\"}"), *ErrorCode, *ErrorMessage);
-						OnHttpResponse.ExecuteIfBound(EJWNU_HttpStatusCode::None, FakeResponseBody);
-					};
-					RequestTokenRefresh(PendingRequest.ServiceType, MoveTemp(Job));
-					return;
-				}
-
-				OnHttpResponse.ExecuteIfBound(JWNU_IntToHttpStatusCode(StatusCode), ResponseBody);
+				InThunk->Deliver(&Result);
 			});
+		});
+
+	// 실패 콜백 (게임 스레드). 가짜 JSON 리스폰스 바디를 파싱하지 않고, 남은 원소를 넘긴 뒤 에러를 전달한다
+	const FOnHttpRequestFailedDelegate FailureCallback = MakeTypedFailureCallback(InRequest, InIdentityContext, InThunk, InHandle, OnHttpRequestJobRetry, bTryTokenRefreshing, Sink);
 
-		// Http 리퀘스트
-		UJWNU_HttpRequestJob* Job = UJWNU_GIS_HttpClientHelper::SendRequest_CustomResponse(GetWorld(), InMethod, InURL, InAccessToken, InContentBody, InQueryParams, CallbackManage401, OnHttpRequestJobRetry);
-		if (Job) { InHandle->BindJob(Job); }
+	// Http 리퀘스트
+	UJWNU_HttpRequestJob* Job = UJWNU_GIS_HttpClientHelper::SendRequest_StreamResponse(GetWorld(), InRequest, InAccessToken, StreamCallback, Callback, FailureCallback);
+	if (Job == nullptr)
+	{
+		// 프로세서를 찾지 못해 콜백 없이 끝난 경우
+		InHandle.Release();
+		return;
 	}
-	else
+	InHandle.BindJob(Job);
+}
+
+void UJWNU_GIS_ApiClientService::FinishStream(const FJWNU_StreamElementSinkRef& InSink, const FJWNU_RequestHandle& InHandle, TUniqueFunction<void()>&& InDeliverResult)
+{
+	// 남은 원소와 완료 결과를 앞서 보낸 청크 뒤에 이어서 게임 스레드 큐에 넣어 순서를 보장한다
+	InSink->Flush();
+	TWeakObjectPtr<UJWNU_GIS_ApiClientService> WeakThis(this);
+	AsyncTask(ENamedThreads::GameThread, [WeakThis, InHandle, DeliverResult = MoveTemp(InDeliverResult)]()
 	{
-		// 401 상태 코드를 처리하지 않는 콜백
-		const auto CallbackNoManage401 = FOnHttpRequestCompletedDelegate::CreateWeakLambda(this,
-			[this, OnHttpResponse](const int32 StatusCode, const FString& ResponseBody)
+		if (WeakThis.IsValid() == false)
+		{
+			return;
+		}
+		if (InHandle.IsRunning() == false)
+		{
+			return;
+		}
+		InHandle.Release();
+		DeliverResult();
+	});
+}
+
+FOnHttpRequestFailedDelegate UJWNU_GIS_ApiClientService::MakeTypedFailureCallback(
+	const FJWNU_RequestDescriptorRef& InRequest,
+	const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext,
+	const FJWNU_ResponseThunkRef& InThunk,
+	const FJWNU_RequestHandle& InHandle,
+	const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry,
+	const bool bTryTokenRefreshing,
+	const TSharedPtr<IJWNU_StreamElementSink, ESPMode::ThreadSafe>& InStreamSink)
+{
+	return FOnHttpRequestFailedDelegate::CreateWeakLambda(this,
+		[this, InRequest, InIdentityContext, InThunk, OnHttpRequestJobRetry, InHandle, bTryTokenRefreshing, InStreamSink](const FJWNU_ApiError& InError)
+		{
+			if (bTryTokenRefreshing && InError.StatusCode == 401 && InIdentityContext.IsValid())
 			{
-				OnHttpResponse.ExecuteIfBound(JWNU_IntToHttpStatusCode(StatusCode), ResponseBody);
-			});
+				PRINT_LOG(LogJWNU_GIS_ApiClientService, Display, TEXT("401 detected, queuing job and triggering token refresh..."));
+				JWNU_SCREEN_DEBUG(-1, 5.0f, FColor::Orange, TEXT("[JWNU] 401 Unauthorized — Triggering token refresh for %s"), *UEnum::GetValueAsString(InRequest->GetServiceType()));
+				FJWNU_PendingJob Job;
+				Job.Request = InRequest;
+				Job.Handle = InHandle;
+				Job.OnTokenReady = [this, InRequest, InIdentityContext, InThunk, OnHttpRequestJobRetry, InHandle](const FString& NewAccessToken)
+				{
+					if (InHandle.IsRunning() == false) { return; }
+					CallApi_Typed_Execution(InRequest, InIdentityContext, NewAccessToken, InThunk, InHandle, OnHttpRequestJobRetry, false);
+				};
+				Job.OnTokenFailed = [InThunk, InHandle](const FJWNU_ApiError& InRefreshError)
+				{
+					if (InHandle.IsRunning() == false) { return; }
+					InHandle.Release();
+					DeliverTypedError(*InThunk, InRefreshError);
+				};
+				RequestTokenRefresh(InIdentityContext.ToSharedRef(), InRequest->GetServiceType(), MoveTemp(Job));
+				return;
+			}
+
+			// 스트림 호출이라면 이미 받은 원소를 먼저 넘긴 뒤 에러를 전달
+			if (InStreamSink.IsValid())
+			{
+				FinishStream(InStreamSink.ToSharedRef(), InHandle, [InThunk, InError]()
+				{
+					DeliverTypedError(*InThunk, InError);
+				});
+				return;
+			}
+
+			InHandle.Release();
+			DeliverTypedError(*InThunk, InError);
+		});
+}
 
-		// Http 리퀘스트
-		UJWNU_HttpRequestJob* Job = UJWNU_GIS_HttpClientHelper::SendRequest_CustomResponse(GetWorld(), InMethod, InURL, InAccessToken, InContentBody, InQueryParams, CallbackNoManage401, OnHttpRequestJobRetry);
-		if (Job) { InHandle->BindJob(Job); }
+void UJWNU_GIS_ApiClientService::ParseAndDeliverTypedResponse(TArray<uint8>&& ResponseBytes, const FJWNU_ResponseThunkRef& InThunk, const FJWNU_RequestHandle& InHandle)
+{
+	if (bParseResponsesOffGameThread == false || ResponseBytes.Num() < OffGameThreadParseMinLength)
+	{
+		FStructOnScope ResultData(InThunk->Struct);
+		ParseTypedResponseBody(ResponseBytes, InThunk->Struct, ResultData.GetStructMemory());
+		InHandle.Release();
+		InThunk->Deliver(ResultData.GetStructMemory());
+		return;
+	}
+
+	// 워커 스레드에서 파싱하고, 완성된 구조체만 게임 스레드로 전달 (큰 바디를 게임 스레드에서 복사하지 않도록 버퍼는 이동)
+	TWeakObjectPtr<UJWNU_GIS_ApiClientService> WeakThis(this);
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, InHandle, ResponseBytes = MoveTemp(ResponseBytes), InThunk]()
+	{
+		const TSharedRef<FStructOnScope, ESPMode::ThreadSafe> ResultData = MakeShared<FStructOnScope, ESPMode::ThreadSafe>(InThunk->Struct);
+		ParseTypedResponseBody(ResponseBytes, InThunk->Struct, ResultData->GetStructMemory());
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, InHandle, ResultData, InThunk]()
+		{
+			if (WeakThis.IsValid() == false)
+			{
+				return;
+			}
+			if (InHandle.IsRunning() == false)
+			{
+				PRINT_LOG(LogJWNU_GIS_ApiClientService, Verbose, TEXT("Request cancelled while parsing response off the game thread, skipping callback"));
+				return;
+			}
+			InHandle.Release();
+			InThunk->Deliver(ResultData->GetStructMemory());
+		});
+	});
+}
+
+void UJWNU_GIS_ApiClientService::DeliverTypedError(const FJWNU_ResponseThunk& InThunk, const FJWNU_ApiError& InError)
+{
+	if (InThunk.DeliverError)
+	{
+		InThunk.DeliverError(InError);
+		return;
+	}
+
+	// 에러 콜백이 없다면 응답 구조체의 Code, Message 필드에 바로 채워 전달
+	FStructOnScope ErrorResult(InThunk.Struct);
+	SetErrorFields(InThunk.Struct, ErrorResult.GetStructMemory(), InError.Code, InError.Message);
+	InThunk.Deliver(ErrorResult.GetStructMemory());
+}
+
+void UJWNU_GIS_ApiClientService::ParseTypedResponseBody(const TArray<uint8>& ResponseBytes, const UScriptStruct* InStruct, void* OutStructData)
+{
+	if (FJWNU_JsonStructReader::ReadUtf8(reinterpret_cast<const UTF8CHAR*>(ResponseBytes.GetData()), ResponseBytes.Num(), InStruct, OutStructData) == false)
+	{
+		SetErrorFields(InStruct, OutStructData, TEXT("JSON_PARSE_ERROR"), TEXT("Failed to Parse JSON Response Body"));
 	}
 }
 
-void UJWNU_GIS_ApiClientService::RequestTokenRefresh(const EJWNU_ServiceType InServiceType, FJWNU_PendingJob&& InJob)
+void UJWNU_GIS_ApiClientService::SetErrorFields(const UScriptStruct* InStruct, void* OutStructData, const FString& InCode, const FString& InMessage)
 {
-	// 잡을 큐에 적재
-	PendingJobQueues.FindOrAdd(InServiceType).Add(MoveTemp(InJob));
+	const FStrProperty* CodeProperty = FindFProperty<FStrProperty>(InStruct, TEXT("Code"));
+	const FStrProperty* MessageProperty = FindFProperty<FStrProperty>(InStruct, TEXT("Message"));
+
+	// FJWNU_RES_Base를 상속하지 않은 구조체라면 호출자가 에러를 알 수 없으므로 경고
+	if (CodeProperty == nullptr || MessageProperty == nullptr)
+	{
+		PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("%s has no Code/Message field, error is not visible to the caller! (%s: %s)"), *InStruct->GetName(), *InCode, *InMessage);
+	}
+	if (CodeProperty)
+	{
+		CodeProperty->SetPropertyValue_InContainer(OutStructData, InCode);
+	}
+	if (MessageProperty)
+	{
+		MessageProperty->SetPropertyValue_InContainer(OutStructData, InMessage);
+	}
+}
+
+void UJWNU_GIS_ApiClientService::ParseStreamEnvelope(FJWNU_JsonArrayStreamReader& InReader, FJWNU_RES_Base& OutResult)
+{
+	// 스트림 도중 실패했거나 바디가 중간에 끊긴 경우
+	if (InReader.Finish() == false)
+	{
+		OutResult.Success = false;
+		OutResult.Code = TEXT("JSON_PARSE_ERROR");
+		OutResult.Message = InReader.GetErrorMessage();
+		return;
+	}
+
+	// 루트 배열이라면 봉투에 공통 응답 필드가 없으므로 성공으로 간주
+	const TArray<uint8>& Envelope = InReader.GetEnvelope();
+	if (Envelope.Num() > 0 && Envelope[0] == '[')
+	{
+		OutResult.Success = true;
+		OutResult.Code = TEXT("SUCCESS");
+		OutResult.Message = FString::Printf(TEXT("Streamed %d elements"), InReader.GetElementCount());
+		return;
+	}
+
+	if (FJWNU_JsonStructReader::ReadUtf8(Envelope, OutResult) == false)
+	{
+		OutResult.Code = TEXT("JSON_PARSE_ERROR");
+		OutResult.Message = TEXT("Failed to Parse JSON Response Body");
+		return;
+	}
+	if (InReader.HasFoundArray() == false && OutResult.Success)
+	{
+		PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Stream response succeeded but the target array field was not found"));
+	}
+}
+
+void UJWNU_GIS_ApiClientService::RequestTokenRefresh(const TSharedRef<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext, const EJWNU_ServiceType InServiceType, FJWNU_PendingJob&& InJob)
+{
+	// 잡을 인증 컨텍스트의 큐에 적재 (리프레시가 길어지는 동안 취소된 잡이 콜백을 붙잡고 쌓이지 않도록 함께 정리)
+	TArray<FJWNU_PendingJob>& Queue = InIdentityContext->PendingJobQueues.FindOrAdd(InServiceType);
+	RemoveCancelledPendingJobs(Queue);
+	Queue.Add(MoveTemp(InJob));
 
 	// 이미 리프레시 진행 중이면 큐 적재만으로 종료
-	bool& bRefreshing = RefreshInProgressFlags.FindOrAdd(InServiceType);
+	bool& bRefreshing = InIdentityContext->RefreshInProgressFlags.FindOrAdd(InServiceType);
 	if (bRefreshing)
 	{
 		PRINT_LOG(LogJWNU_GIS_ApiClientService, Display, TEXT("Refresh already in progress, queuing job only"));
@@ -219,38 +688,60 @@ void UJWNU_GIS_ApiClientService::RequestTokenRefresh(const EJWNU_ServiceType InS
 
 	// 리프레시 시작
 	bRefreshing = true;
-	ExecuteTokenRefresh(InServiceType);
+	ExecuteTokenRefresh(InIdentityContext, InServiceType);
 }
 
-void UJWNU_GIS_ApiClientService::ExecuteTokenRefresh(EJWNU_ServiceType InServiceType)
+void UJWNU_GIS_ApiClientService::RemoveCancelledPendingJobs(TArray<FJWNU_PendingJob>& InOutJobs)
 {
-	// IdentityProvider 획득
-	const auto IdentityProvider = UJWNU_GIS_ApiIdentityProvider::Get(GetWorld());
-	if (IdentityProvider == nullptr)
+	// 핸들이 없는 내부 잡은 유지하고, 핸들이 있는데 더 이상 실행 중이 아닌 잡만 버린다
+	const int32 RemovedCount = InOutJobs.RemoveAll([](const FJWNU_PendingJob& InJob)
+	{
+		return InJob.Handle.IsValid() && InJob.Handle.IsRunning() == false;
+	});
+	if (RemovedCount > 0)
+	{
+		PRINT_LOG(LogJWNU_GIS_ApiClientService, Display, TEXT("Dropped %d cancelled jobs waiting for token refresh"), RemovedCount);
+	}
+}
+
+void UJWNU_GIS_ApiClientService::ExecuteTokenRefresh(const TSharedRef<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext, EJWNU_ServiceType InServiceType)
+{
+	// 영속 컨텍스트의 키스토어가 아직 로드 중이라면 게임 스레드를 막지 않고 로드 반영 후 다시 시도 (대기열은 그대로 쌓인다)
+	UJWNU_GIS_ApiIdentityProvider* PersistentStore = InIdentityContext->PersistentStore.Get();
+	if (PersistentStore && PersistentStore->IsKeystoreLoaded() == false)
 	{
-		PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Failed to get IdentityProvider!"));
-		DrainPendingJobs_Failure(InServiceType, TEXT("IDENTITY_PROVIDER_NOT_FOUND"), TEXT("Failed to get identity provider"));
+		PRINT_LOG(LogJWNU_GIS_ApiClientService, Display, TEXT("Keystore is still loading, deferring token refresh"));
+		TWeakObjectPtr<UJWNU_GIS_ApiClientService> WeakThis(this);
+		const TSharedRef<FJWNU_IdentityContext, ESPMode::ThreadSafe> IdentityContext = InIdentityContext;
+		PersistentStore->CallWhenKeystoreLoaded([WeakThis, IdentityContext, InServiceType]()
+		{
+			if (UJWNU_GIS_ApiClientService* This = WeakThis.Get())
+			{
+				This->ExecuteTokenRefresh(IdentityContext, InServiceType);
+			}
+		});
 		return;
 	}
 
-	// 리프레시 토큰 컨테이너 획득
+	// 리프레시 토큰 컨테이너 획득 (기본 컨텍스트라면 부팅 시 로드한 키스토어 메모리 사본에서 반환)
 	FJWNU_RefreshTokenContainer RefreshTokenContainer;
-	if (UJWNU_GIS_ApiIdentityProvider::GetRefreshTokenContainer(InServiceType, RefreshTokenContainer) == false)
+	if (InIdentityContext->GetRefreshTokenContainer(InServiceType, RefreshTokenContainer) == false)
 	{
-		PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Failed to get refresh token container!"));
-		DrainPendingJobs_Failure(InServiceType, TEXT("REFRESH_TOKEN_NOT_FOUND"), TEXT("Failed to get refresh token container"));
+		PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Failed to get refresh token container! (Context: %s)"), *InIdentityContext->GetContextName());
+		DrainPendingJobs_Failure(InIdentityContext, InServiceType, FJWNU_ApiError(TEXT("REFRESH_TOKEN_NOT_FOUND"), TEXT("Failed to get refresh token container")));
 		return;
 	}
 
 	// 리프레시 API 콜백
-	const auto RefreshCallback = FOnHttpRequestCompletedDelegate::CreateWeakLambda(this,
-		[this, InServiceType, IdentityProvider](const int32 StatusCode, const FString& ResponseBody)
+	const TSharedRef<FJWNU_IdentityContext, ESPMode::ThreadSafe> IdentityContext = InIdentityContext;
+	const auto RefreshCallback = FOnHttpRequestCompletedUtf8Delegate::CreateWeakLambda(this,
+		[this, InServiceType, IdentityContext](const int32 StatusCode, TArray<uint8>&& ResponseBytes)
 		{
-			// 언리얼 구조체 파싱 시도
+			// UTF-8 바이트에서 언리얼 구조체로 바로 파싱 시도
 			FJWNU_RES_AuthRefresh ResultData;
-			if (FJsonObjectConverter::JsonObjectStringToUStruct(ResponseBody, &ResultData, 0, 0) == false)
+			if (FJWNU_JsonStructReader::ReadUtf8(ResponseBytes, ResultData) == false)
 			{
-				DrainPendingJobs_Failure(InServiceType, TEXT("JSON_PARSE_ERROR"), TEXT("Failed to parse refresh response"));
+				DrainPendingJobs_Failure(IdentityContext, InServiceType, FJWNU_ApiError(TEXT("JSON_PARSE_ERROR"), TEXT("Failed to parse refresh response")));
 				return;
 			}
 
@@ -258,7 +749,7 @@ void UJWNU_GIS_ApiClientService::ExecuteTokenRefresh(EJWNU_ServiceType InService
 			if (ResultData.Success == false || ResultData.AccessToken.IsEmpty())
 			{
 				PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Token Refresh has been failed : %s"), *ResultData.Message);
-				DrainPendingJobs_Failure(InServiceType, TEXT("TOKEN_REFRESH_FAILED"), FString::Printf(TEXT("Token refresh failed: %s"), *ResultData.Message));
+				DrainPendingJobs_Failure(IdentityContext, InServiceType, FJWNU_ApiError(TEXT("TOKEN_REFRESH_FAILED"), FString::Printf(TEXT("Token refresh failed: %s"), *ResultData.Message)));
 				return;
 			}
 
@@ -272,41 +763,64 @@ void UJWNU_GIS_ApiClientService::ExecuteTokenRefresh(EJWNU_ServiceType InService
 			PRINT_LOG(LogJWNU_GIS_ApiClientService, Display, TEXT("AccessToken : %s\nExpiresAt : %s\nRefreshToken : %s\nRefreshTokenExpiresAt : %s"), *NewAccessToken, *ExpireDateTime, *NewRefreshToken, *RefreshExpireDateTime);
 
 			// 인증 서버로부터 엑세스 토큰과 리프레시 토큰 컨테이너 갱신
-			IdentityProvider->SetAccessTokenContainer(InServiceType, { NewAccessToken, ResultData.ExpiresAt });
-			IdentityProvider->SetRefreshTokenContainer(InServiceType, { NewRefreshToken, ResultData.RefreshTokenExpiresAt });
+			// 리프레시 토큰은 메모리에만 즉시 반영되고, 파일 저장은 백그라운드에서 진행되므로 대기열 처리를 지연시키지 않는다
+			IdentityContext->SetAccessTokenContainer(InServiceType, { NewAccessToken, ResultData.ExpiresAt });
+			IdentityContext->SetRefreshTokenContainer(InServiceType, { NewRefreshToken, ResultData.RefreshTokenExpiresAt });
 
 			// 리프레시 응답에서 UserId 저장
 			if (!ResultData.UserId.IsEmpty())
 			{
-				IdentityProvider->SetUserId(ResultData.UserId);
+				IdentityContext->SetUserId(ResultData.UserId);
 			}
 
 			// 대기 중인 잡 일괄 처리
-			DrainPendingJobs_Success(InServiceType, NewAccessToken);
+			DrainPendingJobs_Success(IdentityContext, InServiceType, NewAccessToken);
+		});
+
+	// 리프레시 API 에러 콜백 (상태 코드, 시도 횟수, 전송 원인은 그대로 두고 코드와 메시지만 리프레시 실패로 바꾼다)
+	const auto RefreshFailureCallback = FOnHttpRequestFailedDelegate::CreateWeakLambda(this,
+		[this, InServiceType, IdentityContext](const FJWNU_ApiError& InError)
+		{
+			PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Token Refresh has been failed : %s"), *InError.Message);
+			FJWNU_ApiError RefreshError = InError;
+			RefreshError.Code = TEXT("TOKEN_REFRESH_FAILED");
+			RefreshError.Message = FString::Printf(TEXT("Token refresh failed: %s"), *InError.Message);
+			DrainPendingJobs_Failure(IdentityContext, InServiceType, RefreshError);
 		});
 
 	// 리프레시 API 호출
 	const FString RefreshURL = BuildRefreshTokenURL();
-	const FString TargetServer = UEnum::GetValueAsString(InServiceType);
-	const FString CurrentUserId = IdentityProvider->GetUserId();
-	const FString RefreshBody = FString::Printf(
-		TEXT("{\"userId\": \"%s\", \"targetServer\": \"%s\", \"refreshToken\": \"%s\"}"),
-		*CurrentUserId, *TargetServer, *RefreshTokenContainer.RefreshToken);
+	FJWNU_REQ_AuthRefresh RefreshRequest;
+	RefreshRequest.UserId = InIdentityContext->GetUserId();
+	RefreshRequest.TargetServer = UEnum::GetValueAsString(InServiceType);
+	RefreshRequest.RefreshToken = RefreshTokenContainer.RefreshToken;
+
+	// 요청 구조체를 UTF-8 바이트로 곧바로 직렬화 (토큰 문자열도 올바르게 이스케이프된다)
+	TArray<uint8> RefreshBody;
+	if (FJWNU_JsonStructWriter::WriteUtf8(RefreshRequest, RefreshBody) == false)
+	{
+		DrainPendingJobs_Failure(InIdentityContext, InServiceType, FJWNU_ApiError(TEXT("REQUEST_SERIALIZE_ERROR"), TEXT("Failed to serialize refresh request")));
+		return;
+	}
 	JWNU_SCREEN_DEBUG(-1, 5.0f, FColor::Cyan, TEXT("[JWNU] Calling Refresh API : %s"), *RefreshURL);
-	UJWNU_GIS_HttpClientHelper::SendRequest_CustomResponse(GetWorld(), EJWNU_HttpMethod::Post, RefreshURL, TEXT(""), RefreshBody, {}, RefreshCallback);
+	// 리프레시 엔드포인트 정책에 따라 대기열의 모든 요청이 기다리는 완료 콜백을 일반 응답보다 먼저(Critical) 디스패치
+	const FJWNU_EndpointInfo& RefreshEndpoint = TJWNU_EndpointTraits<FJWNU_EP_AuthRefresh>::GetInfo();
+	const FJWNU_RequestDescriptorRef RefreshDescriptor = UJWNU_GIS_HttpClientHelper::MakeRequestDescriptor(GetWorld(), RefreshEndpoint.GetMethod(), RefreshEndpoint.GetServiceType(), RefreshURL, MoveTemp(RefreshBody), {}, &RefreshEndpoint);
+	UJWNU_GIS_HttpClientHelper::SendRequest_Utf8Response(GetWorld(), RefreshDescriptor, TEXT(""), RefreshCallback, FOnHttpRequestJobRetryDelegate(), RefreshFailureCallback);
 }
 
-void UJWNU_GIS_ApiClientService::DrainPendingJobs_Success(const EJWNU_ServiceType InServiceType, const FString& NewAccessToken)
+void UJWNU_GIS_ApiClientService::DrainPendingJobs_Success(const TSharedRef<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext, const EJWNU_ServiceType InServiceType, const FString& NewAccessToken)
 {
 	// 플래그 해제
-	RefreshInProgressFlags.FindOrAdd(InServiceType) = false;
+	InIdentityContext->RefreshInProgressFlags.FindOrAdd(InServiceType) = false;
 
 	// 큐에서 잡을 꺼내어 일괄 처리
 	TArray<FJWNU_PendingJob> Jobs;
-	if (auto* Queue = PendingJobQueues.Find(InServiceType))
+	if (auto* Queue = InIdentityContext->PendingJobQueues.Find(InServiceType))
 	{
 		Jobs = MoveTemp(*Queue);
 	}
+	RemoveCancelledPendingJobs(Jobs);
 
 	PRINT_LOG(LogJWNU_GIS_ApiClientService, Display, TEXT("Refresh succeeded, draining %d pending jobs"), Jobs.Num());
 	JWNU_SCREEN_DEBUG(-1, 5.0f, FColor::Green, TEXT("[JWNU] Token Refresh SUCCESS — Draining %d pending jobs"), Jobs.Num());
@@ -317,29 +831,146 @@ void UJWNU_GIS_ApiClientService::DrainPendingJobs_Success(const EJWNU_ServiceTyp
 			Job.OnTokenReady(NewAccessToken);
 		}
 	}
+
+	// 시작 시 세션 복구 중이었다면 진행 상황 반영 (세션 복구는 영속화되는 기본 컨텍스트만 대상으로 한다)
+	if (InIdentityContext->IsPersistent())
+	{
+		CompleteSessionRestoreStep(InServiceType);
+	}
 }
 
-void UJWNU_GIS_ApiClientService::DrainPendingJobs_Failure(const EJWNU_ServiceType InServiceType, const FString& ErrorCode, const FString& ErrorMessage)
+void UJWNU_GIS_ApiClientService::DrainPendingJobs_Failure(const TSharedRef<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext, const EJWNU_ServiceType InServiceType, const FJWNU_ApiError& InError)
 {
 	// 플래그 해제
-	RefreshInProgressFlags.FindOrAdd(InServiceType) = false;
+	InIdentityContext->RefreshInProgressFlags.FindOrAdd(InServiceType) = false;
 
 	// 큐에서 잡을 꺼내어 일괄 실패 처리
 	TArray<FJWNU_PendingJob> Jobs;
-	if (auto* Queue = PendingJobQueues.Find(InServiceType))
+	if (auto* Queue = InIdentityContext->PendingJobQueues.Find(InServiceType))
 	{
 		Jobs = MoveTemp(*Queue);
 	}
+	RemoveCancelledPendingJobs(Jobs);
 
-	PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Refresh failed, draining %d pending jobs with error (Code: %s)"), Jobs.Num(), *ErrorCode);
-	JWNU_SCREEN_DEBUG(-1, 7.0f, FColor::Red, TEXT("[JWNU] Token Refresh FAILED — %s: %s (%d jobs drained)"), *ErrorCode, *ErrorMessage, Jobs.Num());
+	PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Refresh failed, draining %d pending jobs with error (Code: %s)"), Jobs.Num(), *InError.Code);
+	JWNU_SCREEN_DEBUG(-1, 7.0f, FColor::Red, TEXT("[JWNU] Token Refresh FAILED — %s: %s (%d jobs drained)"), *InError.Code, *InError.Message, Jobs.Num());
 	for (auto& Job : Jobs)
 	{
 		if (Job.OnTokenFailed)
 		{
-			Job.OnTokenFailed(ErrorCode, ErrorMessage);
+			Job.OnTokenFailed(InError);
+		}
+	}
+
+	// 시작 시 세션 복구 중이었다면 진행 상황 반영 (실패한 서비스는 다음 API 호출 시 기존 401 흐름을 따른다)
+	if (InIdentityContext->IsPersistent())
+	{
+		CompleteSessionRestoreStep(InServiceType);
+	}
+}
+
+// ──────── 세션 복구 ────────
+
+bool UJWNU_GIS_ApiClientService::IsSessionReady() const
+{
+	return bSessionReady;
+}
+
+FOnSessionReadyDelegate& UJWNU_GIS_ApiClientService::GetOnSessionReady()
+{
+	return OnSessionReady;
+}
+
+void UJWNU_GIS_ApiClientService::RestoreSession()
+{
+	const UGameInstance* GameInstance = GetGameInstance();
+	UJWNU_GIS_ApiIdentityProvider* IdentityProvider = GameInstance ? GameInstance->GetSubsystem<UJWNU_GIS_ApiIdentityProvider>() : nullptr;
+	if (IdentityProvider == nullptr)
+	{
+		PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Failed to get IdentityProvider, skipping session restore!"));
+		MarkSessionReady();
+		return;
+	}
+	IdentityProvider->GetOnKeystoreLoaded().RemoveAll(this);
+
+	// HTTP 잡은 월드 타이머를 사용하므로 월드가 생길 때까지 다음 틱으로 미룬다
+	if (GetWorld() == nullptr)
+	{
+		if (SessionRestoreTickerHandle.IsValid() == false)
+		{
+			SessionRestoreTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float)
+			{
+				SessionRestoreTickerHandle.Reset();
+				RestoreSession();
+				return false;
+			}));
+		}
+		return;
+	}
+
+	// 만료되지 않은 리프레시 토큰이 있는 서비스를 모두 수집
+	const int64 CurrentUnixTime = FDateTime::UtcNow().ToUnixTimestamp();
+	const UEnum* ServiceTypeEnum = StaticEnum<EJWNU_ServiceType>();
+	for (int32 Index = 0; Index < ServiceTypeEnum->NumEnums() - 1; Index++)
+	{
+		const EJWNU_ServiceType ServiceType = static_cast<EJWNU_ServiceType>(ServiceTypeEnum->GetValueByIndex(Index));
+		FJWNU_RefreshTokenContainer RefreshTokenContainer;
+		if (IdentityProvider->GetRefreshTokenContainer(ServiceType, RefreshTokenContainer) == false || RefreshTokenContainer.RefreshToken.IsEmpty())
+		{
+			continue;
 		}
+		if (RefreshTokenContainer.ExpiresAt > 0 && CurrentUnixTime >= RefreshTokenContainer.ExpiresAt)
+		{
+			PRINT_LOG(LogJWNU_GIS_ApiClientService, Display, TEXT("Stored refresh token for %s has expired, skipping restore"), *UEnum::GetValueAsString(ServiceType));
+			continue;
+		}
+		SessionRestorePendingServices.Add(ServiceType);
 	}
+
+	if (SessionRestorePendingServices.Num() == 0)
+	{
+		MarkSessionReady();
+		return;
+	}
+
+	PRINT_LOG(LogJWNU_GIS_ApiClientService, Display, TEXT("Restoring session for %d service(s)..."), SessionRestorePendingServices.Num());
+
+	// 모든 서비스의 리프레시를 동시에 시작 (리프레시 도중의 API 호출은 기존 대기열에 적재되어 함께 처리된다)
+	// 리프레시가 동기적으로 실패하면 대기 목록이 순회 중에 바뀌므로 사본을 순회
+	const TSharedRef<FJWNU_IdentityContext, ESPMode::ThreadSafe> DefaultIdentityContext = IdentityProvider->GetDefaultIdentityContext();
+	const TArray<EJWNU_ServiceType> ServicesToRestore = SessionRestorePendingServices.Array();
+	for (const EJWNU_ServiceType ServiceType : ServicesToRestore)
+	{
+		bool& bRefreshing = DefaultIdentityContext->RefreshInProgressFlags.FindOrAdd(ServiceType);
+		if (bRefreshing)
+		{
+			continue;
+		}
+		bRefreshing = true;
+		ExecuteTokenRefresh(DefaultIdentityContext, ServiceType);
+	}
+}
+
+void UJWNU_GIS_ApiClientService::CompleteSessionRestoreStep(const EJWNU_ServiceType InServiceType)
+{
+	if (SessionRestorePendingServices.Remove(InServiceType) > 0 && SessionRestorePendingServices.Num() == 0)
+	{
+		MarkSessionReady();
+	}
+}
+
+void UJWNU_GIS_ApiClientService::MarkSessionReady()
+{
+	if (bSessionReady)
+	{
+		return;
+	}
+
+	bSessionReady = true;
+	PRINT_LOG(LogJWNU_GIS_ApiClientService, Display, TEXT("Session ready"));
+	JWNU_SCREEN_DEBUG(-1, 5.0f, FColor::Green, TEXT("[JWNU] Session Ready"));
+	OnSessionReady.Broadcast();
+	OnSessionReadyBPEvent.Broadcast();
 }
 
 FString UJWNU_GIS_ApiClientService::BuildRefreshTokenURL() const
@@ -347,15 +978,16 @@ FString UJWNU_GIS_ApiClientService::BuildRefreshTokenURL() const
 	if (const auto HostProvider = UJWNU_GIS_ApiHostProvider::Get(GetWorld()))
 	{
 		FString Host;
-		if (HostProvider->GetHost(EJWNU_ServiceType::AuthServer, Host))
+		if (HostProvider->GetHost(FJWNU_EP_AuthRefresh::ServiceType, Host))
 		{
-			return FString::Printf(TEXT("%s/auth/refresh"), *Host);
+			Host.Append(FJWNU_EP_AuthRefresh::Path);
+			return Host;
 		}
 	}
 
 	PRINT_LOG(LogJWNU_GIS_ApiClientService, Error, TEXT("Failed to get AuthServer host! Check your INI configuration."));
 #if !UE_BUILD_SHIPPING
-	return TEXT("http://localhost:5000/auth/refresh");
+	return FString(TEXT("http://localhost:5000")) + FJWNU_EP_AuthRefresh::Path;
 #else
 	return TEXT("");
 #endif
@@ -7,23 +7,145 @@
 #include "Misc/Paths.h"
 #include "Misc/FileHelper.h"
 #include "HAL/PlatformFileManager.h"
+#include "HAL/FileManager.h"
 #include "GenericPlatform/GenericPlatformFile.h"
-
-#if PLATFORM_WINDOWS
-#include "Windows/AllowWindowsPlatformTypes.h"
-#include <windows.h>
-#include <dpapi.h>
-#pragma comment(lib, "crypt32.lib")
-#endif
+#include "Tasks/Task.h"
+#include "Async/Async.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
 
 DEFINE_LOG_CATEGORY(LogJWNU_GIS_ApiIdentityProvider);
 
+namespace JWNU_Keystore_Private
+{
+	/** 키스토어 파일 식별자 ('JWKS') */
+	constexpr uint32 Magic = 0x534B574A;
+
+	/** 키스토어 레이아웃 버전. 페이로드 구조가 바뀌면 올리고 LoadKeystore에서 분기한다. */
+	constexpr uint16 Version = 1;
+}
+
+/**
+ * 키스토어 파일 로드 결과 열거형.
+ */
+enum class EJWNU_KeystoreLoadStatus : uint8
+{
+	/** 복호화까지 성공 */
+	Loaded,
+	/** 파일이 없음 (첫 실행) */
+	NotFound,
+	/** 헤더, 페이로드, 복호화, 역직렬화 중 하나가 깨진 파일 */
+	Corrupt,
+	/** 더 최신 버전이거나 현재 플랫폼에서 사용할 수 없는 백엔드로 기록된 파일 */
+	Unsupported,
+};
+
+/**
+ * 게임 스레드와 백그라운드 저장 작업이 공유하는 키스토어 저장 대기열.
+ * 키스토어 전체의 가장 최신 스냅샷 하나만 보관하여 저장을 병합한다.
+ */
+struct FJWNU_RefreshTokenWriteQueue
+{
+	/** 대기열 접근 보호용 락 */
+	FCriticalSection Lock;
+
+	/** 저장 대기 중인 최신 레코드 스냅샷 */
+	TOptional<TMap<FString, FJWNU_RefreshTokenContainer>> PendingSnapshot;
+
+	/** 저장에 사용할 암호화 백엔드 */
+	TSharedPtr<IJWNU_TokenCipher, ESPMode::ThreadSafe> Cipher;
+
+	/** 저장 작업 진행 여부 */
+	bool bWriterScheduled = false;
+
+	/** 마지막 백그라운드 저장의 실패 여부 (다음 저장 요청의 결과로 보고한다) */
+	bool bLastWriteFailed = false;
+
+	/** 마지막으로 시작된 저장 작업 (종료 시 대기용) */
+	UE::Tasks::FTask WriterTask;
+};
+
+/**
+ * 백그라운드 키스토어 로드 작업이 채우고 게임 스레드가 반영하는 로드 결과.
+ */
+struct FJWNU_KeystoreLoadResult
+{
+	/** 키스토어에서 복호화한 레코드 */
+	TMap<FString, FJWNU_RefreshTokenContainer> Records;
+
+	/** 백그라운드에서 생성한 현재 플랫폼의 기본 암호화 백엔드 (솔트 파일 I/O를 게임 스레드에서 하지 않기 위함) */
+	TSharedPtr<IJWNU_TokenCipher, ESPMode::ThreadSafe> Cipher;
+
+	/** 현재 기본 백엔드로 다시 기록해야 하는지 여부 */
+	bool bNeedsRewrite = false;
+
+	/** 읽을 수 없는 키스토어를 보존하거나 안전한 키가 없어서 이번 세션의 저장을 막아야 하는지 여부 */
+	bool bWriteLocked = false;
+};
+
 void UJWNU_GIS_ApiIdentityProvider::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
-	ServiceTypeToTokenContainerMap.Emplace(EJWNU_ServiceType::GameServer, {});
-	ServiceTypeToTokenContainerMap.Emplace(EJWNU_ServiceType::AuthServer, {});
+	DefaultIdentityContext = FJWNU_IdentityContext::Create(TEXT("Default"));
+	DefaultIdentityContext->BindPersistentStore(this);
+
+	// 암호화 백엔드는 로드 작업에서 만들어 반영 시점에 대기열에 넘긴다 (그 전의 저장은 반영 직후로 미뤄진다)
+	RefreshTokenWriteQueue = MakeShared<FJWNU_RefreshTokenWriteQueue, ESPMode::ThreadSafe>();
+
+	// 열거형 이름과 표시 이름(FText)은 게임 스레드에서 미리 조회해 백그라운드 작업에는 문자열만 넘긴다
+	TArray<TPair<FString, FString>> LegacyRecordFiles;
+	const UEnum* ServiceTypeEnum = StaticEnum<EJWNU_ServiceType>();
+	for (int32 Index = 0; Index < ServiceTypeEnum->NumEnums() - 1; Index++)
+	{
+		// 구버전 파일명은 열거형 표시 이름을 사용했다
+		const EJWNU_ServiceType ServiceType = static_cast<EJWNU_ServiceType>(ServiceTypeEnum->GetValueByIndex(Index));
+		LegacyRecordFiles.Emplace(GetKeystoreRecordKey(ServiceType), FString::Printf(TEXT("auth_%s.bin"), *ServiceTypeEnum->GetDisplayNameTextByIndex(Index).ToString()));
+	}
+
+	// 암호화 백엔드 생성, 키스토어 파일 I/O와 복호화는 백그라운드에서 진행하고, 완료되면 게임 스레드에서 반영
+	KeystoreLoadResult = MakeShared<FJWNU_KeystoreLoadResult, ESPMode::ThreadSafe>();
+	const TSharedRef<FJWNU_KeystoreLoadResult, ESPMode::ThreadSafe> LoadResult = KeystoreLoadResult.ToSharedRef();
+	TWeakObjectPtr<UJWNU_GIS_ApiIdentityProvider> WeakThis(this);
+	KeystoreLoadTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [LoadResult, LegacyRecordFiles = MoveTemp(LegacyRecordFiles), WeakThis]()
+	{
+		LoadKeystoreInBackground(*LoadResult, LegacyRecordFiles);
+		AsyncTask(ENamedThreads::GameThread, [WeakThis]()
+		{
+			if (UJWNU_GIS_ApiIdentityProvider* This = WeakThis.Get())
+			{
+				This->ApplyKeystoreLoadResult();
+			}
+		});
+	});
+}
+
+void UJWNU_GIS_ApiIdentityProvider::Deinitialize()
+{
+	// 진행 중인 로드 작업이 있다면 완료될 때까지 대기 (이관 중인 구버전 파일 보호)
+	if (KeystoreLoadTask.IsValid())
+	{
+		KeystoreLoadTask.Wait();
+	}
+
+	// 진행 중인 저장 작업이 있다면 완료될 때까지 대기 (토큰 유실 방지)
+	if (RefreshTokenWriteQueue.IsValid())
+	{
+		UE::Tasks::FTask WriterTask;
+		{
+			FScopeLock ScopeLock(&RefreshTokenWriteQueue->Lock);
+			WriterTask = RefreshTokenWriteQueue->WriterTask;
+		}
+		if (WriterTask.IsValid())
+		{
+			WriterTask.Wait();
+		}
+	}
+
+	// 로드 완료를 기다리던 콜백은 더 이상 실행하지 않는다
+	KeystoreLoadedCallbacks.Empty();
+
+	Super::Deinitialize();
 }
 
 UJWNU_GIS_ApiIdentityProvider* UJWNU_GIS_ApiIdentityProvider::Get(const UObject* WorldContextObject)
@@ -57,18 +179,10 @@ UJWNU_GIS_ApiIdentityProvider* UJWNU_GIS_ApiIdentityProvider::Get(const UObject*
 
 bool UJWNU_GIS_ApiIdentityProvider::GetAccessTokenContainer(const EJWNU_ServiceType InServiceType, EJWNU_TokenGetResult& OutTokenGetResult, FJWNU_AccessTokenContainer& OutAccessTokenContainer) const
 {
-	if (ServiceTypeToTokenContainerMap.Find(InServiceType))
+	if (GetAccessTokenContainer(InServiceType, OutAccessTokenContainer))
 	{
-		OutAccessTokenContainer = ServiceTypeToTokenContainerMap[InServiceType];
-		if (OutAccessTokenContainer.AccessToken.IsEmpty())
-		{
-			PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Extraction of AccessToken is Successful, but it's Empty!"));
-			OutTokenGetResult = EJWNU_TokenGetResult::Empty;
-			return true;
-		}
-
 		// 단, 내용물이 유효한지는 보장할 수 없다
-		OutTokenGetResult = EJWNU_TokenGetResult::Success;
+		OutTokenGetResult = OutAccessTokenContainer.AccessToken.IsEmpty() ? EJWNU_TokenGetResult::Empty : EJWNU_TokenGetResult::Success;
 		return true;
 	}
 
@@ -79,49 +193,38 @@ bool UJWNU_GIS_ApiIdentityProvider::GetAccessTokenContainer(const EJWNU_ServiceT
 
 bool UJWNU_GIS_ApiIdentityProvider::GetAccessTokenContainer(const EJWNU_ServiceType InServiceType, FJWNU_AccessTokenContainer& OutAccessTokenContainer) const
 {
-	if (ServiceTypeToTokenContainerMap.Find(InServiceType))
-	{
-		OutAccessTokenContainer = ServiceTypeToTokenContainerMap[InServiceType];
-		if (OutAccessTokenContainer.AccessToken.IsEmpty())
-		{
-			PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Extraction of AccessToken is Successful, but it's Empty!"));
-		}
+	return DefaultIdentityContext.IsValid() && DefaultIdentityContext->GetAccessTokenContainer(InServiceType, OutAccessTokenContainer);
+}
 
-		// 단, 내용물이 유효한지는 보장할 수 없다
+bool UJWNU_GIS_ApiIdentityProvider::SetAccessTokenContainer(const EJWNU_ServiceType InServiceType, EJWNU_TokenSetResult& OutTokenSetResult, const FJWNU_AccessTokenContainer& InAccessTokenContainer)
+{
+	if (SetAccessTokenContainer(InServiceType, InAccessTokenContainer))
+	{
+		OutTokenSetResult = EJWNU_TokenSetResult::Success;
 		return true;
 	}
 
-	// 기본 생성자의 트래시 토큰이 담겨있다
+	OutTokenSetResult = EJWNU_TokenSetResult::Fail;
 	return false;
 }
 
-bool UJWNU_GIS_ApiIdentityProvider::SetAccessTokenContainer(const EJWNU_ServiceType InServiceType, EJWNU_TokenSetResult& OutTokenSetResult, const FJWNU_AccessTokenContainer& InAccessTokenContainer)
-{
-	ServiceTypeToTokenContainerMap.Add(InServiceType, InAccessTokenContainer);
-	PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Display, TEXT("Token Container Updated for Service Type"));
-	OutTokenSetResult = EJWNU_TokenSetResult::Success;
-	return true;
-}
-
 bool UJWNU_GIS_ApiIdentityProvider::SetAccessTokenContainer(const EJWNU_ServiceType InServiceType, const FJWNU_AccessTokenContainer& InTokenContainer)
 {
-	ServiceTypeToTokenContainerMap.Add(InServiceType, InTokenContainer);
+	if (DefaultIdentityContext.IsValid() == false)
+	{
+		return false;
+	}
+	DefaultIdentityContext->SetAccessTokenContainer(InServiceType, InTokenContainer);
 	PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Display, TEXT("Token Container Updated for Service Type"));
 	return true;
 }
 
 bool UJWNU_GIS_ApiIdentityProvider::GetRefreshTokenContainer(const EJWNU_ServiceType InServiceType, EJWNU_TokenGetResult& OutTokenGetResult, FJWNU_RefreshTokenContainer& OutRefreshTokenContainer) const
 {
-	if (LoadRefreshTokenContainer(InServiceType, OutRefreshTokenContainer))
+	if (GetRefreshTokenContainer(InServiceType, OutRefreshTokenContainer))
 	{
-		if (OutRefreshTokenContainer.RefreshToken.IsEmpty())
-		{
-			OutTokenGetResult = EJWNU_TokenGetResult::Empty;
-			PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Refresh token container retrieved, but token is empty!"));
-		}
-
 		// 단, 내용물이 유효한지는 보장할 수 없다
-		OutTokenGetResult = EJWNU_TokenGetResult::Success;
+		OutTokenGetResult = OutRefreshTokenContainer.RefreshToken.IsEmpty() ? EJWNU_TokenGetResult::Empty : EJWNU_TokenGetResult::Success;
 		return true;
 	}
 
@@ -130,22 +233,30 @@ bool UJWNU_GIS_ApiIdentityProvider::GetRefreshTokenContainer(const EJWNU_Service
 	return false;
 }
 
-bool UJWNU_GIS_ApiIdentityProvider::GetRefreshTokenContainer(const EJWNU_ServiceType InServiceType, FJWNU_RefreshTokenContainer& OutRefreshTokenContainer)
+bool UJWNU_GIS_ApiIdentityProvider::GetRefreshTokenContainer(const EJWNU_ServiceType InServiceType, FJWNU_RefreshTokenContainer& OutRefreshTokenContainer) const
 {
-	if (LoadRefreshTokenContainer(InServiceType, OutRefreshTokenContainer))
+	// 부팅 시 복호화해 둔 메모리 사본에서 조회 (디스크 I/O 없음, 로드 중이라면 그 사이 설정된 레코드만 보인다)
+	if (const FJWNU_RefreshTokenContainer* Record = KeystoreRecords.Find(GetKeystoreRecordKey(InServiceType)))
 	{
+		OutRefreshTokenContainer = *Record;
 		if (OutRefreshTokenContainer.RefreshToken.IsEmpty())
 		{
 			PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Refresh token container retrieved, but token is empty!"));
 		}
 		return true;
 	}
+
+	// 로드 완료 전의 조회는 대기하지 않고 실패로 반환한다 (IsKeystoreLoaded, CallWhenKeystoreLoaded로 완료 시점을 기다릴 것)
+	if (bKeystoreLoaded == false)
+	{
+		PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Keystore is still loading, refresh token is not available yet!"));
+	}
 	return false;
 }
 
 bool UJWNU_GIS_ApiIdentityProvider::SetRefreshTokenContainer(const EJWNU_ServiceType InServiceType, EJWNU_TokenSetResult& OutTokenSetResult, const FJWNU_RefreshTokenContainer& InRefreshTokenContainer)
 {
-	if (SaveRefreshTokenContainer(InServiceType, InRefreshTokenContainer))
+	if (SetRefreshTokenContainer(InServiceType, InRefreshTokenContainer))
 	{
 		OutTokenSetResult = EJWNU_TokenSetResult::Success;
 		return true;
@@ -157,206 +268,491 @@ bool UJWNU_GIS_ApiIdentityProvider::SetRefreshTokenContainer(const EJWNU_Service
 
 bool UJWNU_GIS_ApiIdentityProvider::SetRefreshTokenContainer(const EJWNU_ServiceType InServiceType, const FJWNU_RefreshTokenContainer& InRefreshTokenContainer)
 {
-	return SaveRefreshTokenContainer(InServiceType, InRefreshTokenContainer);
+	// 열거형 범위를 벗어난 서비스 타입은 키스토어 레코드 키를 만들 수 없다
+	if (StaticEnum<EJWNU_ServiceType>()->IsValidEnumValue(static_cast<int64>(InServiceType)) == false)
+	{
+		PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Invalid service type %d!"), static_cast<int32>(InServiceType));
+		return false;
+	}
+
+	// 메모리 사본은 즉시 갱신하여 이후의 리프레시가 곧바로 새 토큰을 사용하도록 한다
+	KeystoreRecords.Add(GetKeystoreRecordKey(InServiceType), InRefreshTokenContainer);
+
+	// 키스토어 전체의 직렬화, 암호화, 파일 저장은 백그라운드에서 처리 (예약 실패나 직전 저장 실패를 결과로 보고)
+	return EnqueueKeystoreWrite();
+}
+
+// ──────── Keystore ────────
+
+bool UJWNU_GIS_ApiIdentityProvider::IsKeystoreLoaded() const
+{
+	return bKeystoreLoaded;
+}
+
+void UJWNU_GIS_ApiIdentityProvider::CallWhenKeystoreLoaded(TUniqueFunction<void()>&& InCallback)
+{
+	check(IsInGameThread());
+
+	if (bKeystoreLoaded)
+	{
+		InCallback();
+		return;
+	}
+	KeystoreLoadedCallbacks.Add(MoveTemp(InCallback));
+}
+
+void UJWNU_GIS_ApiIdentityProvider::ApplyKeystoreLoadResult()
+{
+	check(IsInGameThread());
+
+	// 로드 작업이 끝난 뒤 게임 스레드로 넘어온 시점에만 호출되므로 대기하지 않는다
+	if (bKeystoreLoaded)
+	{
+		return;
+	}
+	bKeystoreLoaded = true;
+
+	bool bNeedsWrite = bKeystoreWriteDeferred;
+	bKeystoreWriteDeferred = false;
+	if (KeystoreLoadResult.IsValid())
+	{
+		// 로드 도중 게임 스레드에서 설정된 레코드가 더 최신이므로 위에 덮어쓴다
+		TMap<FString, FJWNU_RefreshTokenContainer> MergedRecords = MoveTemp(KeystoreLoadResult->Records);
+		MergedRecords.Append(MoveTemp(KeystoreRecords));
+		KeystoreRecords = MoveTemp(MergedRecords);
+		bNeedsWrite |= KeystoreLoadResult->bNeedsRewrite;
+		bKeystoreWriteLocked = KeystoreLoadResult->bWriteLocked;
+
+		// 백그라운드에서 만든 암호화 백엔드를 저장 대기열과 공유
+		TokenCipher = MoveTemp(KeystoreLoadResult->Cipher);
+		if (RefreshTokenWriteQueue.IsValid())
+		{
+			FScopeLock ScopeLock(&RefreshTokenWriteQueue->Lock);
+			RefreshTokenWriteQueue->Cipher = TokenCipher;
+		}
+		KeystoreLoadResult.Reset();
+	}
+
+	if (bNeedsWrite)
+	{
+		EnqueueKeystoreWrite();
+	}
+
+	PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Display, TEXT("Keystore ready (%d records)"), KeystoreRecords.Num());
+
+	// 콜백 안에서 다시 등록되어도 안전하도록 목록을 꺼낸 뒤 실행
+	TArray<TUniqueFunction<void()>> Callbacks = MoveTemp(KeystoreLoadedCallbacks);
+	for (TUniqueFunction<void()>& Callback : Callbacks)
+	{
+		Callback();
+	}
+	OnKeystoreLoaded.Broadcast();
+}
+
+FOnKeystoreLoadedDelegate& UJWNU_GIS_ApiIdentityProvider::GetOnKeystoreLoaded()
+{
+	return OnKeystoreLoaded;
+}
+
+// ──────── Identity Context ────────
+
+TSharedRef<FJWNU_IdentityContext, ESPMode::ThreadSafe> UJWNU_GIS_ApiIdentityProvider::GetDefaultIdentityContext() const
+{
+	return DefaultIdentityContext.ToSharedRef();
 }
 
 // ──────── UserId ────────
 
 FString UJWNU_GIS_ApiIdentityProvider::GetUserId() const
 {
-	return UserId;
+	return DefaultIdentityContext.IsValid() ? DefaultIdentityContext->GetUserId() : FString();
 }
 
 void UJWNU_GIS_ApiIdentityProvider::SetUserId(const FString& InUserId)
 {
-	UserId = InUserId;
-	PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Display, TEXT("UserId set: %s"), *UserId);
+	if (DefaultIdentityContext.IsValid())
+	{
+		DefaultIdentityContext->SetUserId(InUserId);
+	}
 }
 
 // ──────── 세션 정리 ────────
 
 void UJWNU_GIS_ApiIdentityProvider::ClearSession(const EJWNU_ServiceType InServiceType)
 {
-	// AccessToken 정리
-	ServiceTypeToTokenContainerMap.Add(InServiceType, {});
-
-	PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Display, TEXT("Session cleared (ServiceType: %s) — UserId preserved"), *UEnum::GetValueAsString(InServiceType));
+	// AccessToken 정리 (리프레시 토큰은 키스토어에 그대로 유지되어 다음 실행 시 세션 복구에 사용)
+	if (DefaultIdentityContext.IsValid())
+	{
+		DefaultIdentityContext->ClearSession(InServiceType);
+	}
 }
 
-// ──────── Token Encryption ────────
+// ──────── Keystore Persistence ────────
+
+void UJWNU_GIS_ApiIdentityProvider::LoadKeystoreInBackground(FJWNU_KeystoreLoadResult& OutLoadResult, const TArray<TPair<FString, FString>>& InLegacyRecordFiles)
+{
+	// 기본 백엔드 생성 (포터블 백엔드는 솔트 파일을 읽거나 만들고 구버전 솔트를 이관한다)
+	const TSharedRef<IJWNU_TokenCipher, ESPMode::ThreadSafe> DefaultCipher = IJWNU_TokenCipher::CreateDefault();
+	OutLoadResult.Cipher = DefaultCipher;
+
+	// 키스토어 전체를 1회 복호화
+	EJWNU_TokenCipherId StoredCipherId = EJWNU_TokenCipherId::None;
+	FString LoadedFilePath;
+	const EJWNU_KeystoreLoadStatus LoadStatus = LoadKeystore(OutLoadResult.Records, StoredCipherId, LoadedFilePath);
+
+	// 다른 백엔드로 기록된 키스토어라면 현재 기본 백엔드로 다시 기록
+	OutLoadResult.bNeedsRewrite = LoadStatus == EJWNU_KeystoreLoadStatus::Loaded && StoredCipherId != DefaultCipher->GetCipherId();
+
+	// 기본 백엔드가 안전한 키를 만들지 못했다면 이관, 정리, 저장 모두 하지 않고 이번 세션의 저장을 막는다
+	if (DefaultCipher->CanEncrypt() == false)
+	{
+		PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Error, TEXT("Keystore cipher cannot encrypt safely on this machine. Refresh tokens will not be persisted this session."));
+		OutLoadResult.bWriteLocked = true;
+		return;
+	}
+
+	// 읽지 못한 키스토어를 덮어쓰면 그 안의 토큰이 영구히 사라지므로 보존한다
+	if (LoadStatus == EJWNU_KeystoreLoadStatus::Unsupported)
+	{
+		// 새 버전 빌드나 다른 플랫폼에서는 읽을 수 있는 파일이므로 그대로 두고 이번 세션의 저장을 막는다
+		PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Error, TEXT("Keystore %s cannot be read by this build. Keeping it untouched, refresh tokens will not be persisted this session."), *LoadedFilePath);
+		OutLoadResult.bWriteLocked = true;
+		return;
+	}
+	if (LoadStatus == EJWNU_KeystoreLoadStatus::Corrupt)
+	{
+		// 깨진 파일은 옆으로 옮겨 복구 여지를 남기고, 옮기지 못했다면 저장을 막는다
+		const FString BackupPath = FString::Printf(TEXT("%s.unreadable-%s"), *LoadedFilePath, *FDateTime::UtcNow().ToString());
+		if (IFileManager::Get().Move(*BackupPath, *LoadedFilePath, false, true))
+		{
+			PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Error, TEXT("Keystore %s is unreadable, moved aside to %s."), *LoadedFilePath, *BackupPath);
+		}
+		else
+		{
+			PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Error, TEXT("Keystore %s is unreadable and could not be moved aside. Refresh tokens will not be persisted this session."), *LoadedFilePath);
+			OutLoadResult.bWriteLocked = true;
+			return;
+		}
+	}
+
+	// 구버전 서비스별 파일 이관
+	TArray<FString> MigratedFilePaths;
+	MigrateLegacyRefreshTokenFiles(OutLoadResult.Records, InLegacyRecordFiles, MigratedFilePaths);
+	if (MigratedFilePaths.Num() > 0)
+	{
+		// 이관한 레코드를 키스토어에 먼저 기록한 뒤 구버전 파일 삭제 (중간에 중단되어도 토큰 유실 없음)
+		if (SaveKeystore(OutLoadResult.Records, *DefaultCipher))
+		{
+			for (const FString& MigratedFilePath : MigratedFilePaths)
+			{
+				IFileManager::Get().Delete(*MigratedFilePath, false, true, true);
+			}
+			PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Display, TEXT("Migrated %d legacy refresh token file(s) into keystore."), MigratedFilePaths.Num());
+			OutLoadResult.bNeedsRewrite = false;
+		}
+	}
+}
 
-bool UJWNU_GIS_ApiIdentityProvider::SaveRefreshTokenContainer(const EJWNU_ServiceType InServiceType, const FJWNU_RefreshTokenContainer& InRefreshTokenContainer)
+bool UJWNU_GIS_ApiIdentityProvider::EnqueueKeystoreWrite()
 {
-	// 컨테이너를 JSON 문자열로 직렬화
-	FString JsonString;
-	if (FJsonObjectConverter::UStructToJsonObjectString(InRefreshTokenContainer, JsonString) == false)
+	// 로드 반영 전의 메모리 사본은 일부 레코드만 담고 있으므로, 반영 직후로 저장을 미룬다
+	if (bKeystoreLoaded == false)
 	{
-		PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Failed to serialize refresh token container to JSON!"));
-		return false;
+		bKeystoreWriteDeferred = true;
+		return true;
 	}
 
-	// JSON 문자열 암호화
-	TArray<uint8> OutEncryptedData;
-	if (EncryptToken(JsonString, OutEncryptedData) == false)
+	// 읽을 수 없는 키스토어를 보존 중이거나 안전한 키가 없다면 기록하지 않는다 (메모리 사본만 유지)
+	if (bKeystoreWriteLocked)
 	{
-		PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Failed to encrypt token!"));
+		PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Error, TEXT("Keystore is write-locked for this session, refresh token kept in memory only!"));
 		return false;
 	}
 
-	// 서비스에 따른 파일 경로
-	const FString ServiceTypeString = UEnum::GetDisplayValueAsText(InServiceType).ToString();
-	const FString DirectoryPath = FPaths::ProjectSavedDir() + TEXT("Config/JWNetworkUtility/");
-	const FString Path = DirectoryPath + FString::Printf(TEXT("auth_%s.bin"), *ServiceTypeString);
-	
-	// 폴더가 존재하는지 확인하고 없으면 생성
-	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-	if (PlatformFile.DirectoryExists(*DirectoryPath) == false)
+	if (RefreshTokenWriteQueue.IsValid() == false || TokenCipher.IsValid() == false)
 	{
-		// CreateDirectoryTree는 하위 폴더까지 한 번에 생성한다.
-		if (PlatformFile.CreateDirectoryTree(*DirectoryPath))
+		PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Write queue is not initialized, saving synchronously..."));
+		return TokenCipher.IsValid() && SaveKeystore(KeystoreRecords, *TokenCipher);
+	}
+
+	const TSharedRef<FJWNU_RefreshTokenWriteQueue, ESPMode::ThreadSafe> WriteQueue = RefreshTokenWriteQueue.ToSharedRef();
+	FScopeLock ScopeLock(&WriteQueue->Lock);
+
+	// 미저장 스냅샷은 최신 스냅샷으로 덮어쓴다 (저장 병합)
+	WriteQueue->PendingSnapshot = KeystoreRecords;
+
+	// 직전 저장이 실패했다면 이번 스냅샷도 같은 이유로 실패할 가능성이 높으므로 호출자에게 알린다
+	const bool bLastWriteSucceeded = WriteQueue->bLastWriteFailed == false;
+
+	// 이미 저장 작업이 돌고 있다면 적재만으로 종료
+	if (WriteQueue->bWriterScheduled)
+	{
+		return bLastWriteSucceeded;
+	}
+
+	WriteQueue->bWriterScheduled = true;
+	WriteQueue->WriterTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [WriteQueue]()
+	{
+		DrainKeystoreWrites(WriteQueue);
+	});
+	return bLastWriteSucceeded;
+}
+
+void UJWNU_GIS_ApiIdentityProvider::DrainKeystoreWrites(const TSharedRef<FJWNU_RefreshTokenWriteQueue, ESPMode::ThreadSafe>& InWriteQueue)
+{
+	while (true)
+	{
+		// 대기 중인 스냅샷을 꺼내고, 비어있다면 작업 종료
+		TMap<FString, FJWNU_RefreshTokenContainer> Snapshot;
+		TSharedPtr<IJWNU_TokenCipher, ESPMode::ThreadSafe> Cipher;
 		{
-			PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Display, TEXT("Directory created: %s"), *DirectoryPath);
+			FScopeLock ScopeLock(&InWriteQueue->Lock);
+			if (InWriteQueue->PendingSnapshot.IsSet() == false)
+			{
+				InWriteQueue->bWriterScheduled = false;
+				return;
+			}
+			Snapshot = MoveTemp(InWriteQueue->PendingSnapshot.GetValue());
+			InWriteQueue->PendingSnapshot.Reset();
+			Cipher = InWriteQueue->Cipher;
 		}
-		else
+
+		// 락 밖에서 직렬화, 암호화, 파일 저장
+		const bool bSaved = Cipher.IsValid() && SaveKeystore(Snapshot, *Cipher);
 		{
-			PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Error, TEXT("Failed to create directory!"));
+			FScopeLock ScopeLock(&InWriteQueue->Lock);
+			InWriteQueue->bLastWriteFailed = bSaved == false;
 		}
 	}
+}
 
-	// 파일 저장
-	if (FFileHelper::SaveArrayToFile(OutEncryptedData, *Path) == false)
+const FString& UJWNU_GIS_ApiIdentityProvider::GetKeystoreRecordKey(const EJWNU_ServiceType InServiceType)
+{
+	// 열거형 이름을 최초 호출 시 1회만 조회 (함수 내 정적 변수)
+	static const TMap<EJWNU_ServiceType, FString> RecordKeys = []()
 	{
-		PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Failed to save encrypted file!"));
-		return false;
+		TMap<EJWNU_ServiceType, FString> Keys;
+		const UEnum* ServiceTypeEnum = StaticEnum<EJWNU_ServiceType>();
+		for (int32 Index = 0; Index < ServiceTypeEnum->NumEnums() - 1; Index++)
+		{
+			Keys.Add(static_cast<EJWNU_ServiceType>(ServiceTypeEnum->GetValueByIndex(Index)), ServiceTypeEnum->GetNameStringByIndex(Index));
+		}
+		return Keys;
+	}();
+
+	if (const FString* RecordKey = RecordKeys.Find(InServiceType))
+	{
+		return *RecordKey;
 	}
 
-	PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Display, TEXT("Refresh token container encrypted and saved successfully!"));
-	return true;
+	static const FString UnknownRecordKey = TEXT("Unknown");
+	return UnknownRecordKey;
 }
 
-bool UJWNU_GIS_ApiIdentityProvider::LoadRefreshTokenContainer(const EJWNU_ServiceType InServiceType, FJWNU_RefreshTokenContainer& OutRefreshTokenContainer)
+FString UJWNU_GIS_ApiIdentityProvider::GetKeystoreFilePath()
 {
-	// 서비스에 따른 파일 경로
-	const FString ServiceTypeString = UEnum::GetDisplayValueAsText(InServiceType).ToString();
-	const FString DirectoryPath = FPaths::ProjectSavedDir() + TEXT("Config/JWNetworkUtility/");
-	const FString FullPath = DirectoryPath + FString::Printf(TEXT("auth_%s.bin"), *ServiceTypeString);
-	
-	// 파일 로드
-	TArray<uint8> Result;
-	if (FFileHelper::LoadFileToArray(Result, *FullPath) == false)
-	{
-		PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Failed to load encrypted file!"));
+	return FPaths::ProjectSavedDir() + TEXT("Config/JWNetworkUtility/auth_keystore.bin");
+}
+
+bool UJWNU_GIS_ApiIdentityProvider::SaveKeystore(const TMap<FString, FJWNU_RefreshTokenContainer>& InRecords, const IJWNU_TokenCipher& InCipher)
+{
+	// 레코드 직렬화 : [Count][Key, RefreshToken, ExpiresAt] x Count
+	TArray<uint8> Payload;
+	FMemoryWriter PayloadWriter(Payload);
+	int32 RecordCount = InRecords.Num();
+	PayloadWriter << RecordCount;
+	for (const TPair<FString, FJWNU_RefreshTokenContainer>& Record : InRecords)
+	{
+		FString RecordKey = Record.Key;
+		FString RefreshToken = Record.Value.RefreshToken;
+		int64 ExpiresAt = Record.Value.ExpiresAt;
+		PayloadWriter << RecordKey << RefreshToken << ExpiresAt;
+	}
+
+	// 페이로드 전체를 1회 암호화
+	TArray<uint8> EncryptedPayload;
+	if (InCipher.Encrypt(Payload, EncryptedPayload) == false)
+	{
+		PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Failed to encrypt keystore!"));
 		return false;
 	}
 
-	// 복호화
-	FString JsonString;
-	if (DecryptToken(Result, JsonString) == false)
+	// 헤더 기록 : [Magic][Version][CipherId][Reserved][PayloadSize][EncryptedPayload]
+	TArray<uint8> FileData;
+	FMemoryWriter FileWriter(FileData);
+	uint32 Magic = JWNU_Keystore_Private::Magic;
+	uint16 Version = JWNU_Keystore_Private::Version;
+	uint8 CipherId = static_cast<uint8>(InCipher.GetCipherId());
+	uint8 Reserved = 0;
+	uint32 PayloadSize = EncryptedPayload.Num();
+	FileWriter << Magic << Version << CipherId << Reserved << PayloadSize;
+	FileWriter.Serialize(EncryptedPayload.GetData(), EncryptedPayload.Num());
+
+	const FString Path = GetKeystoreFilePath();
+	const FString TempPath = Path + TEXT(".tmp");
+	const FString DirectoryPath = FPaths::GetPath(Path);
+
+	// 폴더가 존재하는지 확인하고 없으면 생성
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (PlatformFile.DirectoryExists(*DirectoryPath) == false)
 	{
-		PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Failed to decrypt token!"));
+		// CreateDirectoryTree는 하위 폴더까지 한 번에 생성한다.
+		if (PlatformFile.CreateDirectoryTree(*DirectoryPath))
+		{
+			PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Display, TEXT("Directory created: %s"), *DirectoryPath);
+		}
+		else
+		{
+			PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Error, TEXT("Failed to create directory!"));
+		}
+	}
+
+	// 임시 파일에 먼저 저장
+	if (FFileHelper::SaveArrayToFile(FileData, *TempPath) == false)
+	{
+		PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Failed to save keystore file!"));
 		return false;
 	}
 
-	// JSON 문자열에서 컨테이너로 역직렬화
-	if (FJsonObjectConverter::JsonObjectStringToUStruct(JsonString, &OutRefreshTokenContainer, 0, 0) == false)
+	// 임시 파일을 최종 경로로 교체
+	if (IFileManager::Get().Move(*Path, *TempPath, true, true) == false)
 	{
-		PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Failed to deserialize refresh token container from JSON!"));
+		PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Failed to replace keystore file!"));
 		return false;
 	}
 
-	PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Display, TEXT("File loaded and refresh token container decrypted successfully!"));
+	PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Display, TEXT("Keystore encrypted and saved successfully! (%d records)"), RecordCount);
 	return true;
 }
 
-bool UJWNU_GIS_ApiIdentityProvider::EncryptToken(const FString& InToken, TArray<uint8>& OutEncryptedData)
+EJWNU_KeystoreLoadStatus UJWNU_GIS_ApiIdentityProvider::LoadKeystore(TMap<FString, FJWNU_RefreshTokenContainer>& OutRecords, EJWNU_TokenCipherId& OutCipherId, FString& OutFilePath)
 {
-#if PLATFORM_WINDOWS
-	// FString을 바이트 배열로 복사 (임시 객체 수명 문제 방지)
-	const TArray<uint8> TokenBytes = [&]()
-	{
-		const FTCHARToUTF8 Converter(*InToken);
-		TArray<uint8> Bytes;
-		Bytes.Append((const uint8*)Converter.Get(), Converter.Length());
-		return Bytes;
-	}();
+	const FString Path = GetKeystoreFilePath();
+	const FString TempPath = Path + TEXT(".tmp");
 
-	// 기기 ID를 솔트로 사용하기 위해 변환
-	const TArray<uint8> EntropyBytes = [&]()
+	// 교체 직전에 중단되어 최종 파일이 없다면 임시 파일로 복구
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	const bool bHasFile = PlatformFile.FileExists(*Path);
+	if (bHasFile == false && PlatformFile.FileExists(*TempPath) == false)
 	{
-		const FString DeviceID = FPlatformMisc::GetDeviceId() + TEXT("JWNetworkUtility");
-		const FTCHARToUTF8 EntropyConverter(*DeviceID);
-		TArray<uint8> Bytes;
-		Bytes.Append((const uint8*)EntropyConverter.Get(), EntropyConverter.Length());
-		return Bytes;
-	}();
+		PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Display, TEXT("No keystore found, starting with empty session."));
+		return EJWNU_KeystoreLoadStatus::NotFound;
+	}
+	OutFilePath = bHasFile ? Path : TempPath;
 
-	DATA_BLOB DataIn;
-	DataIn.pbData = (BYTE*)TokenBytes.GetData();
-	DataIn.cbData = TokenBytes.Num();
+	// 읽기 자체가 실패한 파일은 잠금이나 권한 문제일 수 있으므로 깨진 파일로 취급하지 않는다
+	TArray<uint8> FileData;
+	if (FFileHelper::LoadFileToArray(FileData, *OutFilePath) == false)
+	{
+		PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Failed to load keystore file!"));
+		return EJWNU_KeystoreLoadStatus::Unsupported;
+	}
 
-	DATA_BLOB DataEntropy;
-	DataEntropy.pbData = (BYTE*)EntropyBytes.GetData();
-	DataEntropy.cbData = EntropyBytes.Num();
+	// 헤더 검증
+	FMemoryReader FileReader(FileData);
+	uint32 Magic = 0;
+	uint16 Version = 0;
+	uint8 CipherId = 0;
+	uint8 Reserved = 0;
+	uint32 PayloadSize = 0;
+	FileReader << Magic << Version << CipherId << Reserved << PayloadSize;
+	if (FileReader.IsError() || Magic != JWNU_Keystore_Private::Magic)
+	{
+		PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Keystore header is invalid!"));
+		return EJWNU_KeystoreLoadStatus::Corrupt;
+	}
+	if (Version > JWNU_Keystore_Private::Version)
+	{
+		PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Keystore version %d is newer than supported version %d!"), Version, JWNU_Keystore_Private::Version);
+		return EJWNU_KeystoreLoadStatus::Unsupported;
+	}
+	if (PayloadSize > static_cast<uint32>(FileData.Num() - FileReader.Tell()))
+	{
+		PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Keystore payload is truncated!"));
+		return EJWNU_KeystoreLoadStatus::Corrupt;
+	}
+	OutCipherId = static_cast<EJWNU_TokenCipherId>(CipherId);
 
-	DATA_BLOB DataOut;
+	// 헤더에 기록된 백엔드로 1회 복호화 (예: 다른 플랫폼에서 가져온 DPAPI 파일은 여기서 걸러진다)
+	const TSharedPtr<IJWNU_TokenCipher, ESPMode::ThreadSafe> Cipher = IJWNU_TokenCipher::CreateById(OutCipherId);
+	if (Cipher.IsValid() == false)
+	{
+		return EJWNU_KeystoreLoadStatus::Unsupported;
+	}
 
-	// 윈도우 DPAPI 호출 (현재 로그인된 사용자 계정으로 암호화)
-	if (CryptProtectData(&DataIn, nullptr, &DataEntropy, nullptr, nullptr, 0, &DataOut))
+	TArray<uint8> EncryptedPayload;
+	EncryptedPayload.Append(FileData.GetData() + FileReader.Tell(), PayloadSize);
+	TArray<uint8> Payload;
+	if (Cipher->Decrypt(EncryptedPayload, Payload) == false)
 	{
-		OutEncryptedData.Empty();
-		OutEncryptedData.Append((uint8*)DataOut.pbData, DataOut.cbData);
+		PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Failed to decrypt keystore!"));
+		return EJWNU_KeystoreLoadStatus::Corrupt;
+	}
 
-		// 메모리 해제 필수
-		LocalFree(DataOut.pbData);
-		return true;
+	// 레코드 역직렬화
+	FMemoryReader PayloadReader(Payload);
+	int32 RecordCount = 0;
+	PayloadReader << RecordCount;
+	TMap<FString, FJWNU_RefreshTokenContainer> Records;
+	for (int32 Index = 0; Index < RecordCount && PayloadReader.IsError() == false; Index++)
+	{
+		FString RecordKey;
+		FJWNU_RefreshTokenContainer Container;
+		PayloadReader << RecordKey << Container.RefreshToken << Container.ExpiresAt;
+		Records.Add(MoveTemp(RecordKey), MoveTemp(Container));
 	}
-	return false;
-#else
-	PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Error, TEXT("Token encryption is only supported on Windows platform."));
-	return false;
-#endif
+	if (PayloadReader.IsError() || RecordCount < 0)
+	{
+		PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Failed to deserialize keystore records!"));
+		return EJWNU_KeystoreLoadStatus::Corrupt;
+	}
+
+	OutRecords = MoveTemp(Records);
+	PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Display, TEXT("Keystore loaded and decrypted successfully! (%d records)"), OutRecords.Num());
+	return EJWNU_KeystoreLoadStatus::Loaded;
 }
 
-bool UJWNU_GIS_ApiIdentityProvider::DecryptToken(const TArray<uint8>& InEncryptedData, FString& OutToken)
+void UJWNU_GIS_ApiIdentityProvider::MigrateLegacyRefreshTokenFiles(TMap<FString, FJWNU_RefreshTokenContainer>& InOutRecords, const TArray<TPair<FString, FString>>& InLegacyRecordFiles, TArray<FString>& OutMigratedFilePaths)
 {
-#if PLATFORM_WINDOWS
-	DATA_BLOB DataIn;
-	DataIn.pbData = (BYTE*)InEncryptedData.GetData();
-	DataIn.cbData = InEncryptedData.Num();
-
-	// 기기 ID를 솔트로 사용하기 위해 변환
-	const TArray<uint8> EntropyBytes = [&]()
-	{
-		const FString DeviceID = FPlatformMisc::GetDeviceId() + TEXT("JWNetworkUtility");
-		const FTCHARToUTF8 EntropyConverter(*DeviceID);
-		TArray<uint8> Bytes;
-		Bytes.Append((const uint8*)EntropyConverter.Get(), EntropyConverter.Length());
-		return Bytes;
-	}();
-
-	DATA_BLOB DataEntropy;
-	DataEntropy.pbData = (BYTE*)EntropyBytes.GetData();
-	DataEntropy.cbData = EntropyBytes.Num();
-
-	DATA_BLOB DataOut;
+	// 구버전 파일은 윈도우 DPAPI로만 기록되었으므로, 사용할 수 없는 플랫폼이라면 이관할 파일도 없다
+	const TSharedPtr<IJWNU_TokenCipher, ESPMode::ThreadSafe> LegacyCipher = IJWNU_TokenCipher::CreateById(EJWNU_TokenCipherId::WindowsDpapi);
+	if (LegacyCipher.IsValid() == false)
+	{
+		return;
+	}
 
-	// 윈도우 DPAPI 호출 (현재 로그인된 사용자 계정으로 복호화)
-	if (CryptUnprotectData(&DataIn, nullptr, &DataEntropy, nullptr, nullptr, 0, &DataOut))
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	const FString DirectoryPath = FPaths::GetPath(GetKeystoreFilePath());
+	for (const TPair<FString, FString>& LegacyRecordFile : InLegacyRecordFiles)
 	{
-		TArray<uint8> TempData;
-		TempData.Append((uint8*)DataOut.pbData, DataOut.cbData);
-		TempData.Add(0);
+		const FString LegacyPath = DirectoryPath / LegacyRecordFile.Value;
+		if (PlatformFile.FileExists(*LegacyPath) == false)
+		{
+			continue;
+		}
 
-		// 복호화된 데이터를 다시 FString으로 변환
-		OutToken = FString(UTF8_TO_TCHAR((char*)TempData.GetData()));
+		TArray<uint8> EncryptedData;
+		TArray<uint8> JsonBytes;
+		if (FFileHelper::LoadFileToArray(EncryptedData, *LegacyPath) == false || LegacyCipher->Decrypt(EncryptedData, JsonBytes) == false)
+		{
+			PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Failed to decrypt legacy refresh token file: %s"), *LegacyPath);
+			continue;
+		}
 
-		// 메모리 해제 필수
-		LocalFree(DataOut.pbData);
-		return true;
+		const FUTF8ToTCHAR JsonConverter(reinterpret_cast<const ANSICHAR*>(JsonBytes.GetData()), JsonBytes.Num());
+		const FString JsonString(JsonConverter.Length(), JsonConverter.Get());
+		FJWNU_RefreshTokenContainer LegacyContainer;
+		if (FJsonObjectConverter::JsonObjectStringToUStruct(JsonString, &LegacyContainer, 0, 0) == false)
+		{
+			PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Warning, TEXT("Failed to deserialize legacy refresh token file: %s"), *LegacyPath);
+			continue;
+		}
+
+		// 키스토어에 이미 있는 레코드가 더 최신이므로 덮어쓰지 않는다
+		if (InOutRecords.Contains(LegacyRecordFile.Key) == false)
+		{
+			InOutRecords.Add(LegacyRecordFile.Key, LegacyContainer);
+		}
+		OutMigratedFilePaths.Add(LegacyPath);
 	}
-	return false;
-#else
-	PRINT_LOG(LogJWNU_GIS_ApiIdentityProvider, Error, TEXT("Token decryption is only supported on Windows platform."));
-	return false;
-#endif
 }
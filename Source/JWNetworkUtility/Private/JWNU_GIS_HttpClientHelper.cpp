@@ -9,39 +9,47 @@
 
 DEFINE_LOG_CATEGORY(LogJWNU_GIS_HttpClientHelper);
 
+namespace JWNU_HttpClientHelper_Private
+{
+	/**
+	 * 300번대 이상의 상태 코드를 (커스텀 코드, 커스텀 메시지)로 매핑하는 표.
+	 * 게임 스레드 밖 Job의 콜백도 헬퍼 객체를 거치지 않고 읽을 수 있도록 불변 정적 표로 둔다.
+	 */
+	const TMap<int32, TPair<const TCHAR*, const TCHAR*>>& GetStatusCodeErrorFields()
+	{
+		static const TMap<int32, TPair<const TCHAR*, const TCHAR*>> Table = {
+			{ 400, { TEXT("BAD_REQUEST"), TEXT("Bad Request") } },
+			{ 401, { TEXT("UNAUTHORIZED"), TEXT("Unauthorized") } },
+			{ 402, { TEXT("PAYMENT_REQUIRED"), TEXT("Payment Required") } },
+			{ 403, { TEXT("FORBIDDEN"), TEXT("Forbidden") } },
+			{ 404, { TEXT("NOT_FOUND"), TEXT("Not Found") } },
+			{ 405, { TEXT("METHOD_NOT_ALLOWED"), TEXT("Method Not Allowed") } },
+			{ 406, { TEXT("NOT_ACCEPTABLE"), TEXT("Not Acceptable") } },
+			{ 407, { TEXT("PROXY_AUTH_REQUIRED"), TEXT("Proxy Authentication Required") } },
+			{ 408, { TEXT("REQUEST_TIMEOUT"), TEXT("Request Timeout") } },
+			{ 500, { TEXT("INTERNAL_SERVER_ERROR"), TEXT("Internal Server Error") } },
+			{ 501, { TEXT("NOT_IMPLEMENTED"), TEXT("Not Implemented") } },
+			{ 502, { TEXT("BAD_GATEWAY"), TEXT("Bad Gateway") } },
+			{ 503, { TEXT("SERVICE_UNAVAILABLE"), TEXT("Service Unavailable") } },
+			{ 504, { TEXT("GATEWAY_TIMEOUT"), TEXT("Gateway Timeout") } },
+		};
+		return Table;
+	}
+}
+
 void UJWNU_GIS_HttpClientHelper::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 	
-	StatusCodeToCustomCodeMap.Emplace(400, TEXT("BAD_REQUEST"));
-	StatusCodeToCustomCodeMap.Emplace(401, TEXT("UNAUTHORIZED"));
-	StatusCodeToCustomCodeMap.Emplace(402, TEXT("PAYMENT_REQUIRED"));
-	StatusCodeToCustomCodeMap.Emplace(403, TEXT("FORBIDDEN"));
-	StatusCodeToCustomCodeMap.Emplace(404, TEXT("NOT_FOUND"));
-	StatusCodeToCustomCodeMap.Emplace(405, TEXT("METHOD_NOT_ALLOWED"));
-	StatusCodeToCustomCodeMap.Emplace(406, TEXT("NOT_ACCEPTABLE"));
-	StatusCodeToCustomCodeMap.Emplace(407, TEXT("PROXY_AUTH_REQUIRED"));
-	StatusCodeToCustomCodeMap.Emplace(408, TEXT("REQUEST_TIMEOUT"));
-	StatusCodeToCustomCodeMap.Emplace(500, TEXT("INTERNAL_SERVER_ERROR"));
-	StatusCodeToCustomCodeMap.Emplace(501, TEXT("NOT_IMPLEMENTED"));
-	StatusCodeToCustomCodeMap.Emplace(502, TEXT("BAD_GATEWAY"));
-	StatusCodeToCustomCodeMap.Emplace(503, TEXT("SERVICE_UNAVAILABLE"));
-	StatusCodeToCustomCodeMap.Emplace(504, TEXT("GATEWAY_TIMEOUT"));
-	
-	StatusCodeToCustomMessageMap.Emplace(400, TEXT("Bad Request"));
-	StatusCodeToCustomMessageMap.Emplace(401, TEXT("Unauthorized"));
-	StatusCodeToCustomMessageMap.Emplace(402, TEXT("Payment Required"));
-	StatusCodeToCustomMessageMap.Emplace(403, TEXT("Forbidden"));
-	StatusCodeToCustomMessageMap.Emplace(404, TEXT("Not Found"));
-	StatusCodeToCustomMessageMap.Emplace(405, TEXT("Method Not Allowed"));
-	StatusCodeToCustomMessageMap.Emplace(406, TEXT("Not Acceptable"));
-	StatusCodeToCustomMessageMap.Emplace(407, TEXT("Proxy Authentication Required"));
-	StatusCodeToCustomMessageMap.Emplace(408, TEXT("Request Timeout"));
-	StatusCodeToCustomMessageMap.Emplace(500, TEXT("Internal Server Error"));
-	StatusCodeToCustomMessageMap.Emplace(501, TEXT("Not Implemented"));
-	StatusCodeToCustomMessageMap.Emplace(502, TEXT("Bad Gateway"));
-	StatusCodeToCustomMessageMap.Emplace(503, TEXT("Service Unavailable"));
-	StatusCodeToCustomMessageMap.Emplace(504, TEXT("Gateway Timeout"));
+	// 엔드포인트 정책 트라이 구축 (요청마다 정책 목록을 순회하지 않도록 한 번만)
+	TArray<FString> PathPrefixes;
+	PathPrefixes.Reserve(EndpointPolicies.Num());
+	for (const FJWNU_EndpointPolicy& Policy : EndpointPolicies)
+	{
+		PathPrefixes.Add(Policy.PathPrefix);
+	}
+	EndpointPolicyTrie.Build(PathPrefixes);
+	PRINT_LOG(LogJWNU_GIS_HttpClientHelper, Display, TEXT("%d endpoint policies loaded"), EndpointPolicies.Num());
 }
 
 UJWNU_GIS_HttpClientHelper* UJWNU_GIS_HttpClientHelper::Get(const UObject* WorldContextObject)
@@ -73,12 +81,77 @@ UJWNU_GIS_HttpClientHelper* UJWNU_GIS_HttpClientHelper::Get(const UObject* World
 	return GameInstance->GetSubsystem<UJWNU_GIS_HttpClientHelper>();
 }
 
+FJWNU_RequestDescriptorRef UJWNU_GIS_HttpClientHelper::MakeRequestDescriptor(
+	const UObject* WorldContextObject,
+	const EJWNU_HttpMethod InMethod,
+	const EJWNU_ServiceType InServiceType,
+	FString InURL,
+	FJWNU_RequestBody InContentBody,
+	const TMap<FString, FString>& InQueryParams,
+	const FJWNU_EndpointInfo* InEndpoint,
+	const FJWNU_RequestConfig* InConfigOverride)
+{
+	// 설정 우선순위: 호출 단위 설정 > 엔드포인트 선언 정책 > 경로 접두사 정책 > 기본 설정
+	FJWNU_RequestConfig Config;
+	if (InConfigOverride)
+	{
+		Config = *InConfigOverride;
+	}
+	else
+	{
+		const UJWNU_GIS_HttpClientHelper* Self = Get(WorldContextObject);
+		Config = Self ? Self->ResolveRequestConfig(InURL) : FJWNU_RequestConfig();
+		if (InEndpoint)
+		{
+			InEndpoint->ApplyPolicy(Config);
+		}
+	}
+
+	// 서비스 계층의 401 리프레시 흐름과 응답 썽크는 게임 스레드 전용이므로 응답 처리 스레드를 고정
+	PinGameThreadCompletion(Config, InURL);
+	return FJWNU_RequestDescriptor::Create(InMethod, InServiceType, MoveTemp(InURL), MoveTemp(InContentBody), InQueryParams, Config, InEndpoint ? InEndpoint->GetId() : 0);
+}
+
+void UJWNU_GIS_HttpClientHelper::PinGameThreadCompletion(FJWNU_RequestConfig& InOutConfig, const FString& InURL)
+{
+	if (InOutConfig.CompletionThread != EJWNU_CompletionThread::GameThread)
+	{
+		PRINT_LOG(LogJWNU_GIS_HttpClientHelper, Warning, TEXT("Completion thread is only honoured for prebuilt native descriptors, completing on the game thread. (%s)"), *InURL);
+		InOutConfig.CompletionThread = EJWNU_CompletionThread::GameThread;
+	}
+}
+
+const FJWNU_RequestConfig& UJWNU_GIS_HttpClientHelper::ResolveRequestConfig(const FStringView InURL) const
+{
+	if (EndpointPolicyTrie.IsEmpty())
+	{
+		return DefaultRequestConfig;
+	}
+
+	// 스킴과 호스트를 건너뛰고 경로만 조회 ("127.0.0.1:5000/health" → "/health")
+	FStringView Path = InURL;
+	const int32 SchemeEnd = Path.Find(TEXT("://"));
+	if (SchemeEnd != INDEX_NONE)
+	{
+		Path.RightChopInline(SchemeEnd + 3);
+	}
+	int32 PathStart = INDEX_NONE;
+	if (Path.FindChar(TEXT('/'), PathStart) == false)
+	{
+		return DefaultRequestConfig;
+	}
+	Path.RightChopInline(PathStart);
+
+	const int32 PolicyIndex = EndpointPolicyTrie.FindLongestPrefix(Path);
+	return PolicyIndex == INDEX_NONE ? DefaultRequestConfig : EndpointPolicies[PolicyIndex].Config;
+}
+
 UJWNU_HttpRequestJob* UJWNU_GIS_HttpClientHelper::SendRequest_RawResponse(
 	const UObject* WorldContextObject,
 	const EJWNU_HttpMethod InMethod,
-	const FString& InURL,
+	FString InURL,
 	const FString& InAuthToken,
-	const FString& InContentBody,
+	FJWNU_RequestBody InContentBody,
 	const TMap<FString, FString>& InQueryParams,
 	const FOnHttpRequestCompletedDelegate& InOnHttpResponse,
 	const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry)
@@ -90,19 +163,24 @@ UJWNU_HttpRequestJob* UJWNU_GIS_HttpClientHelper::SendRequest_RawResponse(
 		return nullptr;
 	}
 
-	// 실제 처리
-	return Self->SendRequest_RawResponse(InMethod, InURL, InAuthToken, InContentBody, InQueryParams, InOnHttpResponse, InOnHttpRequestJobRetry);
+	// 기술자 구축 후 실제 처리 (Raw 호출은 토큰 리프레시 대상이 아니므로 서비스 타입은 의미 없음)
+	// URL 호출은 블루프린트와 UObject 콜백이 쓰므로 경로 정책과 무관하게 게임 스레드에서 완료시킨다
+	FJWNU_RequestConfig Config = Self->ResolveRequestConfig(InURL);
+	PinGameThreadCompletion(Config, InURL);
+	const FJWNU_RequestDescriptorRef Request = FJWNU_RequestDescriptor::Create(InMethod, EJWNU_ServiceType::GameServer, MoveTemp(InURL), MoveTemp(InContentBody), InQueryParams, Config);
+	return Self->SendRequest_RawResponse(Request, InAuthToken, InOnHttpResponse, InOnHttpRequestJobRetry);
 }
 
 UJWNU_HttpRequestJob* UJWNU_GIS_HttpClientHelper::SendRequest_CustomResponse(
 	const UObject* WorldContextObject,
 	const EJWNU_HttpMethod InMethod,
-	const FString& InURL,
+	FString InURL,
 	const FString& InAuthToken,
-	const FString& InContentBody,
+	FJWNU_RequestBody InContentBody,
 	const TMap<FString, FString>& InQueryParams,
 	const FOnHttpRequestCompletedDelegate& InOnHttpResponse,
-	const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry)
+	const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry,
+	const FOnHttpRequestFailedDelegate& InOnHttpRequestFailed)
 {
 	// 객체 획득
 	UJWNU_GIS_HttpClientHelper* Self = Get(WorldContextObject);
@@ -111,15 +189,110 @@ UJWNU_HttpRequestJob* UJWNU_GIS_HttpClientHelper::SendRequest_CustomResponse(
 		return nullptr;
 	}
 
-	return Self->SendRequest_CustomResponse(InMethod, InURL, InAuthToken, InContentBody, InQueryParams, InOnHttpResponse, InOnHttpRequestJobRetry);
+	FJWNU_RequestConfig Config = Self->ResolveRequestConfig(InURL);
+	PinGameThreadCompletion(Config, InURL);
+	const FJWNU_RequestDescriptorRef Request = FJWNU_RequestDescriptor::Create(InMethod, EJWNU_ServiceType::GameServer, MoveTemp(InURL), MoveTemp(InContentBody), InQueryParams, Config);
+	return Self->SendRequest_CustomResponse(Request, InAuthToken, InOnHttpResponse, InOnHttpRequestJobRetry, InOnHttpRequestFailed);
 }
 
-UJWNU_HttpRequestJob* UJWNU_GIS_HttpClientHelper::SendRequest_RawResponse(
+UJWNU_HttpRequestJob* UJWNU_GIS_HttpClientHelper::SendRequest_StreamResponse(
+	const UObject* WorldContextObject,
 	const EJWNU_HttpMethod InMethod,
-	const FString& InURL,
+	FString InURL,
 	const FString& InAuthToken,
-	const FString& InContentBody,
+	FJWNU_RequestBody InContentBody,
 	const TMap<FString, FString>& InQueryParams,
+	const FOnHttpResponseStreamDelegate& InOnHttpResponseStream,
+	const FOnHttpRequestCompletedDelegate& InOnHttpResponse,
+	const FOnHttpRequestFailedDelegate& InOnHttpRequestFailed)
+{
+	// 객체 획득
+	UJWNU_GIS_HttpClientHelper* Self = Get(WorldContextObject);
+	if (Self == nullptr)
+	{
+		return nullptr;
+	}
+
+	FJWNU_RequestConfig Config = Self->ResolveRequestConfig(InURL);
+	PinGameThreadCompletion(Config, InURL);
+	const FJWNU_RequestDescriptorRef Request = FJWNU_RequestDescriptor::Create(InMethod, EJWNU_ServiceType::GameServer, MoveTemp(InURL), MoveTemp(InContentBody), InQueryParams, Config);
+	return Self->SendRequest_StreamResponse(Request, InAuthToken, InOnHttpResponseStream, InOnHttpResponse, InOnHttpRequestFailed);
+}
+
+UJWNU_HttpRequestJob* UJWNU_GIS_HttpClientHelper::SendRequest_RawResponse(
+	const UObject* WorldContextObject,
+	const FJWNU_RequestDescriptorRef& InRequest,
+	const FString& InAuthToken,
+	const FOnHttpRequestCompletedDelegate& InOnHttpResponse,
+	const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry)
+{
+	// 객체 획득
+	UJWNU_GIS_HttpClientHelper* Self = Get(WorldContextObject);
+	if (Self == nullptr)
+	{
+		return nullptr;
+	}
+
+	return Self->SendRequest_RawResponse(InRequest, InAuthToken, InOnHttpResponse, InOnHttpRequestJobRetry);
+}
+
+UJWNU_HttpRequestJob* UJWNU_GIS_HttpClientHelper::SendRequest_CustomResponse(
+	const UObject* WorldContextObject,
+	const FJWNU_RequestDescriptorRef& InRequest,
+	const FString& InAuthToken,
+	const FOnHttpRequestCompletedDelegate& InOnHttpResponse,
+	const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry,
+	const FOnHttpRequestFailedDelegate& InOnHttpRequestFailed)
+{
+	// 객체 획득
+	UJWNU_GIS_HttpClientHelper* Self = Get(WorldContextObject);
+	if (Self == nullptr)
+	{
+		return nullptr;
+	}
+
+	return Self->SendRequest_CustomResponse(InRequest, InAuthToken, InOnHttpResponse, InOnHttpRequestJobRetry, InOnHttpRequestFailed);
+}
+
+UJWNU_HttpRequestJob* UJWNU_GIS_HttpClientHelper::SendRequest_Utf8Response(
+	const UObject* WorldContextObject,
+	const FJWNU_RequestDescriptorRef& InRequest,
+	const FString& InAuthToken,
+	const FOnHttpRequestCompletedUtf8Delegate& InOnHttpResponse,
+	const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry,
+	const FOnHttpRequestFailedDelegate& InOnHttpRequestFailed)
+{
+	// 객체 획득
+	UJWNU_GIS_HttpClientHelper* Self = Get(WorldContextObject);
+	if (Self == nullptr)
+	{
+		return nullptr;
+	}
+
+	return Self->SendRequest_Utf8Response(InRequest, InAuthToken, InOnHttpResponse, InOnHttpRequestJobRetry, InOnHttpRequestFailed);
+}
+
+UJWNU_HttpRequestJob* UJWNU_GIS_HttpClientHelper::SendRequest_StreamResponse(
+	const UObject* WorldContextObject,
+	const FJWNU_RequestDescriptorRef& InRequest,
+	const FString& InAuthToken,
+	const FOnHttpResponseStreamDelegate& InOnHttpResponseStream,
+	const FOnHttpRequestCompletedDelegate& InOnHttpResponse,
+	const FOnHttpRequestFailedDelegate& InOnHttpRequestFailed)
+{
+	// 객체 획득
+	UJWNU_GIS_HttpClientHelper* Self = Get(WorldContextObject);
+	if (Self == nullptr)
+	{
+		return nullptr;
+	}
+
+	return Self->SendRequest_StreamResponse(InRequest, InAuthToken, InOnHttpResponseStream, InOnHttpResponse, InOnHttpRequestFailed);
+}
+
+UJWNU_HttpRequestJob* UJWNU_GIS_HttpClientHelper::SendRequest_RawResponse(
+	const FJWNU_RequestDescriptorRef& InRequest,
+	const FString& InAuthToken,
 	const FOnHttpRequestCompletedDelegate& InOnHttpResponse,
 	const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry)
 {
@@ -131,28 +304,27 @@ UJWNU_HttpRequestJob* UJWNU_GIS_HttpClientHelper::SendRequest_RawResponse(
 	}
 
 	// 콜백에서 리스폰스를 외부 델리게이트에 전달하게 된다
+	// 게임 스레드 밖 Job이라면 응답 처리 스레드에서 호출되므로, 헬퍼 객체에 묶지 않는다
 	FOnHttpRequestJobCompletedDelegate Callback;
-	Callback.BindWeakLambda(this, [this, InOnHttpResponse](const bool bNetworkAvailable, const int32 StatusCode, const FString& ResponseBody)
+	Callback.BindLambda([InOnHttpResponse](const bool bNetworkAvailable, const int32 StatusCode, const FString& ResponseBody)
 		{
 			const FString Result = (bNetworkAvailable ? TEXT("Success") : TEXT("Fail"));
 			PRINT_LOG(LogJWNU_GIS_HttpClientHelper, Display, TEXT("%d, %s"), StatusCode, *Result);
 			InOnHttpResponse.ExecuteIfBound(StatusCode, ResponseBody);
 		});
 
-	// 콜백과 패러미터를 잡 프로세서에 넘긴다
-	return Subsystem->ProcessHttpRequestJob(InMethod, InURL, InAuthToken, InContentBody, InQueryParams, DefaultRequestConfig, Callback, InOnHttpRequestJobRetry);
+	// 콜백과 기술자를 잡 프로세서에 넘긴다
+	return Subsystem->ProcessHttpRequestJob(InRequest, InAuthToken, Callback, InOnHttpRequestJobRetry);
 }
 
 UJWNU_HttpRequestJob* UJWNU_GIS_HttpClientHelper::SendRequest_CustomResponse(
-	const EJWNU_HttpMethod InMethod,
-	const FString& InURL,
+	const FJWNU_RequestDescriptorRef& InRequest,
 	const FString& InAuthToken,
-	const FString& InContentBody,
-	const TMap<FString, FString>& InQueryParams,
 	const FOnHttpRequestCompletedDelegate& InOnHttpResponse,
-	const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry)
+	const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry,
+	const FOnHttpRequestFailedDelegate& InOnHttpRequestFailed)
 {
-		// 서브시스템 획득
+	// 서브시스템 획득
 	UJWNU_GIS_HttpRequestJobProcessor* Subsystem = GetGameInstance()->GetSubsystem<UJWNU_GIS_HttpRequestJobProcessor>();
 	if (Subsystem == nullptr)
 	{
@@ -160,54 +332,141 @@ UJWNU_HttpRequestJob* UJWNU_GIS_HttpClientHelper::SendRequest_CustomResponse(
 	}
 
 	// 콜백에서 리스폰스를 전처리해서 외부 델리게이트에 전달하게 된다
+	const FOnHttpRequestJobCompletedDelegate Callback = MakeCustomResponseCallback(InOnHttpResponse);
+	
+	// 콜백과 기술자를 잡 프로세서에 넘긴다
+	return Subsystem->ProcessHttpRequestJob(InRequest, InAuthToken, Callback, InOnHttpRequestJobRetry, FOnHttpResponseStreamDelegate(), MakeFailureCallback(InOnHttpRequestFailed));
+}
+
+UJWNU_HttpRequestJob* UJWNU_GIS_HttpClientHelper::SendRequest_Utf8Response(
+	const FJWNU_RequestDescriptorRef& InRequest,
+	const FString& InAuthToken,
+	const FOnHttpRequestCompletedUtf8Delegate& InOnHttpResponse,
+	const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry,
+	const FOnHttpRequestFailedDelegate& InOnHttpRequestFailed)
+{
+	// 서브시스템 획득
+	UJWNU_GIS_HttpRequestJobProcessor* Subsystem = GetGameInstance()->GetSubsystem<UJWNU_GIS_HttpRequestJobProcessor>();
+	if (Subsystem == nullptr)
+	{
+		return nullptr;
+	}
+
+	// 콜백에서 리스폰스를 전처리해서 UTF-8 바이트 그대로 외부 델리게이트에 전달하게 된다 (문자열 완료 콜백은 비워둔다)
+	const FOnHttpRequestJobCompletedUtf8Delegate Callback = MakeUtf8ResponseCallback(InOnHttpResponse);
+
+	// 콜백과 기술자를 잡 프로세서에 넘긴다
+	return Subsystem->ProcessHttpRequestJob(InRequest, InAuthToken, FOnHttpRequestJobCompletedDelegate(), InOnHttpRequestJobRetry, FOnHttpResponseStreamDelegate(), MakeFailureCallback(InOnHttpRequestFailed), Callback);
+}
+
+UJWNU_HttpRequestJob* UJWNU_GIS_HttpClientHelper::SendRequest_StreamResponse(
+	const FJWNU_RequestDescriptorRef& InRequest,
+	const FString& InAuthToken,
+	const FOnHttpResponseStreamDelegate& InOnHttpResponseStream,
+	const FOnHttpRequestCompletedDelegate& InOnHttpResponse,
+	const FOnHttpRequestFailedDelegate& InOnHttpRequestFailed)
+{
+	// 서브시스템 획득
+	UJWNU_GIS_HttpRequestJobProcessor* Subsystem = GetGameInstance()->GetSubsystem<UJWNU_GIS_HttpRequestJobProcessor>();
+	if (Subsystem == nullptr)
+	{
+		return nullptr;
+	}
+
+	// 2XX라면 바디는 이미 스트림으로 전달되어 비어 있고, 그 외에는 CustomResponse와 동일하게 실패 콜백 또는 가짜 JSON 리스폰스 바디가 전달된다
+	// (이미 전달한 원소는 되돌릴 수 없으므로, 스트림이 바인딩된 Job은 스스로 재시도를 끈다)
+	const FOnHttpRequestJobCompletedDelegate Callback = MakeCustomResponseCallback(InOnHttpResponse);
+	
+	// 콜백과 기술자를 잡 프로세서에 넘긴다
+	return Subsystem->ProcessHttpRequestJob(InRequest, InAuthToken, Callback, FOnHttpRequestJobRetryDelegate(), InOnHttpResponseStream, MakeFailureCallback(InOnHttpRequestFailed));
+}
+
+FOnHttpRequestJobCompletedDelegate UJWNU_GIS_HttpClientHelper::MakeCustomResponseCallback(const FOnHttpRequestCompletedDelegate& InOnHttpResponse)
+{
 	FOnHttpRequestJobCompletedDelegate Callback;
-	Callback.BindWeakLambda(this, [this, InOnHttpResponse](const bool bNetworkAvailable, const int32 StatusCode, const FString& ResponseBody)
+	Callback.BindLambda([InOnHttpResponse](const bool bNetworkAvailable, const int32 StatusCode, const FString& ResponseBody)
 	{
 		const FString Result = (bNetworkAvailable ? TEXT("Success") : TEXT("Fail"));
 		PRINT_LOG(LogJWNU_GIS_HttpClientHelper, Display, TEXT("%d, %s"), StatusCode, *Result);
-	
-		// 1. 네트워크 연결 실패 시
-		if (bNetworkAvailable == false)
-		{
-			// { success = false, code = FinalCode, message = FinalMessage } 구조의 가짜 JSON 리스폰스 바디 생성
-			const FString FakeResponseBody = TEXT("{\"success\": false, \"code\": \"NETWORK_ERROR\", \"message\": \"Failed to Send HTTP Request\"}");
-			InOnHttpResponse.ExecuteIfBound(StatusCode, FakeResponseBody);
-			return;
-		}
-				
-		// 2. HTTP 상태 코드에 따른 분기
-		if (StatusCode >= 200 && StatusCode < 300)
+
+		// 서버 로직에 도달했을 경우 진짜 JSON 리스폰스 바디를 콜백으로 전달
+		if (bNetworkAvailable && StatusCode >= 200 && StatusCode < 300)
 		{
-			// 서버 로직에 도달했을 경우 진짜 JSON 리스폰스 바디를 콜백으로 전달
 			InOnHttpResponse.ExecuteIfBound(StatusCode, ResponseBody);
+			return;
 		}
-		else
+
+		// 실패 콜백을 바인딩하지 않은 호출자를 위해 { success = false, code, message } 구조의 가짜 JSON 리스폰스 바디 생성
+		FJWNU_ApiError Error;
+		Error.StatusCode = StatusCode;
+		Error.TransportReason = bNetworkAvailable ? EJWNU_TransportReason::None : EJWNU_TransportReason::ConnectionFailed;
+		FillErrorFields(Error);
+		InOnHttpResponse.ExecuteIfBound(StatusCode, Error.ToResponseBody());
+	});
+	
+	return Callback;
+}
+
+FOnHttpRequestJobCompletedUtf8Delegate UJWNU_GIS_HttpClientHelper::MakeUtf8ResponseCallback(const FOnHttpRequestCompletedUtf8Delegate& InOnHttpResponse)
+{
+	FOnHttpRequestJobCompletedUtf8Delegate Callback;
+	Callback.BindLambda([InOnHttpResponse](const bool bNetworkAvailable, const int32 StatusCode, TArray<uint8>&& ResponseBytes)
+	{
+		const FString Result = (bNetworkAvailable ? TEXT("Success") : TEXT("Fail"));
+		PRINT_LOG(LogJWNU_GIS_HttpClientHelper, Display, TEXT("%d, %s"), StatusCode, *Result);
+
+		// 서버 로직에 도달했을 경우 진짜 JSON 리스폰스 바이트를 콜백으로 전달
+		if (bNetworkAvailable && StatusCode >= 200 && StatusCode < 300)
 		{
-			// 커스텀 코드 획득
-			FString FakeCustomCode = TEXT("UNKNOWN_ERROR");
-			if (const FString* FoundCode = StatusCodeToCustomCodeMap.Find(StatusCode))
-			{
-				FakeCustomCode = *FoundCode;
-			}
-					
-			// 커스텀 메시지 획득
-			FString FakeCustomMessage = TEXT("Unknown Error");
-			if (const FString* FoundMessage = StatusCodeToCustomMessageMap.Find(StatusCode))
-			{
-				FakeCustomMessage = *FoundMessage;
-			}
-					
-			// { success = false, code = FinalCode, message = FinalMessage } 구조의 가짜 JSON 리스폰스 바디 생성
-			const FString FakeResponseBody = FString::Printf(
-			TEXT("{\"success\": false, \"code\": \"%s\", \"message\": \"%s\"}"), 
-				*FakeCustomCode, 
-				*FakeCustomMessage);
-				
-			// 상태 코드에 따른 가짜 JSON 리스폰스 바디를 콜백으로 전달
-			InOnHttpResponse.ExecuteIfBound(StatusCode, FakeResponseBody);
+			InOnHttpResponse.ExecuteIfBound(StatusCode, MoveTemp(ResponseBytes));
+			return;
 		}
+
+		// 실패 콜백을 바인딩하지 않은 호출자를 위해 가짜 JSON 리스폰스 바디를 UTF-8로 변환해서 전달
+		FJWNU_ApiError Error;
+		Error.StatusCode = StatusCode;
+		Error.TransportReason = bNetworkAvailable ? EJWNU_TransportReason::None : EJWNU_TransportReason::ConnectionFailed;
+		FillErrorFields(Error);
+		const FTCHARToUTF8 ErrorBody(*Error.ToResponseBody());
+		InOnHttpResponse.ExecuteIfBound(StatusCode, TArray<uint8>(reinterpret_cast<const uint8*>(ErrorBody.Get()), ErrorBody.Length()));
 	});
-	
-	// 콜백과 패러미터를 잡 프로세서에 넘긴다
-	return Subsystem->ProcessHttpRequestJob(InMethod, InURL, InAuthToken, InContentBody, InQueryParams, DefaultRequestConfig, Callback, InOnHttpRequestJobRetry);
+
+	return Callback;
+}
+
+FOnHttpRequestJobFailedDelegate UJWNU_GIS_HttpClientHelper::MakeFailureCallback(const FOnHttpRequestFailedDelegate& InOnHttpRequestFailed)
+{
+	FOnHttpRequestJobFailedDelegate Callback;
+	if (InOnHttpRequestFailed.IsBound() == false)
+	{
+		return Callback;
+	}
+
+	Callback.BindLambda([InOnHttpRequestFailed](const FJWNU_ApiError& InError)
+	{
+		PRINT_LOG(LogJWNU_GIS_HttpClientHelper, Display, TEXT("%d, Fail (attempts: %d)"), InError.StatusCode, InError.AttemptCount);
+
+		// 상태 코드와 전송 원인만 채워진 에러에 커스텀 코드와 메시지를 더해 그대로 전달
+		FJWNU_ApiError Error = InError;
+		FillErrorFields(Error);
+		InOnHttpRequestFailed.ExecuteIfBound(Error);
+	});
+
+	return Callback;
+}
+
+void UJWNU_GIS_HttpClientHelper::FillErrorFields(FJWNU_ApiError& InOutError)
+{
+	// 1. 네트워크 연결 실패 또는 타임아웃
+	if (InOutError.TransportReason == EJWNU_TransportReason::ConnectionFailed || InOutError.TransportReason == EJWNU_TransportReason::Timeout)
+	{
+		InOutError.Code = TEXT("NETWORK_ERROR");
+		InOutError.Message = TEXT("Failed to Send HTTP Request");
+		return;
+	}
+
+	// 2. HTTP 상태 코드에 따른 커스텀 코드와 메시지
+	const TPair<const TCHAR*, const TCHAR*>* Found = JWNU_HttpClientHelper_Private::GetStatusCodeErrorFields().Find(InOutError.StatusCode);
+	InOutError.Code = Found ? Found->Key : TEXT("UNKNOWN_ERROR");
+	InOutError.Message = Found ? Found->Value : TEXT("Unknown Error");
 }
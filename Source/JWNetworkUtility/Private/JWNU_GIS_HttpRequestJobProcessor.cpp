@@ -4,72 +4,295 @@
 #include "UObject/Object.h"
 #include "JWNetworkUtility.h"
 #include "JWNU_HttpRequestJob.h"
-#include "GenericPlatform/GenericPlatformHttp.h"
+#include "Async/Async.h"
 
 DEFINE_LOG_CATEGORY(LogJWNU_GIS_HttpRequestJobProcessor);
 
+// ──────── FJWNU_RequestSubmissionQueue ────────
+
+FJWNU_RequestSubmissionQueue::~FJWNU_RequestSubmissionQueue()
+{
+	// 마지막 참조가 사라지는 시점에는 다른 소비자가 없으므로 남은 항목을 여기서 중단 처리
+	FSubmission Submission;
+	while (Submissions.Dequeue(Submission))
+	{
+		Submission.Abort();
+	}
+}
+
+void FJWNU_RequestSubmissionQueue::Submit(FSubmitFunction&& InExecute, FSubmitFunction&& InAbort)
+{
+	PendingCount.fetch_add(1, std::memory_order_relaxed);
+	Submissions.Enqueue(FSubmission{ MoveTemp(InExecute), MoveTemp(InAbort) });
+
+	// 닫힌 뒤에 적재된 항목도 드레인 틱에서 중단 함수로 정리되므로, 여기서는 예약만 한다
+	if (bDrainScheduled.exchange(true, std::memory_order_acq_rel) == false)
+	{
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateThreadSafeSP(this, &FJWNU_RequestSubmissionQueue::Drain));
+	}
+}
+
+void FJWNU_RequestSubmissionQueue::Close()
+{
+	check(IsInGameThread());
+	bClosed.store(true, std::memory_order_release);
+	Drain(0.0f);
+}
+
+bool FJWNU_RequestSubmissionQueue::Drain(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FJWNU_RequestSubmissionQueue::Drain);
+
+	// 꺼내기 전에 예약 플래그를 내려, 드레인 도중 적재된 항목은 다음 틱에서 처리되도록 한다
+	bDrainScheduled.store(false, std::memory_order_release);
+
+	int32 ExecutedCount = 0;
+	int32 AbortedCount = 0;
+	FSubmission Submission;
+	while (Submissions.Dequeue(Submission))
+	{
+		PendingCount.fetch_sub(1, std::memory_order_relaxed);
+		if (IsClosed())
+		{
+			++AbortedCount;
+			Submission.Abort();
+		}
+		else
+		{
+			++ExecutedCount;
+			Submission.Execute();
+		}
+	}
+
+	if (AbortedCount > 0)
+	{
+		PRINT_LOG(LogJWNU_GIS_HttpRequestJobProcessor, Warning, TEXT("Aborted %d submitted requests because the submission queue is closed"), AbortedCount);
+	}
+	PRINT_LOG(LogJWNU_GIS_HttpRequestJobProcessor, Verbose, TEXT("Drained %d submitted requests"), ExecutedCount);
+	return false;
+}
+
+// ──────── UJWNU_GIS_HttpRequestJobProcessor ────────
+
+void UJWNU_GIS_HttpRequestJobProcessor::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	SubmissionQueue = MakeShared<FJWNU_RequestSubmissionQueue, ESPMode::ThreadSafe>();
+	RequestTable = MakeShared<FJWNU_RequestHandleTable, ESPMode::ThreadSafe>();
+}
+
+void UJWNU_GIS_HttpRequestJobProcessor::Deinitialize()
+{
+	// 워커 스레드가 제출 큐를 계속 들고 있더라도 이후 제출은 모두 중단 처리된다
+	if (SubmissionQueue.IsValid())
+	{
+		SubmissionQueue->Close();
+		SubmissionQueue.Reset();
+	}
+
+	// 남은 요청을 취소하고 테이블을 놓아, 호출자가 들고 있는 핸들은 이후 모두 무효가 된다
+	if (RequestTable.IsValid())
+	{
+		RequestTable->CancelAll();
+		RequestTable.Reset();
+	}
+
+	// 핸들 없이 보낸 Job도 취소해 두어 이후 도착하는 응답이 무시되도록 한다 (취소가 집합을 수정하므로 복사본으로 순회)
+	for (UJWNU_HttpRequestJob* Job : InFlightJobs.Array())
+	{
+		Job->Cancel();
+	}
+
+	// 취소된 요청의 완료 콜백을 아직 기다리는 게임 스레드 밖 Job은 그 콜백이 참조를 놓을 때까지 GC되지 않도록 루트로 유지
+	for (UJWNU_HttpRequestJob* Job : InFlightJobs)
+	{
+		Job->AddToRoot();
+	}
+	InFlightJobs.Empty();
+
+	if (CompletionTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(CompletionTickerHandle);
+		CompletionTickerHandle.Reset();
+	}
+
+	const int32 DroppedCount = CriticalCompletionQueue.Num() + NormalCompletionQueue.Num();
+	if (DroppedCount > 0)
+	{
+		PRINT_LOG(LogJWNU_GIS_HttpRequestJobProcessor, Warning, TEXT("Dropping %d queued job completions on shutdown"), DroppedCount);
+	}
+	CriticalCompletionQueue.Empty();
+	NormalCompletionQueue.Empty();
+
+	Super::Deinitialize();
+}
+
 UJWNU_HttpRequestJob* UJWNU_GIS_HttpRequestJobProcessor::ProcessHttpRequestJob(
-	const EJWNU_HttpMethod InMethod,
-	const FString& InURL,
+	const FJWNU_RequestDescriptorRef& InRequest,
 	const FString& InAuthToken,
-	const FString& InContentBody,
-	const TMap<FString, FString>& InQueryParams,
-	const FJWNU_RequestConfig& InConfig,
 	const FOnHttpRequestJobCompletedDelegate& InOnHttpRequestJobCompleted,
-	const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry)
+	const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry,
+	const FOnHttpResponseStreamDelegate& InOnHttpResponseStream,
+	const FOnHttpRequestJobFailedDelegate& InOnHttpRequestJobFailed,
+	const FOnHttpRequestJobCompletedUtf8Delegate& InOnHttpRequestJobCompletedUtf8)
 {
 	// 리퀘스트 잡 생성
 	UJWNU_HttpRequestJob* RequestJob = NewObject<UJWNU_HttpRequestJob>(this);
 
 	// GET 메서드에 바디가 달려오는 상황은 표준에서 벗어나있다
-	if (InMethod == EJWNU_HttpMethod::Get && !InContentBody.IsEmpty())
+	if (InRequest->GetMethod() == EJWNU_HttpMethod::Get && InRequest->GetContentBytes().Num() > 0)
 	{
 		PRINT_LOG(LogJWNU_GIS_HttpRequestJobProcessor, Warning, TEXT("HTTP standard violation: attempting to set a Body on a GET request..."))
 	}
 
-	// 쿼리 패리미터 합성
-	const FString FinalURL = BuildURL(InURL, InQueryParams);
-
-	// 리퀘스트 잡 초기화 및 콜백 바인딩
-	RequestJob->Initialize(InMethod, FinalURL, InAuthToken, InContentBody, InConfig);
+	// 리퀘스트 잡 초기화 및 콜백 바인딩 (쿼리 패러미터는 기술자 생성 시 이미 합성됨)
+	RequestJob->Initialize(InRequest, InAuthToken);
 	RequestJob->OnHttpRequestJobComplete = InOnHttpRequestJobCompleted;
+	RequestJob->OnHttpRequestJobCompleteUtf8 = InOnHttpRequestJobCompletedUtf8;
 	RequestJob->OnHttpRequestJobRetry = InOnHttpRequestJobRetry;
+	RequestJob->OnHttpResponseStream = InOnHttpResponseStream;
+	RequestJob->OnHttpRequestJobFailed = InOnHttpRequestJobFailed;
+
+	// HTTP 델리게이트, 타이머, 완료 큐는 모두 약한 참조이므로 Job은 결과를 디스패치하거나 취소될 때까지 GC되지 않도록 유지
+	InFlightJobs.Add(RequestJob);
 
 	// 리퀘스트 잡 실행 및 확인
 	if (RequestJob->Execute())
 	{
-		PRINT_LOG(LogJWNU_GIS_HttpRequestJobProcessor, Display, TEXT("%s executed successfully!"), *InURL);
+		PRINT_LOG(LogJWNU_GIS_HttpRequestJobProcessor, Display, TEXT("%s executed successfully!"), *InRequest->GetURL());
 	}
 	else
 	{
-		PRINT_LOG(LogJWNU_GIS_HttpRequestJobProcessor, Warning, TEXT("%s execution failed!"), *InURL);
+		PRINT_LOG(LogJWNU_GIS_HttpRequestJobProcessor, Warning, TEXT("%s execution failed!"), *InRequest->GetURL());
 	}
 
 	return RequestJob;
 }
 
-FString UJWNU_GIS_HttpRequestJobProcessor::BuildURL(const FString& BaseURL, const TMap<FString, FString>& QueryParams)
+void UJWNU_GIS_HttpRequestJobProcessor::ReleaseJob(UJWNU_HttpRequestJob* InJob)
+{
+	if (IsInGameThread())
+	{
+		InFlightJobs.Remove(InJob);
+		return;
+	}
+
+	// 집합은 게임 스레드에서만 수정한다 (그때까지 Job은 집합이, 서브시스템이 내려간 뒤라면 루트가 유지)
+	AsyncTask(ENamedThreads::GameThread, [WeakThis = TWeakObjectPtr<UJWNU_GIS_HttpRequestJobProcessor>(this), InJob]()
+	{
+		if (UJWNU_GIS_HttpRequestJobProcessor* Self = WeakThis.Get())
+		{
+			Self->InFlightJobs.Remove(InJob);
+		}
+		if (InJob->IsRooted())
+		{
+			InJob->RemoveFromRoot();
+		}
+	});
+}
+
+void UJWNU_GIS_HttpRequestJobProcessor::EnqueueCompletion(UJWNU_HttpRequestJob* InJob, const bool bNetworkAvailable, const int32 StatusCode, TArray<uint8>&& ResponseBytes)
+{
+	FJWNU_PendingJobCompletion Completion;
+	Completion.Job = InJob;
+	Completion.bNetworkAvailable = bNetworkAvailable;
+	Completion.StatusCode = StatusCode;
+	Completion.ResponseBytes = MoveTemp(ResponseBytes);
+
+	// 예산이 꺼져 있다면 기존처럼 즉시 디스패치
+	if (CompletionBudgetMilliseconds <= 0.0f)
+	{
+		DispatchCompletion(Completion);
+		return;
+	}
+
+	if (InJob->Config.Priority == EJWNU_RequestPriority::Critical)
+	{
+		CriticalCompletionQueue.Add(MoveTemp(Completion));
+	}
+	else
+	{
+		NormalCompletionQueue.Add(MoveTemp(Completion));
+	}
+
+	// 큐가 비어있는 동안은 틱을 돌리지 않는다
+	if (CompletionTickerHandle.IsValid() == false)
+	{
+		CompletionTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UJWNU_GIS_HttpRequestJobProcessor::TickCompletionQueue));
+	}
+}
+
+bool UJWNU_GIS_HttpRequestJobProcessor::TickCompletionQueue(float DeltaTime)
 {
-	if (QueryParams.Num() == 0)
+	TRACE_CPUPROFILER_EVENT_SCOPE(UJWNU_GIS_HttpRequestJobProcessor::TickCompletionQueue);
+
+	// Critical 우선순위는 예산과 무관하게 모두 먼저 디스패치 (콜백 안에서 새로 적재된 항목 포함)
+	for (int32 Index = 0; Index < CriticalCompletionQueue.Num(); ++Index)
 	{
-		return BaseURL;
+		// 콜백이 큐에 새 항목을 적재하며 재할당할 수 있으므로 꺼내서 디스패치
+		FJWNU_PendingJobCompletion Completion = MoveTemp(CriticalCompletionQueue[Index]);
+		DispatchCompletion(Completion);
 	}
+	CriticalCompletionQueue.Reset();
 
-	FString CombinedParams = "";
-	for (auto& It : QueryParams)
+	// 일반 우선순위는 예산 안에서 디스패치하되, 진행을 보장하기 위해 최소 1개는 처리
+	const double StartTime = FPlatformTime::Seconds();
+	const double BudgetSeconds = CompletionBudgetMilliseconds / 1000.0;
+	int32 DispatchedCount = 0;
+	while (DispatchedCount < NormalCompletionQueue.Num())
 	{
-		// 특수 문자가 포함될 수 있으므로 인코딩 처리
-		FString EncodedKey = FGenericPlatformHttp::UrlEncode(It.Key);
-		FString EncodedValue = FGenericPlatformHttp::UrlEncode(It.Value);
-		CombinedParams += FString::Printf(TEXT("%s=%s&"), *EncodedKey, *EncodedValue);
+		if (DispatchedCount > 0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+		{
+			break;
+		}
+		FJWNU_PendingJobCompletion Completion = MoveTemp(NormalCompletionQueue[DispatchedCount]);
+		++DispatchedCount;
+		DispatchCompletion(Completion);
 	}
+	NormalCompletionQueue.RemoveAt(0, DispatchedCount, EAllowShrinking::No);
 
-	// 마지막에 붙은 '&' 제거
-	CombinedParams.LeftChopInline(1);
+	if (NormalCompletionQueue.Num() > 0)
+	{
+		PRINT_LOG(LogJWNU_GIS_HttpRequestJobProcessor, Verbose, TEXT("Frame budget exhausted after %d completions, %d carried over to next frame"), DispatchedCount, NormalCompletionQueue.Num());
+	}
 
-	// 기존 URL에 ?가 포함되어 있는지 확인 후 결합
-	const FString Separator = BaseURL.Contains(TEXT("?")) ? TEXT("&") : TEXT("?");
+	if (CriticalCompletionQueue.Num() > 0 || NormalCompletionQueue.Num() > 0)
+	{
+		return true;
+	}
 
-	// 반환
-	return FString::Printf(TEXT("%s%s%s"), *BaseURL, *Separator, *CombinedParams);
+	CompletionTickerHandle.Reset();
+	return false;
+}
+
+void UJWNU_GIS_HttpRequestJobProcessor::DispatchCompletion(FJWNU_PendingJobCompletion& InCompletion)
+{
+	UJWNU_HttpRequestJob* Job = InCompletion.Job.Get();
+	if (Job == nullptr)
+	{
+		return;
+	}
+
+	const uint64 EndpointId = Job->GetEndpointId();
+	const double StartTime = FPlatformTime::Seconds();
+	Job->DispatchCompletion(InCompletion.bNetworkAvailable, InCompletion.StatusCode, MoveTemp(InCompletion.ResponseBytes));
+	ReleaseJob(Job);
+	const double ElapsedMilliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	const bool bSlow = ElapsedMilliseconds >= SlowCompletionThresholdMilliseconds;
+
+	if (EndpointId != 0)
+	{
+		FJWNU_EndpointCompletionStats& Stats = EndpointCompletionStats.FindOrAdd(EndpointId);
+		++Stats.CompletionCount;
+		Stats.SlowCompletionCount += bSlow ? 1 : 0;
+		Stats.MaxCompletionMilliseconds = FMath::Max(Stats.MaxCompletionMilliseconds, ElapsedMilliseconds);
+	}
+
+	MaxCompletionMilliseconds = FMath::Max(MaxCompletionMilliseconds, ElapsedMilliseconds);
+	if (bSlow)
+	{
+		++SlowCompletionCount;
+		PRINT_LOG(LogJWNU_GIS_HttpRequestJobProcessor, Warning, TEXT("Slow completion callback: %.2f ms (threshold %.2f ms) — %s"), ElapsedMilliseconds, SlowCompletionThresholdMilliseconds, *Job->GetURL());
+	}
 }
@@ -1,24 +1,27 @@
 ﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
 
 #include "JWNU_HttpRequestJob.h"
+#include "JWNU_GIS_HttpRequestJobProcessor.h"
 #include "HttpModule.h"
 #include "JWNetworkUtility.h"
 #include "Interfaces/IHttpResponse.h"
 #include "TimerManager.h"
 #include "Engine/World.h"
+#include "Async/Async.h"
 
 DEFINE_LOG_CATEGORY(LogJWNU_HttpRequestJob);
 
-void UJWNU_HttpRequestJob::Initialize(const EJWNU_HttpMethod InMethod, const FString& InURL, const FString& InAuthToken, const FString& InContentBody, const FJWNU_RequestConfig& InConfig)
+void UJWNU_HttpRequestJob::Initialize(const FJWNU_RequestDescriptorRef& InRequest, const FString& InAuthToken)
 {
-	Method = InMethod;
-	URL = InURL;
-	AuthToken = InAuthToken;
-	JsonBody = InContentBody;
-	Config = InConfig;
+	Request = InRequest;
+	Config = InRequest->GetConfig();
+
+	// 재시도마다 포맷하지 않도록 헤더 값을 한 번만 조합
+	AuthorizationHeader = InAuthToken.IsEmpty() ? FString() : TEXT("Bearer ") + InAuthToken;
 
 	// 상태 초기화
 	CurrentAttempt = 0;
+	TransportReason = EJWNU_TransportReason::None;
 	bIsRunning = false;
 	bIsCancelled = false;
 }
@@ -36,6 +39,13 @@ bool UJWNU_HttpRequestJob::Execute()
 	bIsRunning = true;
 	bIsCancelled = false;
 	CurrentAttempt = 0;
+	TransportReason = EJWNU_TransportReason::None;
+
+	// 이미 스트림으로 넘긴 바디는 되돌릴 수 없으므로 재시도하지 않는다
+	if (OnHttpResponseStream.IsBound())
+	{
+		Config.MaxRetries = 1;
+	}
 
 	// 첫 번째 요청 전송
 	SendRequest();
@@ -44,25 +54,57 @@ bool UJWNU_HttpRequestJob::Execute()
 
 void UJWNU_HttpRequestJob::Cancel()
 {
-	// 이미 취소되었거나 실행 중이 아닌 경우 무시
-	if (bIsCancelled || !bIsRunning)
+	// 게임 스레드 밖에서 응답을 처리하는 중일 수 있으므로 상태 전이는 잠금 안에서
+	TSharedPtr<IHttpRequest> RequestToCancel;
+	bool bDroppedQueuedCompletion = false;
 	{
-		return;
+		FScopeLock Lock(&StateLock);
+
+		// 이미 취소되었거나 실행 중이 아닌 경우 무시
+		if (bIsCancelled || !bIsRunning)
+		{
+			return;
+		}
+
+		bIsCancelled = true;
+
+		// 완료 큐에서 디스패치를 기다리는 중이라면 결과만 버린다
+		if (bIsCompletionQueued)
+		{
+			bIsCompletionQueued = false;
+			bIsRunning = false;
+			bDroppedQueuedCompletion = true;
+		}
+		else
+		{
+			RequestToCancel = MoveTemp(CurrentRequest);
+			bIsRunning = false;
+		}
 	}
 
-	bIsCancelled = true;
+	// 완료 큐에서 디스패치를 기다리는 중이었다면 결과만 버리고, 더 올 콜백이 없으므로 참조를 놓는다
+	if (bDroppedQueuedCompletion)
+	{
+		ReleaseFromProcessor();
+		PRINT_LOG(LogJWNU_HttpRequestJob, Display, TEXT("Job cancelled while waiting for completion dispatch."));
+		return;
+	}
 
 	// 모든 타이머 정리
 	ClearAllTimers();
 
-	// 진행 중인 HTTP 요청 취소
-	if (CurrentRequest.IsValid())
+	// 진행 중인 HTTP 요청 취소 (취소 완료 콜백은 취소 플래그를 보고 무시된다)
+	if (RequestToCancel.IsValid())
 	{
-		CurrentRequest->CancelRequest();
-		CurrentRequest.Reset();
+		RequestToCancel->CancelRequest();
 	}
 
-	bIsRunning = false;
+	// 게임 스레드 Job의 응답 콜백은 약한 참조라 곧바로 놓고,
+	// 게임 스레드 밖 Job은 취소된 요청의 완료 콜백이 아직 올 수 있으므로 그 콜백이 취소를 확인하고 참조를 놓는다
+	if (IsOffGameThread() == false || RequestToCancel.IsValid() == false)
+	{
+		ReleaseFromProcessor();
+	}
 
 	PRINT_LOG(LogJWNU_HttpRequestJob, Display, TEXT("Job cancelled. (Total attempts: %d)"), CurrentAttempt);
 }
@@ -75,52 +117,89 @@ void UJWNU_HttpRequestJob::SendRequest()
 		return;
 	}
 
-	CurrentAttempt++;
-	PRINT_LOG(LogJWNU_HttpRequestJob, Display, TEXT("HTTP request attempt %d/%d: %s"), CurrentAttempt, Config.MaxRetries, *URL);
+	// 게임 스레드 밖 Job의 재시도도 코어 티커에서 호출되므로 전송은 항상 게임 스레드
+	check(IsInGameThread());
 
-	// HTTP 요청 객체 생성
-	CurrentRequest = FHttpModule::Get().CreateRequest();
+	CurrentAttempt++;
+	PRINT_LOG(LogJWNU_HttpRequestJob, Display, TEXT("HTTP request attempt %d/%d: %s"), CurrentAttempt, Config.MaxRetries, *Request->GetURL());
 
-	// HTTP 메서드 문자열 변환
-	FString MethodString;
-	switch (Method)
+	// HTTP 요청 객체 생성 (응답 처리 중인 다른 스레드가 이전 요청을 정리할 수 있으므로 잠금 안에서 교체)
+	const TSharedRef<IHttpRequest> NewRequest = FHttpModule::Get().CreateRequest();
 	{
-	case EJWNU_HttpMethod::Get:
-		MethodString = TEXT("GET");
-		break;
-	case EJWNU_HttpMethod::Post:
-		MethodString = TEXT("POST");
-		break;
-	case EJWNU_HttpMethod::Put:
-		MethodString = TEXT("PUT");
-		break;
-	case EJWNU_HttpMethod::Delete:
-		MethodString = TEXT("DELETE");
-		break;
+		FScopeLock Lock(&StateLock);
+		if (bIsCancelled)
+		{
+			return;
+		}
+		CurrentRequest = NewRequest;
+		RetryTickerHandle.Reset();
 	}
 
 	// 요청 설정
-	CurrentRequest->SetVerb(MethodString);
-	CurrentRequest->SetURL(URL);
+	CurrentRequest->SetVerb(Request->GetVerb());
+	CurrentRequest->SetURL(Request->GetURL());
 	CurrentRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
 
 	// JWT 인증 토큰 설정
-	if (!AuthToken.IsEmpty())
+	if (AuthorizationHeader.IsEmpty() == false)
 	{
-		CurrentRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *AuthToken));
+		CurrentRequest->SetHeader(TEXT("Authorization"), AuthorizationHeader);
 	}
 
-	// JSON 바디 설정 (POST/PUT)
-	if (!JsonBody.IsEmpty())
+	// JSON 바디 설정 (POST/PUT), 이미 UTF-8로 변환된 바이트를 그대로 넘긴다
+	if (Request->GetContentBytes().Num() > 0)
 	{
-		CurrentRequest->SetContentAsString(JsonBody);
+		CurrentRequest->SetContent(Request->GetContentBytes());
+	}
+
+	// 스트리밍 모드라면 바디를 모으지 않고 도착하는 대로 전달 (HTTP 스레드에서 호출되므로 델리게이트 사본만 캡처)
+	if (OnHttpResponseStream.IsBound())
+	{
+		CurrentRequest->SetResponseBodyReceiveStreamDelegateV2(FHttpRequestStreamDelegateV2::CreateLambda(
+			[StreamDelegate = OnHttpResponseStream](void* InData, int64& InOutLength)
+			{
+				if (StreamDelegate.Execute(static_cast<const uint8*>(InData), InOutLength) == false)
+				{
+					// 소비한 길이를 0으로 돌려주면 HTTP 모듈이 요청을 중단한다
+					InOutLength = 0;
+				}
+			}));
 	}
 
 	// 응답 콜백 바인딩
-	CurrentRequest->OnProcessRequestComplete().BindUObject(this, &UJWNU_HttpRequestJob::OnResponseReceived);
+	// 게임 스레드 밖 Job은 마지막 응답 콜백이 끝날 때까지 JobProcessor가 강한 참조로 유지하므로,
+	// 다른 스레드에서 약한 UObject 참조를 해석하지 않고 게임 스레드에서 잡은 포인터를 그대로 넘긴다
+	switch (Config.CompletionThread)
+	{
+	case EJWNU_CompletionThread::HttpThread:
+		CurrentRequest->SetDelegateThreadPolicy(EHttpRequestDelegateThreadPolicy::CompleteOnHttpThread);
+		CurrentRequest->OnProcessRequestComplete().BindLambda([Self = this](FHttpRequestPtr InHttpRequest, FHttpResponsePtr InHttpResponse, const bool bInNetworkAvailable)
+		{
+			Self->OnResponseReceived(InHttpRequest, InHttpResponse, bInNetworkAvailable);
+		});
+		break;
+	case EJWNU_CompletionThread::TaskGraph:
+		// 바디 변환부터 워커에서 하도록 HTTP 스레드는 넘기기만 한다
+		CurrentRequest->SetDelegateThreadPolicy(EHttpRequestDelegateThreadPolicy::CompleteOnHttpThread);
+		CurrentRequest->OnProcessRequestComplete().BindLambda([Self = this](FHttpRequestPtr InHttpRequest, FHttpResponsePtr InHttpResponse, const bool bInNetworkAvailable)
+		{
+			AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Self, InHttpRequest, InHttpResponse, bInNetworkAvailable]()
+			{
+				Self->OnResponseReceived(InHttpRequest, InHttpResponse, bInNetworkAvailable);
+			});
+		});
+		break;
+	default:
+		CurrentRequest->OnProcessRequestComplete().BindUObject(this, &UJWNU_HttpRequestJob::OnResponseReceived);
+		break;
+	}
 
-	// 타임아웃 타이머 설정
-	if (const UWorld* World = GetWorld())
+	// 타임아웃 설정 (월드 타이머는 게임 스레드에서만 해제할 수 있으므로, 게임 스레드 밖 Job은 HTTP 모듈의 요청 타임아웃을 사용)
+	if (IsOffGameThread())
+	{
+		CurrentRequest->SetTimeout(Config.TimeoutSeconds);
+	}
+	else if (const UWorld* World = GetWorld())
 	{
 		World->GetTimerManager().SetTimer(
 			TimeoutTimerHandle,
@@ -132,19 +211,29 @@ void UJWNU_HttpRequestJob::SendRequest()
 	}
 
 	// 요청 실행
-	CurrentRequest->ProcessRequest();
+	NewRequest->ProcessRequest();
 }
 
-void UJWNU_HttpRequestJob::OnResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, const bool bNetworkAvailable)
+void UJWNU_HttpRequestJob::OnResponseReceived(FHttpRequestPtr InHttpRequest, FHttpResponsePtr Response, const bool bNetworkAvailable)
 {
 	// 취소된 경우 무시
 	if (bIsCancelled)
 	{
+		ReleaseIfCancelledOffGameThread();
 		return;
 	}
 
+	if (IsOffGameThread())
+	{
+		// HTTP 모듈의 요청 타임아웃으로 끝난 시도는 타임아웃 흐름으로 처리
+		if (InHttpRequest.IsValid() && InHttpRequest->GetFailureReason() == EHttpFailureReason::TimedOut)
+		{
+			OnTimeout();
+			return;
+		}
+	}
 	// 타임아웃 타이머 해제
-	if (const UWorld* World = GetWorld())
+	else if (const UWorld* World = GetWorld())
 	{
 		World->GetTimerManager().ClearTimer(TimeoutTimerHandle);
 	}
@@ -164,11 +253,16 @@ void UJWNU_HttpRequestJob::OnResponseReceived(FHttpRequestPtr Request, FHttpResp
 		return;
 	}
 
-	// 리스폰스 바디 획득
-	const FString ResponseBody = Response.IsValid() ? Response->GetContentAsString() : TEXT("");
+	// 리스폰스 바디 획득 (실패 델리게이트로 넘어갈 결과라면 바디를 읽지 않는다, 문자열 변환은 문자열 소비자에게 넘기기 직전까지 미룬다)
+	TransportReason = bNetworkAvailable ? EJWNU_TransportReason::None : EJWNU_TransportReason::ConnectionFailed;
+	TArray<uint8> ResponseBytes;
+	if (Response.IsValid() && IsRoutedToFailure(StatusCode, bNetworkAvailable) == false)
+	{
+		ResponseBytes = Response->GetContent();
+	}
 
 	// Job 최종 처리 단계
-	CompleteJob(bNetworkAvailable, StatusCode, ResponseBody);
+	CompleteJob(bNetworkAvailable, StatusCode, MoveTemp(ResponseBytes));
 }
 
 void UJWNU_HttpRequestJob::OnTimeout()
@@ -176,16 +270,24 @@ void UJWNU_HttpRequestJob::OnTimeout()
 	// 취소된 경우 무시
 	if (bIsCancelled)
 	{
+		ReleaseIfCancelledOffGameThread();
 		return;
 	}
 
 	PRINT_LOG(LogJWNU_HttpRequestJob, Warning, TEXT("HTTP request timed out (attempt %d/%d)"), CurrentAttempt, Config.MaxRetries);
 
-	// 현재 요청 취소
-	if (CurrentRequest.IsValid())
+	// 현재 요청 취소 (게임 스레드 밖 Job은 HTTP 모듈이 이미 끝낸 요청이며, 취소가 참조 해제를 이 콜백에 미루도록 재시도나 완료 처리까지 쥐고 있는다)
+	if (IsOffGameThread() == false)
 	{
-		CurrentRequest->CancelRequest();
-		CurrentRequest.Reset();
+		TSharedPtr<IHttpRequest> TimedOutRequest;
+		{
+			FScopeLock Lock(&StateLock);
+			TimedOutRequest = MoveTemp(CurrentRequest);
+		}
+		if (TimedOutRequest.IsValid())
+		{
+			TimedOutRequest->CancelRequest();
+		}
 	}
 
 	// 타임아웃 시 재시도 여부 판단
@@ -195,11 +297,17 @@ void UJWNU_HttpRequestJob::OnTimeout()
 		return;
 	}
 
-	// 타임아웃 실패에 대한 리스폰스 바디 생성
-	const FString TimeoutResponse = TEXT("{\"message\": \"This is Message from JWNetworkUtility Plugin. Not from Unreal Engine Http Module. Http Request timed out\"}");
+	// 타임아웃 실패에 대한 리스폰스 바디 생성 (실패 델리게이트로 넘어간다면 생략)
+	TransportReason = EJWNU_TransportReason::Timeout;
+	TArray<uint8> TimeoutResponse;
+	if (IsRoutedToFailure(408, false) == false)
+	{
+		static const ANSICHAR TimeoutMessage[] = "{\"message\": \"This is Message from JWNetworkUtility Plugin. Not from Unreal Engine Http Module. Http Request timed out\"}";
+		TimeoutResponse.Append(reinterpret_cast<const uint8*>(TimeoutMessage), UE_ARRAY_COUNT(TimeoutMessage) - 1);
+	}
 	
 	// Job 최종 처리 단계
-	CompleteJob(false, 408, TimeoutResponse);
+	CompleteJob(false, 408, MoveTemp(TimeoutResponse));
 }
 
 void UJWNU_HttpRequestJob::ScheduleRetry()
@@ -207,6 +315,7 @@ void UJWNU_HttpRequestJob::ScheduleRetry()
 	// 취소된 경우 무시
 	if (bIsCancelled)
 	{
+		ReleaseIfCancelledOffGameThread();
 		return;
 	}
 
@@ -215,8 +324,30 @@ void UJWNU_HttpRequestJob::ScheduleRetry()
 	// 재시도 이벤트 브로드캐스트
 	OnHttpRequestJobRetry.ExecuteIfBound(CurrentAttempt + 1);
 
-	// 딜레이 후 재시도
-	if (const UWorld* World = GetWorld())
+	// 딜레이 후 재시도 (게임 스레드 밖 Job은 어느 스레드에서든 등록할 수 있는 코어 티커로 게임 스레드에 예약)
+	if (IsOffGameThread())
+	{
+		bool bCancelledBeforeRetry = false;
+		{
+			FScopeLock Lock(&StateLock);
+			bCancelledBeforeRetry = bIsCancelled;
+			if (bCancelledBeforeRetry == false)
+			{
+				// 끝난 요청을 놓아 두어야, 딜레이 중의 취소가 더 올 콜백이 없다는 것을 알고 곧바로 참조를 놓는다
+				CurrentRequest.Reset();
+				RetryTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float)
+				{
+					SendRequest();
+					return false;
+				}), Config.RetryDelaySeconds);
+			}
+		}
+		if (bCancelledBeforeRetry)
+		{
+			ReleaseFromProcessor();
+		}
+	}
+	else if (const UWorld* World = GetWorld())
 	{
 		World->GetTimerManager().SetTimer(
 			RetryTimerHandle,
@@ -228,16 +359,81 @@ void UJWNU_HttpRequestJob::ScheduleRetry()
 	}
 }
 
-void UJWNU_HttpRequestJob::CompleteJob(const bool bNetworkAvailable, const int32 StatusCode, const FString& ResponseBody)
+void UJWNU_HttpRequestJob::CompleteJob(const bool bNetworkAvailable, const int32 StatusCode, TArray<uint8>&& ResponseBytes)
 {
-	// 상태 정리
-	bIsRunning = false;
-	CurrentRequest.Reset();
+	// 상태 정리 (게임 스레드 밖 Job은 취소가 참조 해제를 이 콜백에 미루도록, 디스패치가 끝날 때까지 요청을 쥐고 있는다)
+	if (IsOffGameThread() == false)
+	{
+		FScopeLock Lock(&StateLock);
+		CurrentRequest.Reset();
+	}
 	ClearAllTimers();
 	
 	PRINT_LOG(LogJWNU_HttpRequestJob, Display, TEXT("Job completed — network available: %s, total attempts: %d"), bNetworkAvailable ? TEXT("true") : TEXT("false"), CurrentAttempt);
-	
-	OnHttpRequestJobComplete.ExecuteIfBound(bNetworkAvailable, StatusCode, ResponseBody);
+
+	// 게임 스레드 밖 Job은 프레임 예산 완료 큐를 거치지 않고 응답 처리 스레드에서 곧바로 디스패치
+	if (IsOffGameThread())
+	{
+		DispatchCompletion(bNetworkAvailable, StatusCode, MoveTemp(ResponseBytes));
+		{
+			FScopeLock Lock(&StateLock);
+			CurrentRequest.Reset();
+		}
+		ReleaseFromProcessor();
+		return;
+	}
+
+	// 프레임 예산 디스패치를 위해 JobProcessor의 완료 큐로 전달 (디스패치 전까지 IsRunning 유지)
+	if (UJWNU_GIS_HttpRequestJobProcessor* Processor = Cast<UJWNU_GIS_HttpRequestJobProcessor>(GetOuter()))
+	{
+		bIsCompletionQueued = true;
+		Processor->EnqueueCompletion(this, bNetworkAvailable, StatusCode, MoveTemp(ResponseBytes));
+		return;
+	}
+
+	DispatchCompletion(bNetworkAvailable, StatusCode, MoveTemp(ResponseBytes));
+}
+
+void UJWNU_HttpRequestJob::DispatchCompletion(const bool bNetworkAvailable, const int32 StatusCode, TArray<uint8>&& ResponseBytes)
+{
+	// 디스패치 대기 중에 취소된 경우 무시 (취소와 겹치지 않도록 확인과 전이를 함께)
+	{
+		FScopeLock Lock(&StateLock);
+		if (bIsCancelled)
+		{
+			return;
+		}
+
+		bIsCompletionQueued = false;
+		bIsRunning = false;
+	}
+
+	// 실패는 가짜 리스폰스 바디 없이 구조화된 에러로 전달 (커스텀 코드와 메시지는 상위 레이어가 채운다)
+	if (IsRoutedToFailure(StatusCode, bNetworkAvailable))
+	{
+		FJWNU_ApiError Error;
+		Error.StatusCode = StatusCode;
+		Error.AttemptCount = CurrentAttempt;
+		Error.TransportReason = TransportReason;
+		OnHttpRequestJobFailed.Execute(Error);
+		return;
+	}
+
+	// UTF-8 소비자(구조체 파싱 경로)에게는 바이트 버퍼를 복사 없이 넘긴다
+	if (OnHttpRequestJobCompleteUtf8.IsBound())
+	{
+		OnHttpRequestJobCompleteUtf8.Execute(bNetworkAvailable, StatusCode, MoveTemp(ResponseBytes));
+		return;
+	}
+
+	// 문자열 소비자에게만 TCHAR로 변환해서 전달
+	const FUTF8ToTCHAR BodyConverter(reinterpret_cast<const ANSICHAR*>(ResponseBytes.GetData()), ResponseBytes.Num());
+	OnHttpRequestJobComplete.ExecuteIfBound(bNetworkAvailable, StatusCode, FString(BodyConverter.Length(), BodyConverter.Get()));
+}
+
+bool UJWNU_HttpRequestJob::IsRoutedToFailure(const int32 StatusCode, const bool bNetworkAvailable) const
+{
+	return OnHttpRequestJobFailed.IsBound() && (bNetworkAvailable == false || StatusCode < 200 || StatusCode >= 300);
 }
 
 bool UJWNU_HttpRequestJob::ShouldRetry(const int32 StatusCode, const bool bNetworkAvailable) const
@@ -261,6 +457,18 @@ bool UJWNU_HttpRequestJob::ShouldRetry(const int32 StatusCode, const bool bNetwo
 
 void UJWNU_HttpRequestJob::ClearAllTimers()
 {
+	// 게임 스레드 밖 Job은 월드 타이머를 쓰지 않는다
+	if (IsOffGameThread())
+	{
+		FScopeLock Lock(&StateLock);
+		if (RetryTickerHandle.IsValid())
+		{
+			FTSTicker::GetCoreTicker().RemoveTicker(RetryTickerHandle);
+			RetryTickerHandle.Reset();
+		}
+		return;
+	}
+
 	if (const UWorld* World = GetWorld())
 	{
 		World->GetTimerManager().ClearTimer(RetryTimerHandle);
@@ -268,3 +476,19 @@ void UJWNU_HttpRequestJob::ClearAllTimers()
 		PRINT_LOG(LogJWNU_HttpRequestJob, Display, TEXT("Timers cleared"));
 	}
 }
+
+void UJWNU_HttpRequestJob::ReleaseIfCancelledOffGameThread()
+{
+	if (IsOffGameThread())
+	{
+		ReleaseFromProcessor();
+	}
+}
+
+void UJWNU_HttpRequestJob::ReleaseFromProcessor()
+{
+	if (UJWNU_GIS_HttpRequestJobProcessor* Processor = Cast<UJWNU_GIS_HttpRequestJobProcessor>(GetOuter()))
+	{
+		Processor->ReleaseJob(this);
+	}
+}
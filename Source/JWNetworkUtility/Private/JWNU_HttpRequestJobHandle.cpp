@@ -2,43 +2,29 @@
 
 #include "JWNU_HttpRequestJobHandle.h"
 
-void UJWNU_HttpRequestJobHandle::Cancel()
-{
-	bIsCancelled = true;
-	bIsWaitingForRefresh = false;
-
-	if (CurrentJob && CurrentJob->IsRunning())
-	{
-		CurrentJob->Cancel();
-	}
-}
-
-bool UJWNU_HttpRequestJobHandle::IsRunning() const
+UJWNU_HttpRequestJobHandle* UJWNU_HttpRequestJobHandle::Wrap(const FJWNU_RequestHandle& InHandle)
 {
-	if (bIsCancelled)
+	if (InHandle.IsValid() == false)
 	{
-		return false;
+		return nullptr;
 	}
 
-	return (CurrentJob && CurrentJob->IsRunning()) || bIsWaitingForRefresh;
+	UJWNU_HttpRequestJobHandle* Handle = NewObject<UJWNU_HttpRequestJobHandle>();
+	Handle->NativeHandle = InHandle;
+	return Handle;
 }
 
-bool UJWNU_HttpRequestJobHandle::IsCancelled() const
-{
-	return bIsCancelled;
-}
-
-void UJWNU_HttpRequestJobHandle::BindJob(UJWNU_HttpRequestJob* InJob)
+void UJWNU_HttpRequestJobHandle::Cancel()
 {
-	CurrentJob = InJob;
+	NativeHandle.Cancel();
 }
 
-void UJWNU_HttpRequestJobHandle::MarkWaitingForRefresh()
+bool UJWNU_HttpRequestJobHandle::IsRunning() const
 {
-	bIsWaitingForRefresh = true;
+	return NativeHandle.IsRunning();
 }
 
-void UJWNU_HttpRequestJobHandle::ClearWaitingForRefresh()
+bool UJWNU_HttpRequestJobHandle::IsCancelled() const
 {
-	bIsWaitingForRefresh = false;
+	return NativeHandle.IsCancelled();
 }
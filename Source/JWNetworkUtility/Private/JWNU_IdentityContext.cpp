@@ -0,0 +1,104 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#include "JWNU_IdentityContext.h"
+#include "JWNetworkUtility.h"
+#include "JWNU_GIS_ApiIdentityProvider.h"
+
+DEFINE_LOG_CATEGORY(LogJWNU_IdentityContext);
+
+TSharedRef<FJWNU_IdentityContext, ESPMode::ThreadSafe> FJWNU_IdentityContext::Create(const FString& InContextName)
+{
+	return MakeShared<FJWNU_IdentityContext, ESPMode::ThreadSafe>(InContextName);
+}
+
+FJWNU_IdentityContext::FJWNU_IdentityContext(const FString& InContextName)
+	: ContextName(InContextName)
+{
+	AccessTokenContainers.Emplace(EJWNU_ServiceType::GameServer, {});
+	AccessTokenContainers.Emplace(EJWNU_ServiceType::AuthServer, {});
+}
+
+const FString& FJWNU_IdentityContext::GetContextName() const
+{
+	return ContextName;
+}
+
+bool FJWNU_IdentityContext::IsPersistent() const
+{
+	return PersistentStore.IsValid();
+}
+
+bool FJWNU_IdentityContext::GetAccessTokenContainer(const EJWNU_ServiceType InServiceType, FJWNU_AccessTokenContainer& OutAccessTokenContainer) const
+{
+	if (const FJWNU_AccessTokenContainer* Container = AccessTokenContainers.Find(InServiceType))
+	{
+		OutAccessTokenContainer = *Container;
+		if (OutAccessTokenContainer.AccessToken.IsEmpty())
+		{
+			PRINT_LOG(LogJWNU_IdentityContext, Warning, TEXT("[%s] Extraction of AccessToken is Successful, but it's Empty!"), *ContextName);
+		}
+
+		// 단, 내용물이 유효한지는 보장할 수 없다
+		return true;
+	}
+
+	// 기본 생성자의 트래시 토큰이 담겨있다
+	return false;
+}
+
+void FJWNU_IdentityContext::SetAccessTokenContainer(const EJWNU_ServiceType InServiceType, const FJWNU_AccessTokenContainer& InAccessTokenContainer)
+{
+	AccessTokenContainers.Add(InServiceType, InAccessTokenContainer);
+}
+
+bool FJWNU_IdentityContext::GetRefreshTokenContainer(const EJWNU_ServiceType InServiceType, FJWNU_RefreshTokenContainer& OutRefreshTokenContainer) const
+{
+	// 영속 컨텍스트는 키스토어 메모리 사본에서 조회
+	if (const UJWNU_GIS_ApiIdentityProvider* Store = PersistentStore.Get())
+	{
+		return Store->GetRefreshTokenContainer(InServiceType, OutRefreshTokenContainer);
+	}
+
+	if (const FJWNU_RefreshTokenContainer* Container = RefreshTokenContainers.Find(InServiceType))
+	{
+		OutRefreshTokenContainer = *Container;
+		return true;
+	}
+	return false;
+}
+
+void FJWNU_IdentityContext::SetRefreshTokenContainer(const EJWNU_ServiceType InServiceType, const FJWNU_RefreshTokenContainer& InRefreshTokenContainer)
+{
+	// 영속 컨텍스트는 키스토어에 기록
+	if (UJWNU_GIS_ApiIdentityProvider* Store = PersistentStore.Get())
+	{
+		Store->SetRefreshTokenContainer(InServiceType, InRefreshTokenContainer);
+		return;
+	}
+
+	RefreshTokenContainers.Add(InServiceType, InRefreshTokenContainer);
+}
+
+const FString& FJWNU_IdentityContext::GetUserId() const
+{
+	return UserId;
+}
+
+void FJWNU_IdentityContext::SetUserId(const FString& InUserId)
+{
+	UserId = InUserId;
+	PRINT_LOG(LogJWNU_IdentityContext, Display, TEXT("[%s] UserId set: %s"), *ContextName, *UserId);
+}
+
+void FJWNU_IdentityContext::ClearSession(const EJWNU_ServiceType InServiceType)
+{
+	// AccessToken 정리
+	AccessTokenContainers.Add(InServiceType, {});
+
+	PRINT_LOG(LogJWNU_IdentityContext, Display, TEXT("[%s] Session cleared (ServiceType: %s) — UserId preserved"), *ContextName, *UEnum::GetValueAsString(InServiceType));
+}
+
+void FJWNU_IdentityContext::BindPersistentStore(UJWNU_GIS_ApiIdentityProvider* InPersistentStore)
+{
+	PersistentStore = InPersistentStore;
+}
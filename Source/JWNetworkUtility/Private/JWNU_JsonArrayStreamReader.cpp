@@ -0,0 +1,284 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#include "JWNU_JsonArrayStreamReader.h"
+#include "JWNetworkUtility.h"
+
+DEFINE_LOG_CATEGORY(LogJWNU_JsonArrayStreamReader);
+
+FJWNU_JsonArrayStreamReader::FJWNU_JsonArrayStreamReader(const FString& InArrayFieldName, FOnElement&& InOnElement)
+	: OnElement(MoveTemp(InOnElement))
+{
+	const FTCHARToUTF8 Utf8FieldName(*InArrayFieldName);
+	ArrayFieldName.Append(reinterpret_cast<const uint8*>(Utf8FieldName.Get()), Utf8FieldName.Length());
+
+	// 루트 배열 모드라면 첫 값부터 대상 배열
+	bAwaitArrayValue = ArrayFieldName.Num() == 0;
+}
+
+bool FJWNU_JsonArrayStreamReader::Feed(const uint8* InData, const int64 InNum)
+{
+	for (int64 Index = 0; Index < InNum && State != EState::Failed; ++Index)
+	{
+		switch (State)
+		{
+		case EState::Envelope:
+			ConsumeEnvelopeByte(InData[Index]);
+			break;
+		case EState::BetweenElements:
+			ConsumeBetweenElementsByte(InData[Index]);
+			break;
+		case EState::InElement:
+			ConsumeElementByte(InData[Index]);
+			break;
+		case EState::Failed:
+			break;
+		}
+	}
+	return State != EState::Failed;
+}
+
+bool FJWNU_JsonArrayStreamReader::Finish()
+{
+	if (State == EState::Failed)
+	{
+		return false;
+	}
+	if (State != EState::Envelope || Depth != 0 || bInString)
+	{
+		Fail(TEXT("Unexpected end of stream"));
+		return false;
+	}
+	if (bSawRootValue == false)
+	{
+		Fail(TEXT("Empty response body"));
+		return false;
+	}
+	return true;
+}
+
+void FJWNU_JsonArrayStreamReader::ConsumeEnvelopeByte(const uint8 InByte)
+{
+	// UTF-8 BOM은 봉투에 남기지 않는다
+	if (bSawRootValue == false && (InByte == 0xEF || InByte == 0xBB || InByte == 0xBF))
+	{
+		return;
+	}
+
+	if (bInString)
+	{
+		Envelope.Add(InByte);
+		if (bEscape)
+		{
+			bEscape = false;
+			if (bCapturingKey)
+			{
+				KeyBuffer.Add(InByte);
+			}
+		}
+		else if (InByte == '\\')
+		{
+			bEscape = true;
+			if (bCapturingKey)
+			{
+				KeyBuffer.Add(InByte);
+			}
+		}
+		else if (InByte == '"')
+		{
+			bInString = false;
+			bCapturingKey = false;
+		}
+		else if (bCapturingKey)
+		{
+			KeyBuffer.Add(InByte);
+		}
+		return;
+	}
+
+	if (IsWhitespace(InByte))
+	{
+		return;
+	}
+
+	if (Depth == 0)
+	{
+		if (bSawRootValue)
+		{
+			Fail(TEXT("Unexpected data after root value"));
+			return;
+		}
+		bSawRootValue = true;
+	}
+
+	const int32 TargetDepth = ArrayFieldName.Num() == 0 ? 0 : 1;
+	if (bAwaitArrayValue && Depth == TargetDepth)
+	{
+		bAwaitArrayValue = false;
+		if (InByte == '[' && bFoundArray == false)
+		{
+			// 원소는 봉투에 남기지 않고 "[]"만 기록
+			Envelope.Add('[');
+			bFoundArray = true;
+			State = EState::BetweenElements;
+			return;
+		}
+	}
+
+	Envelope.Add(InByte);
+	switch (InByte)
+	{
+	case '"':
+		bInString = true;
+		bCapturingKey = bExpectKey && Depth == 1;
+		if (bCapturingKey)
+		{
+			KeyBuffer.Reset();
+		}
+		break;
+
+	case '{':
+	case '[':
+		++Depth;
+		bExpectKey = InByte == '{' && Depth == 1;
+		break;
+
+	case '}':
+	case ']':
+		--Depth;
+		if (Depth < 0)
+		{
+			Fail(TEXT("Unbalanced closing bracket"));
+		}
+		break;
+
+	case ':':
+		if (Depth == 1)
+		{
+			bExpectKey = false;
+			bAwaitArrayValue = ArrayFieldName.Num() > 0 && KeyBuffer == ArrayFieldName;
+		}
+		break;
+
+	case ',':
+		if (Depth == 1)
+		{
+			bExpectKey = true;
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+void FJWNU_JsonArrayStreamReader::ConsumeBetweenElementsByte(const uint8 InByte)
+{
+	if (IsWhitespace(InByte) || InByte == ',')
+	{
+		return;
+	}
+
+	if (InByte == ']')
+	{
+		// 대상 배열이 닫혔으므로 다시 봉투 영역으로
+		Envelope.Add(']');
+		State = EState::Envelope;
+		return;
+	}
+
+	ElementBuffer.Reset();
+	ElementDepth = 0;
+	bInString = false;
+	bEscape = false;
+	State = EState::InElement;
+	ConsumeElementByte(InByte);
+}
+
+void FJWNU_JsonArrayStreamReader::ConsumeElementByte(const uint8 InByte)
+{
+	if (bInString)
+	{
+		ElementBuffer.Add(InByte);
+		if (bEscape)
+		{
+			bEscape = false;
+		}
+		else if (InByte == '\\')
+		{
+			bEscape = true;
+		}
+		else if (InByte == '"')
+		{
+			bInString = false;
+			if (ElementDepth == 0)
+			{
+				EmitElement();
+			}
+		}
+		return;
+	}
+
+	// 원시 값 원소는 구분자를 만나면 끝난다
+	if (ElementDepth == 0 && ElementBuffer.Num() > 0 && (InByte == ',' || InByte == ']' || IsWhitespace(InByte)))
+	{
+		EmitElement();
+		if (State == EState::BetweenElements)
+		{
+			ConsumeBetweenElementsByte(InByte);
+		}
+		return;
+	}
+
+	ElementBuffer.Add(InByte);
+	switch (InByte)
+	{
+	case '"':
+		bInString = true;
+		break;
+
+	case '{':
+	case '[':
+		++ElementDepth;
+		break;
+
+	case '}':
+	case ']':
+		--ElementDepth;
+		if (ElementDepth < 0)
+		{
+			Fail(TEXT("Unbalanced closing bracket in array element"));
+			return;
+		}
+		if (ElementDepth == 0)
+		{
+			EmitElement();
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+void FJWNU_JsonArrayStreamReader::EmitElement()
+{
+	State = EState::BetweenElements;
+	const int32 ElementIndex = ElementCount++;
+	if (OnElement && OnElement(reinterpret_cast<const UTF8CHAR*>(ElementBuffer.GetData()), ElementBuffer.Num()) == false)
+	{
+		Fail(FString::Printf(TEXT("Failed to convert array element %d"), ElementIndex));
+		return;
+	}
+	ElementBuffer.Reset();
+}
+
+void FJWNU_JsonArrayStreamReader::Fail(const FString& InMessage)
+{
+	if (State == EState::Failed)
+	{
+		return;
+	}
+	State = EState::Failed;
+	ErrorMessage = InMessage;
+	PRINT_LOG(LogJWNU_JsonArrayStreamReader, Warning, TEXT("%s"), *InMessage);
+}
@@ -0,0 +1,260 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#include "JWNetworkUtility.h"
+#include "JWNetworkUtilityTypes.h"
+#include "JWNU_JsonStructReader.h"
+#include "JWNU_JsonStructWriter.h"
+#include "JWNU_JsonSimdScanner.h"
+#include "JsonObjectConverter.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/StructOnScope.h"
+#include "HAL/IConsoleManager.h"
+
+#if !UE_BUILD_SHIPPING
+
+/**
+ * JSON 변환 경로 벤치마크. 응답-요청 구조체마다 FJsonObjectConverter 경로와 스키마 캐시 경로의 평균 변환 시간을 비교한다.
+ * 사용법 : JWNU.BenchmarkJson [반복 횟수 = 10000]
+ */
+namespace JWNU_JsonBenchmark_Private
+{
+	template<typename FuncType>
+	double MeasureMicroseconds(const int32 InIterations, FuncType&& InFunc)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < InIterations; ++Index)
+		{
+			InFunc();
+		}
+		return (FPlatformTime::Seconds() - StartTime) * 1000000.0 / InIterations;
+	}
+
+	void PrintRow(const TCHAR* InStructName, const TCHAR* InPath, const double InOldMicroseconds, const double InNewMicroseconds)
+	{
+		PRINT_LOG(JWLog, Display, TEXT("%-24s %-12s old %8.2f us | new %8.2f us | x%.2f"), InStructName, InPath, InOldMicroseconds, InNewMicroseconds, InNewMicroseconds > 0.0 ? InOldMicroseconds / InNewMicroseconds : 0.0);
+	}
+
+	template<typename StructType>
+	void RunCase(const StructType& InSample, const int32 InIterations)
+	{
+		const UScriptStruct* Struct = StructType::StaticStruct();
+		const FString StructName = Struct->GetName();
+
+		FString Json;
+		FJsonObjectConverter::UStructToJsonObjectString(InSample, Json, 0, 0, 0, nullptr, false);
+		const FTCHARToUTF8 Utf8Json(*Json);
+		const UTF8CHAR* Utf8Data = reinterpret_cast<const UTF8CHAR*>(Utf8Json.Get());
+		const int32 Utf8Num = Utf8Json.Length();
+
+		// 두 경로의 결과가 동일한지 먼저 확인
+		StructType OldResult;
+		StructType NewResult;
+		FJsonObjectConverter::JsonObjectStringToUStruct(Json, &OldResult, 0, 0);
+		FJWNU_JsonStructReader::ReadUtf8(Utf8Data, Utf8Num, Struct, &NewResult);
+		if (Struct->CompareScriptStruct(&OldResult, &NewResult, PPF_None) == false)
+		{
+			PRINT_LOG(JWLog, Warning, TEXT("%s : reader result differs from FJsonObjectConverter"), *StructName);
+		}
+
+		const double OldRead = MeasureMicroseconds(InIterations, [&Json]()
+		{
+			StructType Result;
+			FJsonObjectConverter::JsonObjectStringToUStruct(Json, &Result, 0, 0);
+		});
+		const double NewRead = MeasureMicroseconds(InIterations, [&Json]()
+		{
+			StructType Result;
+			FJWNU_JsonStructReader::ReadString(Json, Result);
+		});
+		const double NewReadUtf8 = MeasureMicroseconds(InIterations, [Struct, Utf8Data, Utf8Num]()
+		{
+			StructType Result;
+			FJWNU_JsonStructReader::ReadUtf8(Utf8Data, Utf8Num, Struct, &Result);
+		});
+		const double OldWrite = MeasureMicroseconds(InIterations, [&InSample]()
+		{
+			FString Result;
+			FJsonObjectConverter::UStructToJsonObjectString(InSample, Result, 0, 0, 0, nullptr, false);
+		});
+		const double NewWrite = MeasureMicroseconds(InIterations, [&InSample]()
+		{
+			FString Result;
+			FJWNU_JsonStructWriter::WriteString(InSample, Result);
+		});
+		const double NewWriteUtf8 = MeasureMicroseconds(InIterations, [&InSample]()
+		{
+			TArray<uint8> Result;
+			FJWNU_JsonStructWriter::WriteUtf8(InSample, Result);
+		});
+
+		PrintRow(*StructName, TEXT("read"), OldRead, NewRead);
+		PrintRow(*StructName, TEXT("read utf8"), OldRead, NewReadUtf8);
+		PrintRow(*StructName, TEXT("write"), OldWrite, NewWrite);
+		PrintRow(*StructName, TEXT("write utf8"), OldWrite, NewWriteUtf8);
+	}
+
+	void Run(const TArray<FString>& InArgs)
+	{
+		const int32 Iterations = InArgs.Num() > 0 ? FMath::Max(1, FCString::Atoi(*InArgs[0])) : 10000;
+		PRINT_LOG(JWLog, Display, TEXT("JSON conversion benchmark (%d iterations, average per call)"), Iterations);
+
+		FJWNU_RES_Base Base;
+		Base.Success = true;
+		Base.Code = TEXT("SUCCESS");
+		Base.Message = TEXT("Request processed successfully");
+		RunCase(Base, Iterations);
+
+		FJWNU_RES_AuthRefresh AuthRefresh;
+		AuthRefresh.Success = true;
+		AuthRefresh.Code = TEXT("SUCCESS");
+		AuthRefresh.Message = TEXT("Token refreshed");
+		AuthRefresh.AccessToken = FString::ChrN(320, TEXT('a'));
+		AuthRefresh.ExpiresAt = 1767225600;
+		AuthRefresh.RefreshToken = FString::ChrN(320, TEXT('r'));
+		AuthRefresh.RefreshTokenExpiresAt = 1769817600;
+		AuthRefresh.UserId = TEXT("user-0001");
+		RunCase(AuthRefresh, Iterations);
+
+		FJWNU_RES_Data Data;
+		Data.Success = true;
+		Data.Code = TEXT("SUCCESS");
+		Data.Message = TEXT("Data loaded");
+		Data.Data = FString::ChrN(4096, TEXT('d'));
+		RunCase(Data, Iterations);
+
+		FJWNU_REQ_AuthRefresh AuthRefreshRequest;
+		AuthRefreshRequest.UserId = TEXT("user-0001");
+		AuthRefreshRequest.TargetServer = TEXT("GameServer");
+		AuthRefreshRequest.RefreshToken = FString::ChrN(320, TEXT('r'));
+		RunCase(AuthRefreshRequest, Iterations);
+	}
+
+	// ──────── 큰 바디 처리량 ────────
+
+	/**
+	 * 대표 페이로드 하나에 대해 FJsonObjectConverter 경로, 스칼라 리더, SIMD 리더의 처리량(MB/s)을 비교한다.
+	 */
+	void RunThroughputCase(const TCHAR* InName, const FString& InJson, const UScriptStruct* InStruct, const int32 InIterations)
+	{
+		const FTCHARToUTF8 Utf8Json(*InJson);
+		const UTF8CHAR* Utf8Data = reinterpret_cast<const UTF8CHAR*>(Utf8Json.Get());
+		const int32 Utf8Num = Utf8Json.Length();
+		const double Megabytes = Utf8Num / (1024.0 * 1024.0);
+		auto Throughput = [Megabytes](const double InMicroseconds)
+		{
+			return InMicroseconds > 0.0 ? Megabytes / (InMicroseconds / 1000000.0) : 0.0;
+		};
+
+		FStructOnScope Result(InStruct);
+		const double Converter = MeasureMicroseconds(InIterations, [&]()
+		{
+			TSharedPtr<FJsonObject> JsonObject;
+			const TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(InJson);
+			if (FJsonSerializer::Deserialize(JsonReader, JsonObject) && JsonObject.IsValid())
+			{
+				FJsonObjectConverter::JsonObjectToUStruct(JsonObject.ToSharedRef(), InStruct, Result.GetStructMemory(), 0, 0);
+			}
+		});
+
+		FJWNU_JsonSimdScanner::SetSimdEnabled(false);
+		const double ScalarString = MeasureMicroseconds(InIterations, [&]()
+		{
+			FJWNU_JsonStructReader::ReadString(InJson, InStruct, Result.GetStructMemory());
+		});
+		const double ScalarUtf8 = MeasureMicroseconds(InIterations, [&]()
+		{
+			FJWNU_JsonStructReader::ReadUtf8(Utf8Data, Utf8Num, InStruct, Result.GetStructMemory());
+		});
+
+		FJWNU_JsonSimdScanner::SetSimdEnabled(true);
+		const double SimdString = MeasureMicroseconds(InIterations, [&]()
+		{
+			FJWNU_JsonStructReader::ReadString(InJson, InStruct, Result.GetStructMemory());
+		});
+		const double SimdUtf8 = MeasureMicroseconds(InIterations, [&]()
+		{
+			FJWNU_JsonStructReader::ReadUtf8(Utf8Data, Utf8Num, InStruct, Result.GetStructMemory());
+		});
+
+		PRINT_LOG(JWLog, Display, TEXT("%-18s %7.2f MB | converter %8.1f MB/s | string scalar %8.1f simd %8.1f MB/s | utf8 scalar %8.1f simd %8.1f MB/s | x%.2f vs converter"),
+			InName, Megabytes, Throughput(Converter), Throughput(ScalarString), Throughput(SimdString), Throughput(ScalarUtf8), Throughput(SimdUtf8),
+			SimdUtf8 > 0.0 ? Converter / SimdUtf8 : 0.0);
+	}
+
+	/**
+	 * 큰 바디 처리량 벤치마크. 대표 페이로드(긴 ASCII 문자열, 멀티바이트 문자열, 건너뛰는 Pretty Print 배열)마다 처리량을 비교한다.
+	 * 사용법 : JWNU.BenchmarkJsonThroughput [페이로드 크기 KB = 1024] [반복 횟수 = 20]
+	 */
+	void RunThroughput(const TArray<FString>& InArgs)
+	{
+		const int32 SizeKilobytes = InArgs.Num() > 0 ? FMath::Max(1, FCString::Atoi(*InArgs[0])) : 1024;
+		const int32 Iterations = InArgs.Num() > 1 ? FMath::Max(1, FCString::Atoi(*InArgs[1])) : 20;
+		const int32 TargetLength = SizeKilobytes * 1024;
+		const bool bWasSimdEnabled = FJWNU_JsonSimdScanner::IsSimdEnabled();
+		FJWNU_JsonSimdScanner::SetSimdEnabled(true);
+		PRINT_LOG(JWLog, Display, TEXT("JSON large-body throughput benchmark (~%d KB payloads, %d iterations, SIMD backend: %s)"), SizeKilobytes, Iterations, FJWNU_JsonSimdScanner::GetBackendName());
+
+		// 1. 긴 ASCII 문자열 필드 (Base64 데이터 블롭 등), 드문 이스케이프 포함
+		{
+			FJWNU_RES_Data Data;
+			Data.Success = true;
+			Data.Code = TEXT("SUCCESS");
+			Data.Message = TEXT("Data loaded");
+			Data.Data.Reserve(TargetLength);
+			while (Data.Data.Len() < TargetLength)
+			{
+				Data.Data.Append(TEXT("eyJpZCI6MTIzNDUsIm5hbWUiOiJwbGF5ZXIiLCJzY29yZSI6OTg3NjV9/+abcdefghijklmnopqrstuvwxyz0123456789\"quoted\"\n"));
+			}
+			FString Json;
+			FJWNU_JsonStructWriter::WriteString(Data, Json);
+			RunThroughputCase(TEXT("ascii string blob"), Json, FJWNU_RES_Data::StaticStruct(), Iterations);
+		}
+
+		// 2. 멀티바이트 문자가 많은 문자열 필드 (공지사항, 채팅 로그 등)
+		{
+			FJWNU_RES_Data Data;
+			Data.Success = true;
+			Data.Code = TEXT("SUCCESS");
+			Data.Message = TEXT("Data loaded");
+			Data.Data.Reserve(TargetLength / 2);
+			while (Data.Data.Len() * 2 < TargetLength)
+			{
+				Data.Data.Append(TEXT("오늘의 공지사항: 서버 점검이 완료되었습니다. Patch notes v1.2.3 - 밸런스 조정 및 버그 수정. "));
+			}
+			FString Json;
+			FJWNU_JsonStructWriter::WriteString(Data, Json);
+			RunThroughputCase(TEXT("unicode string"), Json, FJWNU_RES_Data::StaticStruct(), Iterations);
+		}
+
+		// 3. 구조체에 없는 큰 Pretty Print 배열을 건너뛰는 경우 (리더보드 응답에서 공통 필드만 읽기)
+		{
+			FString Json = TEXT("{\n\t\"success\": true,\n\t\"code\": \"SUCCESS\",\n\t\"message\": \"Leaderboard loaded\",\n\t\"items\": [");
+			Json.Reserve(TargetLength + 256);
+			for (int32 Rank = 1; Json.Len() < TargetLength; ++Rank)
+			{
+				Json.Appendf(TEXT("%s\n\t\t{\n\t\t\t\"rank\": %d,\n\t\t\t\"userId\": \"user-%08d\",\n\t\t\t\"nickname\": \"Player_%d\",\n\t\t\t\"score\": %d,\n\t\t\t\"updatedAt\": \"2026-01-01T00:00:00Z\"\n\t\t}"),
+					Rank > 1 ? TEXT(",") : TEXT(""), Rank, Rank, Rank, 1000000 - Rank);
+			}
+			Json.Append(TEXT("\n\t]\n}"));
+			RunThroughputCase(TEXT("pretty array skip"), Json, FJWNU_RES_Base::StaticStruct(), Iterations);
+		}
+
+		FJWNU_JsonSimdScanner::SetSimdEnabled(bWasSimdEnabled);
+	}
+}
+
+static FAutoConsoleCommand CCmdJWNU_BenchmarkJson(
+	TEXT("JWNU.BenchmarkJson"),
+	TEXT("Compare FJsonObjectConverter against the cached-schema JSON reader/writer for the built-in request/response structs.\nUsage: JWNU.BenchmarkJson [Iterations=10000]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&JWNU_JsonBenchmark_Private::Run)
+);
+
+static FAutoConsoleCommand CCmdJWNU_BenchmarkJsonThroughput(
+	TEXT("JWNU.BenchmarkJsonThroughput"),
+	TEXT("Measure large-body JSON read throughput (MB/s) of FJsonObjectConverter against the struct reader with scalar and SIMD scanning.\nUsage: JWNU.BenchmarkJsonThroughput [SizeKB=1024] [Iterations=20]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&JWNU_JsonBenchmark_Private::RunThroughput)
+);
+
+#endif
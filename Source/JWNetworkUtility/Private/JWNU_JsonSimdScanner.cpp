@@ -0,0 +1,515 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#include "JWNU_JsonSimdScanner.h"
+#include <atomic>
+
+#if PLATFORM_CPU_X86_FAMILY
+	#include <emmintrin.h>
+	#define JWNU_JSON_SIMD_SSE2 1
+	#if defined(PLATFORM_ALWAYS_HAS_AVX_2) && PLATFORM_ALWAYS_HAS_AVX_2
+		#include <immintrin.h>
+		#define JWNU_JSON_SIMD_AVX2 1
+	#endif
+#elif PLATFORM_CPU_ARM_FAMILY && PLATFORM_64BITS
+	#include <arm_neon.h>
+	#define JWNU_JSON_SIMD_NEON 1
+#endif
+
+#ifndef JWNU_JSON_SIMD_SSE2
+	#define JWNU_JSON_SIMD_SSE2 0
+#endif
+#ifndef JWNU_JSON_SIMD_AVX2
+	#define JWNU_JSON_SIMD_AVX2 0
+#endif
+#ifndef JWNU_JSON_SIMD_NEON
+	#define JWNU_JSON_SIMD_NEON 0
+#endif
+
+namespace JWNU_JsonSimdScanner_Private
+{
+	std::atomic<bool> bSimdEnabled{true};
+
+	FORCEINLINE bool UseSimd()
+	{
+		return bSimdEnabled.load(std::memory_order_relaxed);
+	}
+
+	template<typename CharType>
+	FORCEINLINE uint32 CodeUnit(const CharType* InPtr)
+	{
+		return static_cast<uint32>(*InPtr);
+	}
+
+	FORCEINLINE bool IsStringSpecial(const uint32 InChar)
+	{
+		return InChar == '"' || InChar == '\\' || InChar <= 0x1F;
+	}
+
+	FORCEINLINE bool IsWhitespace(const uint32 InChar)
+	{
+		return InChar == ' ' || InChar == '\n' || InChar == '\r' || InChar == '\t';
+	}
+
+	// ──────── Scalar ────────
+
+	template<typename CharType>
+	const CharType* FindStringSpecialScalar(const CharType* InCur, const CharType* InEnd)
+	{
+		for (; InCur < InEnd; ++InCur)
+		{
+			if (IsStringSpecial(CodeUnit(InCur)))
+			{
+				return InCur;
+			}
+		}
+		return InEnd;
+	}
+
+	template<typename CharType>
+	const CharType* SkipWhitespaceScalar(const CharType* InCur, const CharType* InEnd)
+	{
+		while (InCur < InEnd && IsWhitespace(CodeUnit(InCur)))
+		{
+			++InCur;
+		}
+		return InCur;
+	}
+
+	int32 SkipAsciiScalar(const uint8* InData, int32 InIndex, const int32 InNum)
+	{
+		while (InIndex < InNum && InData[InIndex] < 0x80)
+		{
+			++InIndex;
+		}
+		return InIndex;
+	}
+
+	/**
+	 * 멀티바이트 UTF-8 시퀀스 하나를 검사하는 함수.
+	 * @return 시퀀스 길이 (잘못된 시퀀스면 0)
+	 */
+	int32 ValidateSequence(const uint8* InSequence, const int32 InRemaining)
+	{
+		const uint8 Lead = InSequence[0];
+		if (Lead < 0x80)
+		{
+			return 1;
+		}
+
+		int32 Length;
+		uint8 MinSecond = 0x80;
+		uint8 MaxSecond = 0xBF;
+		if (Lead < 0xC2)
+		{
+			// 연속 바이트로 시작하거나 2바이트 오버롱
+			return 0;
+		}
+		if (Lead < 0xE0)
+		{
+			Length = 2;
+		}
+		else if (Lead < 0xF0)
+		{
+			Length = 3;
+			if (Lead == 0xE0) { MinSecond = 0xA0; } // 오버롱
+			if (Lead == 0xED) { MaxSecond = 0x9F; } // 서로게이트
+		}
+		else if (Lead < 0xF5)
+		{
+			Length = 4;
+			if (Lead == 0xF0) { MinSecond = 0x90; } // 오버롱
+			if (Lead == 0xF4) { MaxSecond = 0x8F; } // U+10FFFF 초과
+		}
+		else
+		{
+			return 0;
+		}
+
+		if (InRemaining < Length || InSequence[1] < MinSecond || InSequence[1] > MaxSecond)
+		{
+			return 0;
+		}
+		for (int32 Index = 2; Index < Length; ++Index)
+		{
+			if ((InSequence[Index] & 0xC0) != 0x80)
+			{
+				return 0;
+			}
+		}
+		return Length;
+	}
+
+	// ──────── SSE2 / AVX2 ────────
+
+#if JWNU_JSON_SIMD_SSE2
+	template<typename CharType>
+	FORCEINLINE __m128i Broadcast(const uint32 InChar)
+	{
+		if constexpr (sizeof(CharType) == 1)
+		{
+			return _mm_set1_epi8(static_cast<char>(InChar));
+		}
+		else if constexpr (sizeof(CharType) == 2)
+		{
+			return _mm_set1_epi16(static_cast<short>(InChar));
+		}
+		else
+		{
+			return _mm_set1_epi32(static_cast<int32>(InChar));
+		}
+	}
+
+	template<typename CharType>
+	FORCEINLINE __m128i CompareEqual(const __m128i InA, const __m128i InB)
+	{
+		if constexpr (sizeof(CharType) == 1)
+		{
+			return _mm_cmpeq_epi8(InA, InB);
+		}
+		else if constexpr (sizeof(CharType) == 2)
+		{
+			return _mm_cmpeq_epi16(InA, InB);
+		}
+		else
+		{
+			return _mm_cmpeq_epi32(InA, InB);
+		}
+	}
+
+	/**
+	 * 0x1F 이하 코드 유닛 마스크. SSE2에는 부호 없는 비교가 없으므로 폭마다 다른 방법을 쓴다.
+	 */
+	template<typename CharType>
+	FORCEINLINE __m128i ControlMask(const __m128i InChunk)
+	{
+		if constexpr (sizeof(CharType) == 1)
+		{
+			return _mm_cmpeq_epi8(_mm_min_epu8(InChunk, _mm_set1_epi8(0x1F)), InChunk);
+		}
+		else if constexpr (sizeof(CharType) == 2)
+		{
+			return _mm_cmpeq_epi16(_mm_subs_epu16(InChunk, _mm_set1_epi16(0x1F)), _mm_setzero_si128());
+		}
+		else
+		{
+			return _mm_cmplt_epi32(InChunk, _mm_set1_epi32(0x20));
+		}
+	}
+
+	template<typename CharType>
+	const CharType* FindStringSpecialSse2(const CharType* InCur, const CharType* InEnd)
+	{
+		constexpr int32 Lanes = 16 / sizeof(CharType);
+		const __m128i Quote = Broadcast<CharType>('"');
+		const __m128i Backslash = Broadcast<CharType>('\\');
+		while (InEnd - InCur >= Lanes)
+		{
+			const __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(InCur));
+			const __m128i Special = _mm_or_si128(_mm_or_si128(CompareEqual<CharType>(Chunk, Quote), CompareEqual<CharType>(Chunk, Backslash)), ControlMask<CharType>(Chunk));
+			const uint32 Mask = static_cast<uint32>(_mm_movemask_epi8(Special));
+			if (Mask != 0)
+			{
+				return InCur + FMath::CountTrailingZeros(Mask) / sizeof(CharType);
+			}
+			InCur += Lanes;
+		}
+		return FindStringSpecialScalar(InCur, InEnd);
+	}
+
+	template<typename CharType>
+	const CharType* SkipWhitespaceSse2(const CharType* InCur, const CharType* InEnd)
+	{
+		constexpr int32 Lanes = 16 / sizeof(CharType);
+		const __m128i Space = Broadcast<CharType>(' ');
+		const __m128i Tab = Broadcast<CharType>('\t');
+		const __m128i LineFeed = Broadcast<CharType>('\n');
+		const __m128i CarriageReturn = Broadcast<CharType>('\r');
+		while (InEnd - InCur >= Lanes)
+		{
+			const __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(InCur));
+			const __m128i Whitespace = _mm_or_si128(
+				_mm_or_si128(CompareEqual<CharType>(Chunk, Space), CompareEqual<CharType>(Chunk, Tab)),
+				_mm_or_si128(CompareEqual<CharType>(Chunk, LineFeed), CompareEqual<CharType>(Chunk, CarriageReturn)));
+			const uint32 Mask = ~static_cast<uint32>(_mm_movemask_epi8(Whitespace)) & 0xFFFF;
+			if (Mask != 0)
+			{
+				return InCur + FMath::CountTrailingZeros(Mask) / sizeof(CharType);
+			}
+			InCur += Lanes;
+		}
+		return SkipWhitespaceScalar(InCur, InEnd);
+	}
+
+	int32 SkipAsciiSse2(const uint8* InData, int32 InIndex, const int32 InNum)
+	{
+		while (InNum - InIndex >= 16)
+		{
+			const uint32 Mask = static_cast<uint32>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(InData + InIndex))));
+			if (Mask != 0)
+			{
+				return InIndex + FMath::CountTrailingZeros(Mask);
+			}
+			InIndex += 16;
+		}
+		return SkipAsciiScalar(InData, InIndex, InNum);
+	}
+#endif
+
+#if JWNU_JSON_SIMD_AVX2
+	const UTF8CHAR* FindStringSpecialAvx2(const UTF8CHAR* InCur, const UTF8CHAR* InEnd)
+	{
+		const __m256i Quote = _mm256_set1_epi8('"');
+		const __m256i Backslash = _mm256_set1_epi8('\\');
+		const __m256i Control = _mm256_set1_epi8(0x1F);
+		while (InEnd - InCur >= 32)
+		{
+			const __m256i Chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(InCur));
+			const __m256i Special = _mm256_or_si256(
+				_mm256_or_si256(_mm256_cmpeq_epi8(Chunk, Quote), _mm256_cmpeq_epi8(Chunk, Backslash)),
+				_mm256_cmpeq_epi8(_mm256_min_epu8(Chunk, Control), Chunk));
+			const uint32 Mask = static_cast<uint32>(_mm256_movemask_epi8(Special));
+			if (Mask != 0)
+			{
+				return InCur + FMath::CountTrailingZeros(Mask);
+			}
+			InCur += 32;
+		}
+		return FindStringSpecialSse2(InCur, InEnd);
+	}
+
+	int32 SkipAsciiAvx2(const uint8* InData, int32 InIndex, const int32 InNum)
+	{
+		while (InNum - InIndex >= 32)
+		{
+			const uint32 Mask = static_cast<uint32>(_mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(InData + InIndex))));
+			if (Mask != 0)
+			{
+				return InIndex + FMath::CountTrailingZeros(Mask);
+			}
+			InIndex += 32;
+		}
+		return SkipAsciiSse2(InData, InIndex, InNum);
+	}
+#endif
+
+	// ──────── NEON ────────
+
+#if JWNU_JSON_SIMD_NEON
+	/**
+	 * NEON에는 movemask가 없으므로 블록 단위로 존재 여부만 확인하고, 찾은 블록 안에서는 스칼라로 위치를 구한다.
+	 */
+	template<typename CharType>
+	FORCEINLINE bool BlockHasStringSpecial(const CharType* InCur)
+	{
+		if constexpr (sizeof(CharType) == 1)
+		{
+			const uint8x16_t Chunk = vld1q_u8(reinterpret_cast<const uint8*>(InCur));
+			const uint8x16_t Special = vorrq_u8(vorrq_u8(vceqq_u8(Chunk, vdupq_n_u8('"')), vceqq_u8(Chunk, vdupq_n_u8('\\'))), vcleq_u8(Chunk, vdupq_n_u8(0x1F)));
+			return vmaxvq_u8(Special) != 0;
+		}
+		else if constexpr (sizeof(CharType) == 2)
+		{
+			const uint16x8_t Chunk = vld1q_u16(reinterpret_cast<const uint16*>(InCur));
+			const uint16x8_t Special = vorrq_u16(vorrq_u16(vceqq_u16(Chunk, vdupq_n_u16('"')), vceqq_u16(Chunk, vdupq_n_u16('\\'))), vcleq_u16(Chunk, vdupq_n_u16(0x1F)));
+			return vmaxvq_u16(Special) != 0;
+		}
+		else
+		{
+			const uint32x4_t Chunk = vld1q_u32(reinterpret_cast<const uint32*>(InCur));
+			const uint32x4_t Special = vorrq_u32(vorrq_u32(vceqq_u32(Chunk, vdupq_n_u32('"')), vceqq_u32(Chunk, vdupq_n_u32('\\'))), vcleq_u32(Chunk, vdupq_n_u32(0x1F)));
+			return vmaxvq_u32(Special) != 0;
+		}
+	}
+
+	template<typename CharType>
+	FORCEINLINE bool BlockIsAllWhitespace(const CharType* InCur)
+	{
+		if constexpr (sizeof(CharType) == 1)
+		{
+			const uint8x16_t Chunk = vld1q_u8(reinterpret_cast<const uint8*>(InCur));
+			const uint8x16_t Whitespace = vorrq_u8(vorrq_u8(vceqq_u8(Chunk, vdupq_n_u8(' ')), vceqq_u8(Chunk, vdupq_n_u8('\t'))), vorrq_u8(vceqq_u8(Chunk, vdupq_n_u8('\n')), vceqq_u8(Chunk, vdupq_n_u8('\r'))));
+			return vminvq_u8(Whitespace) != 0;
+		}
+		else if constexpr (sizeof(CharType) == 2)
+		{
+			const uint16x8_t Chunk = vld1q_u16(reinterpret_cast<const uint16*>(InCur));
+			const uint16x8_t Whitespace = vorrq_u16(vorrq_u16(vceqq_u16(Chunk, vdupq_n_u16(' ')), vceqq_u16(Chunk, vdupq_n_u16('\t'))), vorrq_u16(vceqq_u16(Chunk, vdupq_n_u16('\n')), vceqq_u16(Chunk, vdupq_n_u16('\r'))));
+			return vminvq_u16(Whitespace) != 0;
+		}
+		else
+		{
+			const uint32x4_t Chunk = vld1q_u32(reinterpret_cast<const uint32*>(InCur));
+			const uint32x4_t Whitespace = vorrq_u32(vorrq_u32(vceqq_u32(Chunk, vdupq_n_u32(' ')), vceqq_u32(Chunk, vdupq_n_u32('\t'))), vorrq_u32(vceqq_u32(Chunk, vdupq_n_u32('\n')), vceqq_u32(Chunk, vdupq_n_u32('\r'))));
+			return vminvq_u32(Whitespace) != 0;
+		}
+	}
+
+	template<typename CharType>
+	const CharType* FindStringSpecialNeon(const CharType* InCur, const CharType* InEnd)
+	{
+		constexpr int32 Lanes = 16 / sizeof(CharType);
+		while (InEnd - InCur >= Lanes)
+		{
+			if (BlockHasStringSpecial(InCur))
+			{
+				return FindStringSpecialScalar(InCur, InCur + Lanes);
+			}
+			InCur += Lanes;
+		}
+		return FindStringSpecialScalar(InCur, InEnd);
+	}
+
+	template<typename CharType>
+	const CharType* SkipWhitespaceNeon(const CharType* InCur, const CharType* InEnd)
+	{
+		constexpr int32 Lanes = 16 / sizeof(CharType);
+		while (InEnd - InCur >= Lanes)
+		{
+			if (BlockIsAllWhitespace(InCur) == false)
+			{
+				return SkipWhitespaceScalar(InCur, InCur + Lanes);
+			}
+			InCur += Lanes;
+		}
+		return SkipWhitespaceScalar(InCur, InEnd);
+	}
+
+	int32 SkipAsciiNeon(const uint8* InData, int32 InIndex, const int32 InNum)
+	{
+		while (InNum - InIndex >= 16)
+		{
+			if (vmaxvq_u8(vld1q_u8(InData + InIndex)) >= 0x80)
+			{
+				return SkipAsciiScalar(InData, InIndex, InIndex + 16);
+			}
+			InIndex += 16;
+		}
+		return SkipAsciiScalar(InData, InIndex, InNum);
+	}
+#endif
+
+	// ──────── Dispatch ────────
+
+	template<typename CharType>
+	const CharType* FindStringSpecial(const CharType* InCur, const CharType* InEnd)
+	{
+		if (UseSimd())
+		{
+#if JWNU_JSON_SIMD_AVX2
+			if constexpr (sizeof(CharType) == 1)
+			{
+				return FindStringSpecialAvx2(InCur, InEnd);
+			}
+#endif
+#if JWNU_JSON_SIMD_SSE2
+			return FindStringSpecialSse2(InCur, InEnd);
+#elif JWNU_JSON_SIMD_NEON
+			return FindStringSpecialNeon(InCur, InEnd);
+#endif
+		}
+		return FindStringSpecialScalar(InCur, InEnd);
+	}
+
+	template<typename CharType>
+	const CharType* SkipWhitespace(const CharType* InCur, const CharType* InEnd)
+	{
+		if (UseSimd())
+		{
+#if JWNU_JSON_SIMD_SSE2
+			return SkipWhitespaceSse2(InCur, InEnd);
+#elif JWNU_JSON_SIMD_NEON
+			return SkipWhitespaceNeon(InCur, InEnd);
+#endif
+		}
+		return SkipWhitespaceScalar(InCur, InEnd);
+	}
+
+	int32 SkipAscii(const uint8* InData, const int32 InIndex, const int32 InNum)
+	{
+		if (UseSimd())
+		{
+#if JWNU_JSON_SIMD_AVX2
+			return SkipAsciiAvx2(InData, InIndex, InNum);
+#elif JWNU_JSON_SIMD_SSE2
+			return SkipAsciiSse2(InData, InIndex, InNum);
+#elif JWNU_JSON_SIMD_NEON
+			return SkipAsciiNeon(InData, InIndex, InNum);
+#endif
+		}
+		return SkipAsciiScalar(InData, InIndex, InNum);
+	}
+}
+
+const UTF8CHAR* FJWNU_JsonSimdScanner::FindStringSpecial(const UTF8CHAR* InCur, const UTF8CHAR* InEnd)
+{
+	return JWNU_JsonSimdScanner_Private::FindStringSpecial(InCur, InEnd);
+}
+
+const TCHAR* FJWNU_JsonSimdScanner::FindStringSpecial(const TCHAR* InCur, const TCHAR* InEnd)
+{
+	return JWNU_JsonSimdScanner_Private::FindStringSpecial(InCur, InEnd);
+}
+
+const UTF8CHAR* FJWNU_JsonSimdScanner::SkipWhitespace(const UTF8CHAR* InCur, const UTF8CHAR* InEnd)
+{
+	return JWNU_JsonSimdScanner_Private::SkipWhitespace(InCur, InEnd);
+}
+
+const TCHAR* FJWNU_JsonSimdScanner::SkipWhitespace(const TCHAR* InCur, const TCHAR* InEnd)
+{
+	return JWNU_JsonSimdScanner_Private::SkipWhitespace(InCur, InEnd);
+}
+
+bool FJWNU_JsonSimdScanner::ValidateUtf8(const UTF8CHAR* InData, const int32 InNum, int32* OutErrorOffset)
+{
+	const uint8* Data = reinterpret_cast<const uint8*>(InData);
+	int32 Index = 0;
+	while (Index < InNum)
+	{
+		// ASCII 구간은 레지스터 폭 단위로 건너뛴다
+		Index = JWNU_JsonSimdScanner_Private::SkipAscii(Data, Index, InNum);
+		if (Index >= InNum)
+		{
+			break;
+		}
+
+		const int32 SequenceLength = JWNU_JsonSimdScanner_Private::ValidateSequence(Data + Index, InNum - Index);
+		if (SequenceLength == 0)
+		{
+			if (OutErrorOffset != nullptr)
+			{
+				*OutErrorOffset = Index;
+			}
+			return false;
+		}
+		Index += SequenceLength;
+	}
+	return true;
+}
+
+void FJWNU_JsonSimdScanner::SetSimdEnabled(const bool bInEnabled)
+{
+	JWNU_JsonSimdScanner_Private::bSimdEnabled.store(bInEnabled, std::memory_order_relaxed);
+}
+
+bool FJWNU_JsonSimdScanner::IsSimdEnabled()
+{
+	return JWNU_JsonSimdScanner_Private::UseSimd();
+}
+
+const TCHAR* FJWNU_JsonSimdScanner::GetBackendName()
+{
+	if (IsSimdEnabled() == false)
+	{
+		return TEXT("Scalar");
+	}
+#if JWNU_JSON_SIMD_AVX2
+	return TEXT("AVX2");
+#elif JWNU_JSON_SIMD_SSE2
+	return TEXT("SSE2");
+#elif JWNU_JSON_SIMD_NEON
+	return TEXT("NEON");
+#else
+	return TEXT("Scalar");
+#endif
+}
@@ -0,0 +1,1000 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#include "JWNU_JsonStructReader.h"
+#include "JWNetworkUtility.h"
+#include "JWNU_JsonStructSchema.h"
+#include "JWNU_JsonSimdScanner.h"
+#include "JsonObjectConverter.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/UnrealType.h"
+
+DEFINE_LOG_CATEGORY(LogJWNU_JsonStructReader);
+
+namespace JWNU_JsonStructReader_Private
+{
+	/** 중첩 객체-배열 최대 깊이. 악의적인 입력으로 인한 스택 오버플로 방지 */
+	constexpr int32 MaxDepth = 256;
+
+	/** 숫자 토큰 최대 길이 */
+	constexpr int32 MaxNumberLength = 63;
+
+	/**
+	 * JSON 텍스트를 한 번만 훑으며 프로퍼티 메모리에 직접 기록하는 재귀 하강 파서.
+	 * @tparam CharType UTF8CHAR 또는 TCHAR
+	 */
+	template<typename CharType>
+	class TJsonStructParser
+	{
+	public:
+		TJsonStructParser(const CharType* InBegin, const CharType* InEnd)
+			: Begin(InBegin), Cur(InBegin), End(InEnd)
+		{
+		}
+
+		bool ParseRoot(const UStruct* InStruct, void* OutStructData)
+		{
+			SkipWhitespace();
+			if (Peek() != '{')
+			{
+				return FailSyntax(TEXT("Root value must be an object"));
+			}
+			if (ParseObject(InStruct, OutStructData) == false)
+			{
+				return false;
+			}
+			SkipWhitespace();
+			if (Cur != End)
+			{
+				return FailSyntax(TEXT("Unexpected trailing characters"));
+			}
+			return true;
+		}
+
+		FJWNU_JsonReadError Error;
+
+	private:
+		const CharType* Begin;
+		const CharType* Cur;
+		const CharType* End;
+		int32 Depth = 0;
+
+		// ──────── Lexing ────────
+
+		FORCEINLINE uint32 Peek() const
+		{
+			return Cur < End ? static_cast<uint32>(*Cur) : 0;
+		}
+
+		static FORCEINLINE bool IsWhitespace(const uint32 InChar)
+		{
+			return InChar == ' ' || InChar == '\n' || InChar == '\r' || InChar == '\t';
+		}
+
+		FORCEINLINE void SkipWhitespace()
+		{
+			// 토큰 사이 공백은 대부분 없거나 한 글자이므로 스칼라로 확인하고, 들여쓰기처럼 긴 구간만 SIMD 스캐너에 맡긴다
+			if (Cur < End && IsWhitespace(static_cast<uint32>(*Cur)))
+			{
+				++Cur;
+				if (Cur < End && IsWhitespace(static_cast<uint32>(*Cur)))
+				{
+					Cur = FJWNU_JsonSimdScanner::SkipWhitespace(Cur, End);
+				}
+			}
+		}
+
+		FORCEINLINE bool Consume(const uint32 InChar)
+		{
+			if (Peek() == InChar)
+			{
+				++Cur;
+				return true;
+			}
+			return false;
+		}
+
+		bool ConsumeLiteral(const ANSICHAR* InLiteral)
+		{
+			for (const ANSICHAR* Char = InLiteral; *Char; ++Char)
+			{
+				if (Peek() != static_cast<uint32>(*Char))
+				{
+					return FailSyntax(TEXT("Invalid literal"));
+				}
+				++Cur;
+			}
+			return true;
+		}
+
+		bool FailSyntax(const TCHAR* InMessage)
+		{
+			return Fail(InMessage, true);
+		}
+
+		bool FailConversion(const TCHAR* InMessage)
+		{
+			return Fail(InMessage, false);
+		}
+
+		bool Fail(const TCHAR* InMessage, const bool bInSyntaxError)
+		{
+			// 최초 실패 지점만 기록
+			if (Error.Message.IsEmpty())
+			{
+				Error.bSyntaxError = bInSyntaxError;
+				Error.Offset = static_cast<int32>(Cur - Begin);
+				Error.Message = InMessage;
+			}
+			return false;
+		}
+
+		static void AppendRun(FString& OutString, const CharType* InStart, const CharType* InEnd)
+		{
+			const int32 Length = static_cast<int32>(InEnd - InStart);
+			if (Length <= 0)
+			{
+				return;
+			}
+			if constexpr (sizeof(CharType) == sizeof(TCHAR))
+			{
+				OutString.AppendChars(reinterpret_cast<const TCHAR*>(InStart), Length);
+			}
+			else
+			{
+				const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(InStart), Length);
+				OutString.AppendChars(Converted.Get(), Converted.Length());
+			}
+		}
+
+		static int32 HexValue(const uint32 InChar)
+		{
+			if (InChar >= '0' && InChar <= '9') return InChar - '0';
+			if (InChar >= 'a' && InChar <= 'f') return InChar - 'a' + 10;
+			if (InChar >= 'A' && InChar <= 'F') return InChar - 'A' + 10;
+			return INDEX_NONE;
+		}
+
+		bool ParseHex4(uint32& OutCodeUnit)
+		{
+			if (End - Cur < 4)
+			{
+				return FailSyntax(TEXT("Truncated unicode escape"));
+			}
+			OutCodeUnit = 0;
+			for (int32 Index = 0; Index < 4; ++Index)
+			{
+				const int32 Digit = HexValue(static_cast<uint32>(*Cur++));
+				if (Digit == INDEX_NONE)
+				{
+					return FailSyntax(TEXT("Invalid unicode escape"));
+				}
+				OutCodeUnit = (OutCodeUnit << 4) | static_cast<uint32>(Digit);
+			}
+			return true;
+		}
+
+		/**
+		 * 따옴표로 시작하는 JSON 문자열을 디코딩하는 함수. 이스케이프가 없는 구간은 SIMD 스캐너로 건너뛰고 한 번에 복사한다.
+		 */
+		bool ParseString(FString& OutString)
+		{
+			++Cur;
+			OutString.Reset();
+			const CharType* RunStart = Cur;
+			while (Cur < End)
+			{
+				Cur = FJWNU_JsonSimdScanner::FindStringSpecial(Cur, End);
+				if (Cur == End)
+				{
+					break;
+				}
+				const uint32 Char = static_cast<uint32>(*Cur);
+				if (Char == '"')
+				{
+					AppendRun(OutString, RunStart, Cur);
+					++Cur;
+					return true;
+				}
+				if (Char != '\\')
+				{
+					return FailSyntax(TEXT("Unescaped control character in string"));
+				}
+
+				AppendRun(OutString, RunStart, Cur);
+				++Cur;
+				switch (Peek())
+				{
+				case '"':  OutString.AppendChar(TEXT('"'));  ++Cur; break;
+				case '\\': OutString.AppendChar(TEXT('\\')); ++Cur; break;
+				case '/':  OutString.AppendChar(TEXT('/'));  ++Cur; break;
+				case 'b':  OutString.AppendChar(TEXT('\b')); ++Cur; break;
+				case 'f':  OutString.AppendChar(TEXT('\f')); ++Cur; break;
+				case 'n':  OutString.AppendChar(TEXT('\n')); ++Cur; break;
+				case 'r':  OutString.AppendChar(TEXT('\r')); ++Cur; break;
+				case 't':  OutString.AppendChar(TEXT('\t')); ++Cur; break;
+				case 'u':
+					{
+						++Cur;
+						uint32 CodeUnit = 0;
+						if (ParseHex4(CodeUnit) == false)
+						{
+							return false;
+						}
+						// TCHAR는 UTF-16 코드 유닛이므로 서로게이트 쌍은 그대로 이어 붙인다
+						OutString.AppendChar(static_cast<TCHAR>(CodeUnit));
+						break;
+					}
+				default:
+					return FailSyntax(TEXT("Invalid escape sequence"));
+				}
+				RunStart = Cur;
+			}
+			return FailSyntax(TEXT("Unterminated string"));
+		}
+
+		/**
+		 * 역슬래시 다음의 이스케이프 시퀀스 하나를 디코딩 없이 검증하며 건너뛰는 함수.
+		 */
+		bool SkipEscape()
+		{
+			switch (Peek())
+			{
+			case '"': case '\\': case '/': case 'b': case 'f': case 'n': case 'r': case 't':
+				++Cur;
+				return true;
+			case 'u':
+				{
+					++Cur;
+					uint32 CodeUnit = 0;
+					return ParseHex4(CodeUnit);
+				}
+			default:
+				return FailSyntax(TEXT("Invalid escape sequence"));
+			}
+		}
+
+		bool SkipString()
+		{
+			++Cur;
+			while (Cur < End)
+			{
+				Cur = FJWNU_JsonSimdScanner::FindStringSpecial(Cur, End);
+				if (Cur == End)
+				{
+					break;
+				}
+				const uint32 Char = static_cast<uint32>(*Cur);
+				if (Char == '"')
+				{
+					++Cur;
+					return true;
+				}
+				if (Char != '\\')
+				{
+					return FailSyntax(TEXT("Unescaped control character in string"));
+				}
+				++Cur;
+				if (SkipEscape() == false)
+				{
+					return false;
+				}
+			}
+			return FailSyntax(TEXT("Unterminated string"));
+		}
+
+		static FORCEINLINE bool IsDigit(const uint32 InChar)
+		{
+			return InChar >= '0' && InChar <= '9';
+		}
+
+		bool AppendNumberChar(ANSICHAR* OutBuffer, int32& InOutLength)
+		{
+			if (InOutLength >= MaxNumberLength)
+			{
+				return FailSyntax(TEXT("Number token too long"));
+			}
+			OutBuffer[InOutLength++] = static_cast<ANSICHAR>(*Cur++);
+			return true;
+		}
+
+		bool AppendDigits(ANSICHAR* OutBuffer, int32& InOutLength)
+		{
+			if (IsDigit(Peek()) == false)
+			{
+				return FailSyntax(TEXT("Expected digit in number"));
+			}
+			while (IsDigit(Peek()))
+			{
+				if (AppendNumberChar(OutBuffer, InOutLength) == false)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/**
+		 * 숫자 토큰을 읽는 함수. RFC 8259 문법 -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)? 을 벗어나면 실패한다.
+		 */
+		bool ParseNumber(double& OutDouble, int64& OutInt, uint64& OutUInt, bool& bOutIsInteger)
+		{
+			ANSICHAR Buffer[MaxNumberLength + 1];
+			int32 Length = 0;
+			bOutIsInteger = true;
+
+			// 부호 (음수만 허용)
+			if (Peek() == '-' && AppendNumberChar(Buffer, Length) == false)
+			{
+				return false;
+			}
+
+			// 정수부 (0으로 시작하면 그 한 자리만)
+			if (Peek() == '0')
+			{
+				if (AppendNumberChar(Buffer, Length) == false)
+				{
+					return false;
+				}
+				if (IsDigit(Peek()))
+				{
+					return FailSyntax(TEXT("Leading zeros are not allowed"));
+				}
+			}
+			else if (AppendDigits(Buffer, Length) == false)
+			{
+				return false;
+			}
+
+			// 소수부
+			if (Peek() == '.')
+			{
+				bOutIsInteger = false;
+				if (AppendNumberChar(Buffer, Length) == false || AppendDigits(Buffer, Length) == false)
+				{
+					return false;
+				}
+			}
+
+			// 지수부
+			if (Peek() == 'e' || Peek() == 'E')
+			{
+				bOutIsInteger = false;
+				if (AppendNumberChar(Buffer, Length) == false)
+				{
+					return false;
+				}
+				if ((Peek() == '+' || Peek() == '-') && AppendNumberChar(Buffer, Length) == false)
+				{
+					return false;
+				}
+				if (AppendDigits(Buffer, Length) == false)
+				{
+					return false;
+				}
+			}
+			Buffer[Length] = '\0';
+
+			OutDouble = FCStringAnsi::Atod(Buffer);
+			if (bOutIsInteger)
+			{
+				OutInt = FCStringAnsi::Strtoi64(Buffer, nullptr, 10);
+				OutUInt = FCStringAnsi::Strtoui64(Buffer, nullptr, 10);
+			}
+			return true;
+		}
+
+		/**
+		 * 값 하나를 대상 없이 건너뛰는 함수. (구조체에 없는 키)
+		 */
+		bool SkipValue()
+		{
+			SkipWhitespace();
+			const uint32 Char = Peek();
+			if (Char == '"')
+			{
+				return SkipString();
+			}
+			if (Char == '{')
+			{
+				return SkipObject();
+			}
+			if (Char == '[')
+			{
+				// 원소마다 값 문법을 검증하므로 괄호 짝과 구분자가 어긋나면 실패한다
+				return ParseElements([this]()
+				{
+					return SkipValue();
+				});
+			}
+			if (Char == 't') return ConsumeLiteral("true");
+			if (Char == 'f') return ConsumeLiteral("false");
+			if (Char == 'n') return ConsumeLiteral("null");
+			if (Char == '-' || (Char >= '0' && Char <= '9'))
+			{
+				double Double; int64 Int; uint64 UInt; bool bIsInteger;
+				return ParseNumber(Double, Int, UInt, bIsInteger);
+			}
+			return FailSyntax(TEXT("Unexpected character"));
+		}
+
+		/**
+		 * '{'에서 시작하는 객체를 대상 없이 문법만 검증하며 건너뛰는 함수.
+		 */
+		bool SkipObject()
+		{
+			if (++Depth > MaxDepth)
+			{
+				return FailSyntax(TEXT("Maximum nesting depth exceeded"));
+			}
+			++Cur;
+			SkipWhitespace();
+			if (Consume('}'))
+			{
+				--Depth;
+				return true;
+			}
+			while (true)
+			{
+				SkipWhitespace();
+				if (Peek() != '"')
+				{
+					return FailSyntax(TEXT("Expected object key"));
+				}
+				if (SkipString() == false)
+				{
+					return false;
+				}
+				SkipWhitespace();
+				if (Consume(':') == false)
+				{
+					return FailSyntax(TEXT("Expected ':' after object key"));
+				}
+				if (SkipValue() == false)
+				{
+					return false;
+				}
+				SkipWhitespace();
+				if (Consume(','))
+				{
+					continue;
+				}
+				if (Consume('}'))
+				{
+					--Depth;
+					return true;
+				}
+				return FailSyntax(TEXT("Expected ',' or '}' in object"));
+			}
+		}
+
+		// ──────── Struct Binding ────────
+
+		/**
+		 * '{'에서 시작하는 객체를 구조체 메모리에 기록하는 함수.
+		 */
+		bool ParseObject(const UStruct* InStruct, void* OutStructData)
+		{
+			if (++Depth > MaxDepth)
+			{
+				return FailSyntax(TEXT("Maximum nesting depth exceeded"));
+			}
+
+			const TSharedRef<const FJWNU_JsonStructSchema, ESPMode::ThreadSafe> Schema = FJWNU_JsonStructSchema::Get(InStruct);
+			++Cur;
+			SkipWhitespace();
+			if (Consume('}'))
+			{
+				--Depth;
+				return true;
+			}
+
+			FString EscapedKey;
+			while (true)
+			{
+				SkipWhitespace();
+				if (Peek() != '"')
+				{
+					return FailSyntax(TEXT("Expected object key"));
+				}
+
+				// 키는 이스케이프가 없다면 원본 구간 그대로 해시-비교 (이스케이프나 제어 문자가 있으면 ParseString에서 디코딩-검증)
+				const FJWNU_JsonField* Field = nullptr;
+				const CharType* KeyStart = Cur + 1;
+				const CharType* Scan = KeyStart;
+				uint32 Hash = FJWNU_JsonStructSchema::HashSeed;
+				bool bEscaped = false;
+				while (Scan < End && static_cast<uint32>(*Scan) != '"')
+				{
+					if (static_cast<uint32>(*Scan) == '\\' || static_cast<uint32>(*Scan) < 0x20)
+					{
+						bEscaped = true;
+						break;
+					}
+					Hash = FJWNU_JsonStructSchema::HashKeyChar(Hash, static_cast<uint32>(*Scan));
+					++Scan;
+				}
+				if (bEscaped)
+				{
+					if (ParseString(EscapedKey) == false)
+					{
+						return false;
+					}
+					Field = Schema->FindField(EscapedKey);
+				}
+				else
+				{
+					if (Scan >= End)
+					{
+						return FailSyntax(TEXT("Unterminated object key"));
+					}
+					Field = Schema->FindField(KeyStart, static_cast<int32>(Scan - KeyStart), Hash);
+					Cur = Scan + 1;
+				}
+
+				SkipWhitespace();
+				if (Consume(':') == false)
+				{
+					return FailSyntax(TEXT("Expected ':' after object key"));
+				}
+				SkipWhitespace();
+
+				if (Field != nullptr)
+				{
+					if (ParseField(*Field, OutStructData) == false)
+					{
+						return false;
+					}
+				}
+				else if (SkipValue() == false)
+				{
+					return false;
+				}
+
+				SkipWhitespace();
+				if (Consume(','))
+				{
+					continue;
+				}
+				if (Consume('}'))
+				{
+					--Depth;
+					return true;
+				}
+				return FailSyntax(TEXT("Expected ',' or '}' in object"));
+			}
+		}
+
+		/**
+		 * 필드 하나의 값을 기록하는 함수. 고정 크기 배열(ArrayDim > 1)은 JSON 배열에서 채운다.
+		 */
+		bool ParseField(const FJWNU_JsonField& InField, void* OutStructData)
+		{
+			if (InField.ArrayDim == 1 || Peek() != '[')
+			{
+				return ParseValue(InField.Handler, InField.GetValuePtr(OutStructData));
+			}
+
+			++Cur;
+			int32 Index = 0;
+			SkipWhitespace();
+			if (Consume(']'))
+			{
+				return true;
+			}
+			while (true)
+			{
+				SkipWhitespace();
+				if (Index < InField.ArrayDim)
+				{
+					if (ParseValue(InField.Handler, InField.GetValuePtr(OutStructData, Index)) == false)
+					{
+						return false;
+					}
+				}
+				else if (SkipValue() == false)
+				{
+					return false;
+				}
+				++Index;
+				SkipWhitespace();
+				if (Consume(','))
+				{
+					continue;
+				}
+				if (Consume(']'))
+				{
+					return true;
+				}
+				return FailSyntax(TEXT("Expected ',' or ']' in array"));
+			}
+		}
+
+		/**
+		 * 값 하나를 타입 핸들러에 따라 기록하는 함수. null은 기본값을 유지한다.
+		 * 타입과 JSON 값 형태가 자주 쓰이는 조합이 아니라면 FJsonObjectConverter로 위임해 기존 변환 규칙을 그대로 따른다.
+		 */
+		bool ParseValue(const FJWNU_JsonTypeHandler& InHandler, void* OutValue)
+		{
+			const uint32 Char = Peek();
+			if (Char == 'n')
+			{
+				return ConsumeLiteral("null");
+			}
+
+			switch (InHandler.Kind)
+			{
+			case EJWNU_JsonValueKind::String:
+				if (Char == '"')
+				{
+					return ParseString(*static_cast<FString*>(OutValue));
+				}
+				break;
+
+			case EJWNU_JsonValueKind::Name:
+				if (Char == '"')
+				{
+					FString Value;
+					if (ParseString(Value) == false)
+					{
+						return false;
+					}
+					*static_cast<FName*>(OutValue) = FName(*Value);
+					return true;
+				}
+				break;
+
+			case EJWNU_JsonValueKind::Text:
+				if (Char == '"')
+				{
+					FString Value;
+					if (ParseString(Value) == false)
+					{
+						return false;
+					}
+					*static_cast<FText*>(OutValue) = FText::FromString(MoveTemp(Value));
+					return true;
+				}
+				break;
+
+			case EJWNU_JsonValueKind::Bool:
+				if (Char == 't' || Char == 'f')
+				{
+					const bool bValue = Char == 't';
+					if (ConsumeLiteral(bValue ? "true" : "false") == false)
+					{
+						return false;
+					}
+					// 비트필드 bool을 고려해 프로퍼티를 통해 기록
+					static_cast<const FBoolProperty*>(InHandler.Property)->SetPropertyValue(OutValue, bValue);
+					return true;
+				}
+				break;
+
+			case EJWNU_JsonValueKind::Enum:
+				if (Char == '"')
+				{
+					return ParseEnumName(InHandler, OutValue);
+				}
+				break;
+
+			case EJWNU_JsonValueKind::SignedInteger:
+			case EJWNU_JsonValueKind::UnsignedInteger:
+			case EJWNU_JsonValueKind::FloatingPoint:
+				if (Char == '-' || (Char >= '0' && Char <= '9'))
+				{
+					return ParseNumberValue(InHandler, OutValue);
+				}
+				break;
+
+			case EJWNU_JsonValueKind::Struct:
+				if (Char == '{')
+				{
+					return ParseObject(InHandler.Struct, OutValue);
+				}
+				break;
+
+			case EJWNU_JsonValueKind::Array:
+				if (Char == '[')
+				{
+					return ParseArray(InHandler, OutValue);
+				}
+				break;
+
+			case EJWNU_JsonValueKind::Set:
+				if (Char == '[')
+				{
+					return ParseSet(InHandler, OutValue);
+				}
+				break;
+
+			case EJWNU_JsonValueKind::Map:
+				if (Char == '{')
+				{
+					return ParseMap(InHandler, OutValue);
+				}
+				break;
+
+			case EJWNU_JsonValueKind::Fallback:
+				break;
+			}
+
+			return ParseWithConverter(InHandler.Property, OutValue);
+		}
+
+		bool ParseNumberValue(const FJWNU_JsonTypeHandler& InHandler, void* OutValue)
+		{
+			double Double = 0.0; int64 Int = 0; uint64 UInt = 0; bool bIsInteger = false;
+			if (ParseNumber(Double, Int, UInt, bIsInteger) == false)
+			{
+				return false;
+			}
+
+			const FNumericProperty* NumericProperty = InHandler.NumericProperty;
+			if (InHandler.Kind == EJWNU_JsonValueKind::FloatingPoint)
+			{
+				NumericProperty->SetFloatingPointPropertyValue(OutValue, Double);
+			}
+			else if (bIsInteger == false)
+			{
+				if (InHandler.Kind == EJWNU_JsonValueKind::UnsignedInteger && Double < 0.0)
+				{
+					return FailConversion(TEXT("Negative value for unsigned field"));
+				}
+				NumericProperty->SetIntPropertyValue(OutValue, static_cast<int64>(Double));
+			}
+			else if (InHandler.Kind == EJWNU_JsonValueKind::UnsignedInteger)
+			{
+				// Strtoui64는 음수를 2의 보수로 감싸므로 부호를 먼저 확인
+				if (Int < 0)
+				{
+					return FailConversion(TEXT("Negative value for unsigned field"));
+				}
+				NumericProperty->SetIntPropertyValue(OutValue, UInt);
+			}
+			else
+			{
+				NumericProperty->SetIntPropertyValue(OutValue, Int);
+			}
+			return true;
+		}
+
+		bool ParseEnumName(const FJWNU_JsonTypeHandler& InHandler, void* OutValue)
+		{
+			FString Name;
+			if (ParseString(Name) == false)
+			{
+				return false;
+			}
+			const int64 Value = InHandler.Enum->GetValueByNameString(Name);
+			if (Value == INDEX_NONE)
+			{
+				return FailConversion(TEXT("Unknown enum name"));
+			}
+			InHandler.NumericProperty->SetIntPropertyValue(OutValue, Value);
+			return true;
+		}
+
+		template<typename FAddElementFunc>
+		bool ParseElements(FAddElementFunc&& InAddElement)
+		{
+			if (++Depth > MaxDepth)
+			{
+				return FailSyntax(TEXT("Maximum nesting depth exceeded"));
+			}
+			++Cur;
+			SkipWhitespace();
+			if (Consume(']'))
+			{
+				--Depth;
+				return true;
+			}
+			while (true)
+			{
+				SkipWhitespace();
+				if (InAddElement() == false)
+				{
+					return false;
+				}
+				SkipWhitespace();
+				if (Consume(','))
+				{
+					continue;
+				}
+				if (Consume(']'))
+				{
+					--Depth;
+					return true;
+				}
+				return FailSyntax(TEXT("Expected ',' or ']' in array"));
+			}
+		}
+
+		bool ParseArray(const FJWNU_JsonTypeHandler& InHandler, void* OutValue)
+		{
+			FScriptArrayHelper Helper(static_cast<const FArrayProperty*>(InHandler.Property), OutValue);
+			Helper.EmptyValues();
+			const FJWNU_JsonTypeHandler& ElementHandler = InHandler.Children[0];
+			return ParseElements([this, &Helper, &ElementHandler]()
+			{
+				const int32 Index = Helper.AddValue();
+				return ParseValue(ElementHandler, Helper.GetRawPtr(Index));
+			});
+		}
+
+		bool ParseSet(const FJWNU_JsonTypeHandler& InHandler, void* OutValue)
+		{
+			FScriptSetHelper Helper(static_cast<const FSetProperty*>(InHandler.Property), OutValue);
+			Helper.EmptyElements();
+			const FJWNU_JsonTypeHandler& ElementHandler = InHandler.Children[0];
+			const bool bResult = ParseElements([this, &Helper, &ElementHandler]()
+			{
+				const int32 Index = Helper.AddDefaultValue_Invalid_NeedsRehash();
+				return ParseValue(ElementHandler, Helper.GetElementPtr(Index));
+			});
+			Helper.Rehash();
+			return bResult;
+		}
+
+		bool ParseMap(const FJWNU_JsonTypeHandler& InHandler, void* OutValue)
+		{
+			if (++Depth > MaxDepth)
+			{
+				return FailSyntax(TEXT("Maximum nesting depth exceeded"));
+			}
+
+			FScriptMapHelper Helper(static_cast<const FMapProperty*>(InHandler.Property), OutValue);
+			Helper.EmptyValues();
+			const FJWNU_JsonTypeHandler& KeyHandler = InHandler.Children[0];
+			const FJWNU_JsonTypeHandler& ValueHandler = InHandler.Children[1];
+			++Cur;
+			SkipWhitespace();
+			if (Consume('}'))
+			{
+				--Depth;
+				return true;
+			}
+
+			FString Key;
+			bool bResult = true;
+			while (bResult)
+			{
+				SkipWhitespace();
+				if (Peek() != '"')
+				{
+					bResult = FailSyntax(TEXT("Expected map key"));
+					break;
+				}
+				if (ParseString(Key) == false)
+				{
+					bResult = false;
+					break;
+				}
+
+				const int32 Index = Helper.AddDefaultValue_Invalid_NeedsRehash();
+				if (KeyHandler.Kind == EJWNU_JsonValueKind::String)
+				{
+					*static_cast<FString*>(static_cast<void*>(Helper.GetKeyPtr(Index))) = Key;
+				}
+				else if (KeyHandler.Property->ImportText_Direct(*Key, Helper.GetKeyPtr(Index), nullptr, PPF_None) == nullptr)
+				{
+					bResult = FailConversion(TEXT("Unable to import map key"));
+					break;
+				}
+
+				SkipWhitespace();
+				if (Consume(':') == false)
+				{
+					bResult = FailSyntax(TEXT("Expected ':' after map key"));
+					break;
+				}
+				SkipWhitespace();
+				if (ParseValue(ValueHandler, Helper.GetValuePtr(Index)) == false)
+				{
+					bResult = false;
+					break;
+				}
+
+				SkipWhitespace();
+				if (Consume(','))
+				{
+					continue;
+				}
+				if (Consume('}'))
+				{
+					break;
+				}
+				bResult = FailSyntax(TEXT("Expected ',' or '}' in map"));
+			}
+
+			Helper.Rehash();
+			--Depth;
+			return bResult;
+		}
+
+		/**
+		 * 현재 값 구간만 FJsonValue로 파싱해 FJsonObjectConverter 규칙으로 변환하는 함수. (직접 처리하지 않는 조합 전용)
+		 */
+		bool ParseWithConverter(const FProperty* InProperty, void* OutValue)
+		{
+			const CharType* ValueStart = Cur;
+			if (SkipValue() == false)
+			{
+				return false;
+			}
+
+			FString ValueText;
+			AppendRun(ValueText, ValueStart, Cur);
+
+			TSharedPtr<FJsonValue> JsonValue;
+			const TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ValueText);
+			if (FJsonSerializer::Deserialize(JsonReader, JsonValue) == false || JsonValue.IsValid() == false)
+			{
+				return FailSyntax(TEXT("Invalid JSON value"));
+			}
+			if (FJsonObjectConverter::JsonValueToUProperty(JsonValue, const_cast<FProperty*>(InProperty), OutValue, 0, 0) == false)
+			{
+				return FailConversion(TEXT("Unable to convert value to property"));
+			}
+			return true;
+		}
+	};
+
+	template<typename CharType>
+	bool Read(const CharType* InBegin, const CharType* InEnd, const UStruct* InStruct, void* OutStructData, FJWNU_JsonReadError* OutError)
+	{
+		if (InStruct == nullptr || OutStructData == nullptr)
+		{
+			if (OutError != nullptr)
+			{
+				OutError->Message = TEXT("Invalid target struct");
+			}
+			return false;
+		}
+
+		TJsonStructParser<CharType> Parser(InBegin, InEnd);
+		if (Parser.ParseRoot(InStruct, OutStructData))
+		{
+			return true;
+		}
+
+		PRINT_LOG(LogJWNU_JsonStructReader, Verbose, TEXT("Failed to read %s at offset %d: %s"), *InStruct->GetName(), Parser.Error.Offset, *Parser.Error.Message);
+		if (OutError != nullptr)
+		{
+			*OutError = MoveTemp(Parser.Error);
+		}
+		return false;
+	}
+}
+
+bool FJWNU_JsonStructReader::ReadUtf8(const UTF8CHAR* InData, const int32 InNum, const UStruct* InStruct, void* OutStructData, FJWNU_JsonReadError* OutError)
+{
+	const UTF8CHAR* Begin = InData;
+	const UTF8CHAR* End = InData + FMath::Max(InNum, 0);
+
+	// UTF-8 BOM 건너뛰기
+	if (End - Begin >= 3 && static_cast<uint8>(Begin[0]) == 0xEF && static_cast<uint8>(Begin[1]) == 0xBB && static_cast<uint8>(Begin[2]) == 0xBF)
+	{
+		Begin += 3;
+	}
+
+	// 문자열 값을 개별 변환하기 전에 전체 바이트가 올바른 UTF-8인지 한 번에 검사 (ASCII 구간은 SIMD로 건너뜀)
+	int32 InvalidOffset = INDEX_NONE;
+	if (FJWNU_JsonSimdScanner::ValidateUtf8(Begin, static_cast<int32>(End - Begin), &InvalidOffset) == false)
+	{
+		PRINT_LOG(LogJWNU_JsonStructReader, Verbose, TEXT("Invalid UTF-8 at offset %d"), InvalidOffset);
+		if (OutError != nullptr)
+		{
+			OutError->bSyntaxError = true;
+			OutError->Offset = InvalidOffset;
+			OutError->Message = TEXT("Invalid UTF-8");
+		}
+		return false;
+	}
+	return JWNU_JsonStructReader_Private::Read(Begin, End, InStruct, OutStructData, OutError);
+}
+
+bool FJWNU_JsonStructReader::ReadString(const FStringView InJson, const UStruct* InStruct, void* OutStructData, FJWNU_JsonReadError* OutError)
+{
+	return JWNU_JsonStructReader_Private::Read(InJson.GetData(), InJson.GetData() + InJson.Len(), InStruct, OutStructData, OutError);
+}
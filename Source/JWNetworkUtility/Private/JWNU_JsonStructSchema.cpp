@@ -0,0 +1,196 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#include "JWNU_JsonStructSchema.h"
+#include "JWNetworkUtility.h"
+#include "JsonObjectConverter.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/TextProperty.h"
+#include "UObject/UnrealType.h"
+
+DEFINE_LOG_CATEGORY(LogJWNU_JsonStructSchema);
+
+FJWNU_JsonTypeHandler FJWNU_JsonTypeHandler::Make(const FProperty* InProperty)
+{
+	FJWNU_JsonTypeHandler Handler;
+	Handler.Property = InProperty;
+
+	if (CastField<FStrProperty>(InProperty))
+	{
+		Handler.Kind = EJWNU_JsonValueKind::String;
+	}
+	else if (CastField<FNameProperty>(InProperty))
+	{
+		Handler.Kind = EJWNU_JsonValueKind::Name;
+	}
+	else if (CastField<FTextProperty>(InProperty))
+	{
+		Handler.Kind = EJWNU_JsonValueKind::Text;
+	}
+	else if (CastField<FBoolProperty>(InProperty))
+	{
+		Handler.Kind = EJWNU_JsonValueKind::Bool;
+	}
+	else if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(InProperty))
+	{
+		Handler.Kind = EJWNU_JsonValueKind::Enum;
+		Handler.Enum = EnumProperty->GetEnum();
+		Handler.NumericProperty = EnumProperty->GetUnderlyingProperty();
+	}
+	else if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(InProperty))
+	{
+		Handler.NumericProperty = NumericProperty;
+		if (const UEnum* Enum = NumericProperty->GetIntPropertyEnum())
+		{
+			// TEnumAsByte
+			Handler.Kind = EJWNU_JsonValueKind::Enum;
+			Handler.Enum = Enum;
+		}
+		else if (NumericProperty->IsFloatingPoint())
+		{
+			Handler.Kind = EJWNU_JsonValueKind::FloatingPoint;
+		}
+		else if (InProperty->IsA<FUInt64Property>() || InProperty->IsA<FUInt32Property>() || InProperty->IsA<FUInt16Property>() || InProperty->IsA<FByteProperty>())
+		{
+			Handler.Kind = EJWNU_JsonValueKind::UnsignedInteger;
+		}
+		else
+		{
+			Handler.Kind = EJWNU_JsonValueKind::SignedInteger;
+		}
+	}
+	else if (const FStructProperty* StructProperty = CastField<FStructProperty>(InProperty))
+	{
+		// 텍스트 임포트-익스포트를 직접 구현한 구조체(FDateTime, FJsonObjectWrapper 등)는 FJsonObjectConverter가 별도 규칙으로 다루므로 위임
+		const UScriptStruct::ICppStructOps* CppStructOps = StructProperty->Struct->GetCppStructOps();
+		if (CppStructOps == nullptr || (CppStructOps->HasImportTextItem() == false && CppStructOps->HasExportTextItem() == false))
+		{
+			Handler.Kind = EJWNU_JsonValueKind::Struct;
+			Handler.Struct = StructProperty->Struct;
+		}
+	}
+	else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(InProperty))
+	{
+		Handler.Kind = EJWNU_JsonValueKind::Array;
+		Handler.Children.Add(Make(ArrayProperty->Inner));
+	}
+	else if (const FSetProperty* SetProperty = CastField<FSetProperty>(InProperty))
+	{
+		Handler.Kind = EJWNU_JsonValueKind::Set;
+		Handler.Children.Add(Make(SetProperty->ElementProp));
+	}
+	else if (const FMapProperty* MapProperty = CastField<FMapProperty>(InProperty))
+	{
+		Handler.Kind = EJWNU_JsonValueKind::Map;
+		Handler.Children.Add(Make(MapProperty->KeyProp));
+		Handler.Children.Add(Make(MapProperty->ValueProp));
+	}
+
+	return Handler;
+}
+
+TSharedRef<const FJWNU_JsonStructSchema, ESPMode::ThreadSafe> FJWNU_JsonStructSchema::Get(const UStruct* InStruct)
+{
+	const UScriptStruct* ScriptStruct = Cast<UScriptStruct>(InStruct);
+	const bool bCacheable = ScriptStruct != nullptr && (ScriptStruct->StructFlags & STRUCT_Native) != 0;
+	if (bCacheable == false)
+	{
+		return MakeShared<const FJWNU_JsonStructSchema, ESPMode::ThreadSafe>(InStruct);
+	}
+
+	static FRWLock CacheLock;
+	static TMap<const UScriptStruct*, TSharedRef<const FJWNU_JsonStructSchema, ESPMode::ThreadSafe>> Cache;
+
+	// 대부분의 호출은 이미 캐싱된 스키마를 읽기만 한다
+	{
+		FReadScopeLock ReadLock(CacheLock);
+		if (const TSharedRef<const FJWNU_JsonStructSchema, ESPMode::ThreadSafe>* Found = Cache.Find(ScriptStruct))
+		{
+			return *Found;
+		}
+	}
+
+	// 잠금 밖에서 생성해 중첩 구조체 스키마 생성과 교착되지 않도록 한다
+	const TSharedRef<const FJWNU_JsonStructSchema, ESPMode::ThreadSafe> NewSchema = MakeShared<const FJWNU_JsonStructSchema, ESPMode::ThreadSafe>(InStruct);
+
+	FWriteScopeLock WriteLock(CacheLock);
+	if (const TSharedRef<const FJWNU_JsonStructSchema, ESPMode::ThreadSafe>* Found = Cache.Find(ScriptStruct))
+	{
+		return *Found;
+	}
+	PRINT_LOG(LogJWNU_JsonStructSchema, Verbose, TEXT("Schema cached: %s (%d fields)"), *InStruct->GetName(), NewSchema->GetFields().Num());
+	return Cache.Add(ScriptStruct, NewSchema);
+}
+
+FJWNU_JsonStructSchema::FJWNU_JsonStructSchema(const UStruct* InStruct)
+	: Struct(InStruct)
+{
+	if (InStruct == nullptr)
+	{
+		return;
+	}
+
+	for (TFieldIterator<FProperty> It(InStruct); It; ++It)
+	{
+		const FProperty* Property = *It;
+
+		// FJsonObjectConverter와 동일하게 작성자가 지정한 이름(BP 구조체의 표시 이름)을 camelCase로 변환
+		FJWNU_JsonField& Field = Fields.AddDefaulted_GetRef();
+		Field.JsonKey = FJsonObjectConverter::StandardizeCase(Property->GetAuthoredName());
+		Field.Offset = Property->GetOffset_ForInternal();
+		Field.ArrayDim = Property->ArrayDim;
+		Field.ElementSize = Property->GetElementSize();
+		Field.Handler = FJWNU_JsonTypeHandler::Make(Property);
+
+		uint32 Hash = HashSeed;
+		for (const TCHAR Char : Field.JsonKey)
+		{
+			Hash = HashKeyChar(Hash, static_cast<uint32>(Char));
+		}
+		HashToField.Add(Hash, Fields.Num() - 1);
+	}
+}
+
+const FJWNU_JsonField* FJWNU_JsonStructSchema::FindField(const FStringView InKey) const
+{
+	uint32 Hash = HashSeed;
+	for (const TCHAR Char : InKey)
+	{
+		Hash = HashKeyChar(Hash, static_cast<uint32>(Char));
+	}
+	return FindField(InKey.GetData(), InKey.Len(), Hash);
+}
+
+bool FJWNU_JsonStructSchema::KeyEquals(const FString& InJsonKey, const TCHAR* InKey, const int32 InLength)
+{
+	return InJsonKey.Len() == InLength && FCString::Strnicmp(*InJsonKey, InKey, InLength) == 0;
+}
+
+bool FJWNU_JsonStructSchema::KeyEquals(const FString& InJsonKey, const UTF8CHAR* InKey, const int32 InLength)
+{
+	// 프로퍼티 이름은 사실상 ASCII이므로 바이트 단위로 비교하고, 비ASCII가 섞이면 변환 후 비교
+	if (InJsonKey.Len() == InLength)
+	{
+		bool bAscii = true;
+		for (int32 Index = 0; Index < InLength; ++Index)
+		{
+			const uint32 KeyChar = static_cast<uint32>(InKey[Index]);
+			if (KeyChar >= 0x80)
+			{
+				bAscii = false;
+				break;
+			}
+			if (FChar::ToLower(static_cast<TCHAR>(KeyChar)) != FChar::ToLower(InJsonKey[Index]))
+			{
+				return false;
+			}
+		}
+		if (bAscii)
+		{
+			return true;
+		}
+	}
+
+	const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(InKey), InLength);
+	return KeyEquals(InJsonKey, Converted.Get(), Converted.Length());
+}
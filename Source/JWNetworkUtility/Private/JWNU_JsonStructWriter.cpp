@@ -0,0 +1,460 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#include "JWNU_JsonStructWriter.h"
+#include "JWNetworkUtility.h"
+#include "JWNU_JsonStructSchema.h"
+#include "JsonObjectConverter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/UnrealType.h"
+
+DEFINE_LOG_CATEGORY(LogJWNU_JsonStructWriter);
+
+namespace JWNU_JsonStructWriter_Private
+{
+	/**
+	 * FString에 JSON 텍스트를 이어 붙이는 출력 대상.
+	 */
+	class FStringSink
+	{
+	public:
+		explicit FStringSink(FString& InOut)
+			: Out(InOut)
+		{
+		}
+
+		/**
+		 * ASCII 문자 하나를 이어 붙인다.
+		 */
+		void AppendChar(const TCHAR InChar)
+		{
+			Out.AppendChar(InChar);
+		}
+
+		/**
+		 * 널 종료 ASCII 문자열을 이어 붙인다. (구분자, 리터럴, 숫자 전용)
+		 */
+		void AppendAscii(const TCHAR* InText)
+		{
+			Out.Append(InText);
+		}
+
+		/**
+		 * 임의의 텍스트 구간을 이어 붙인다.
+		 */
+		void AppendText(const TCHAR* InText, const int32 InNum)
+		{
+			Out.Append(InText, InNum);
+		}
+
+	private:
+		FString& Out;
+	};
+
+	/**
+	 * UTF-8 바이트 버퍼에 JSON 텍스트를 곧바로 인코딩해 이어 붙이는 출력 대상.
+	 * ASCII 구간은 바이트로 그대로 옮기고, 비 ASCII 문자가 섞인 구간만 FTCHARToUTF8로 변환한다.
+	 */
+	class FUtf8Sink
+	{
+	public:
+		explicit FUtf8Sink(TArray<uint8>& InOut)
+			: Out(InOut)
+		{
+		}
+
+		void AppendChar(const TCHAR InChar)
+		{
+			Out.Add(static_cast<uint8>(InChar));
+		}
+
+		void AppendAscii(const TCHAR* InText)
+		{
+			for (; *InText != TEXT('\0'); ++InText)
+			{
+				Out.Add(static_cast<uint8>(*InText));
+			}
+		}
+
+		void AppendText(const TCHAR* InText, const int32 InNum)
+		{
+			int32 AsciiNum = 0;
+			while (AsciiNum < InNum && static_cast<uint32>(InText[AsciiNum]) < 0x80)
+			{
+				++AsciiNum;
+			}
+
+			const int32 Offset = Out.AddUninitialized(AsciiNum);
+			uint8* Dest = Out.GetData() + Offset;
+			for (int32 Index = 0; Index < AsciiNum; ++Index)
+			{
+				Dest[Index] = static_cast<uint8>(InText[Index]);
+			}
+
+			if (AsciiNum < InNum)
+			{
+				const FTCHARToUTF8 Utf8Text(InText + AsciiNum, InNum - AsciiNum);
+				Out.Append(reinterpret_cast<const uint8*>(Utf8Text.Get()), Utf8Text.Length());
+			}
+		}
+
+	private:
+		TArray<uint8>& Out;
+	};
+
+	/**
+	 * 스키마를 따라 구조체 메모리를 JSON 텍스트로 이어 붙이는 직렬화기.
+	 * @tparam SinkType 출력 대상 (FStringSink 또는 FUtf8Sink)
+	 */
+	template<typename SinkType>
+	class TJsonStructEmitter
+	{
+	public:
+		TJsonStructEmitter(SinkType& InOut, const bool bInPrettyPrint)
+			: Out(InOut), bPrettyPrint(bInPrettyPrint)
+		{
+		}
+
+		bool WriteObject(const UStruct* InStruct, const void* InStructData)
+		{
+			const TSharedRef<const FJWNU_JsonStructSchema, ESPMode::ThreadSafe> Schema = FJWNU_JsonStructSchema::Get(InStruct);
+
+			Out.AppendChar(TEXT('{'));
+			++Indent;
+			bool bFirst = true;
+			for (const FJWNU_JsonField& Field : Schema->GetFields())
+			{
+				if (bFirst == false)
+				{
+					Out.AppendChar(TEXT(','));
+				}
+				bFirst = false;
+				WriteNewLine();
+				WriteQuoted(Field.JsonKey);
+				Out.AppendAscii(bPrettyPrint ? TEXT(": ") : TEXT(":"));
+
+				if (Field.ArrayDim == 1)
+				{
+					if (WriteValue(Field.Handler, Field.GetValuePtr(InStructData)) == false)
+					{
+						return false;
+					}
+					continue;
+				}
+
+				// 고정 크기 배열은 JSON 배열로 기록
+				Out.AppendChar(TEXT('['));
+				for (int32 Index = 0; Index < Field.ArrayDim; ++Index)
+				{
+					if (Index > 0)
+					{
+						Out.AppendChar(TEXT(','));
+					}
+					if (WriteValue(Field.Handler, Field.GetValuePtr(InStructData, Index)) == false)
+					{
+						return false;
+					}
+				}
+				Out.AppendChar(TEXT(']'));
+			}
+			--Indent;
+			if (bFirst == false)
+			{
+				WriteNewLine();
+			}
+			Out.AppendChar(TEXT('}'));
+			return true;
+		}
+
+	private:
+		SinkType& Out;
+		bool bPrettyPrint;
+		int32 Indent = 0;
+
+		void WriteNewLine()
+		{
+			if (bPrettyPrint)
+			{
+				Out.AppendChar(TEXT('\n'));
+				for (int32 Index = 0; Index < Indent; ++Index)
+				{
+					Out.AppendChar(TEXT('\t'));
+				}
+			}
+		}
+
+		void WriteQuoted(const FStringView InValue)
+		{
+			Out.AppendChar(TEXT('"'));
+
+			// 이스케이프가 필요 없는 구간은 한 번에 넘긴다
+			const TCHAR* const Data = InValue.GetData();
+			const int32 Num = InValue.Len();
+			int32 RunStart = 0;
+			for (int32 Index = 0; Index < Num; ++Index)
+			{
+				const TCHAR Char = Data[Index];
+				const TCHAR* Escaped = nullptr;
+				switch (Char)
+				{
+				case TEXT('"'):  Escaped = TEXT("\\\""); break;
+				case TEXT('\\'): Escaped = TEXT("\\\\"); break;
+				case TEXT('\n'): Escaped = TEXT("\\n");  break;
+				case TEXT('\r'): Escaped = TEXT("\\r");  break;
+				case TEXT('\t'): Escaped = TEXT("\\t");  break;
+				case TEXT('\b'): Escaped = TEXT("\\b");  break;
+				case TEXT('\f'): Escaped = TEXT("\\f");  break;
+				default:
+					if (Char >= 0x20)
+					{
+						continue;
+					}
+					break;
+				}
+
+				Out.AppendText(Data + RunStart, Index - RunStart);
+				RunStart = Index + 1;
+				if (Escaped != nullptr)
+				{
+					Out.AppendAscii(Escaped);
+				}
+				else
+				{
+					TCHAR Buffer[8];
+					FCString::Snprintf(Buffer, UE_ARRAY_COUNT(Buffer), TEXT("\\u%04x"), static_cast<uint32>(Char));
+					Out.AppendAscii(Buffer);
+				}
+			}
+			Out.AppendText(Data + RunStart, Num - RunStart);
+
+			Out.AppendChar(TEXT('"'));
+		}
+
+		bool WriteValue(const FJWNU_JsonTypeHandler& InHandler, const void* InValue)
+		{
+			// 숫자는 힙 할당 없이 스택 버퍼에서 포맷
+			TCHAR NumberBuffer[64];
+
+			switch (InHandler.Kind)
+			{
+			case EJWNU_JsonValueKind::String:
+				WriteQuoted(*static_cast<const FString*>(InValue));
+				return true;
+
+			case EJWNU_JsonValueKind::Name:
+				WriteQuoted(static_cast<const FName*>(InValue)->ToString());
+				return true;
+
+			case EJWNU_JsonValueKind::Text:
+				WriteQuoted(static_cast<const FText*>(InValue)->ToString());
+				return true;
+
+			case EJWNU_JsonValueKind::Bool:
+				Out.AppendAscii(static_cast<const FBoolProperty*>(InHandler.Property)->GetPropertyValue(InValue) ? TEXT("true") : TEXT("false"));
+				return true;
+
+			case EJWNU_JsonValueKind::Enum:
+				WriteQuoted(InHandler.Enum->GetNameStringByValue(InHandler.NumericProperty->GetSignedIntPropertyValue(InValue)));
+				return true;
+
+			case EJWNU_JsonValueKind::SignedInteger:
+				FCString::Snprintf(NumberBuffer, UE_ARRAY_COUNT(NumberBuffer), TEXT("%lld"), InHandler.NumericProperty->GetSignedIntPropertyValue(InValue));
+				Out.AppendAscii(NumberBuffer);
+				return true;
+
+			case EJWNU_JsonValueKind::UnsignedInteger:
+				FCString::Snprintf(NumberBuffer, UE_ARRAY_COUNT(NumberBuffer), TEXT("%llu"), InHandler.NumericProperty->GetUnsignedIntPropertyValue(InValue));
+				Out.AppendAscii(NumberBuffer);
+				return true;
+
+			case EJWNU_JsonValueKind::FloatingPoint:
+				// TJsonWriter와 동일한 정밀도
+				FCString::Snprintf(NumberBuffer, UE_ARRAY_COUNT(NumberBuffer), TEXT("%.17g"), InHandler.NumericProperty->GetFloatingPointPropertyValue(InValue));
+				Out.AppendAscii(NumberBuffer);
+				return true;
+			case EJWNU_JsonValueKind::Struct:
+				return WriteObject(InHandler.Struct, InValue);
+
+			case EJWNU_JsonValueKind::Array:
+				{
+					FScriptArrayHelper Helper(static_cast<const FArrayProperty*>(InHandler.Property), InValue);
+					Out.AppendChar(TEXT('['));
+					for (int32 Index = 0; Index < Helper.Num(); ++Index)
+					{
+						if (Index > 0)
+						{
+							Out.AppendChar(TEXT(','));
+						}
+						if (WriteValue(InHandler.Children[0], Helper.GetRawPtr(Index)) == false)
+						{
+							return false;
+						}
+					}
+					Out.AppendChar(TEXT(']'));
+					return true;
+				}
+
+			case EJWNU_JsonValueKind::Set:
+				{
+					FScriptSetHelper Helper(static_cast<const FSetProperty*>(InHandler.Property), InValue);
+					Out.AppendChar(TEXT('['));
+					bool bFirst = true;
+					for (int32 Index = 0, Remaining = Helper.Num(); Remaining > 0; ++Index)
+					{
+						if (Helper.IsValidIndex(Index) == false)
+						{
+							continue;
+						}
+						--Remaining;
+						if (bFirst == false)
+						{
+							Out.AppendChar(TEXT(','));
+						}
+						bFirst = false;
+						if (WriteValue(InHandler.Children[0], Helper.GetElementPtr(Index)) == false)
+						{
+							return false;
+						}
+					}
+					Out.AppendChar(TEXT(']'));
+					return true;
+				}
+
+			case EJWNU_JsonValueKind::Map:
+				return WriteMap(InHandler, InValue);
+
+			case EJWNU_JsonValueKind::Fallback:
+				break;
+			}
+
+			return WriteWithConverter(InHandler.Property, InValue);
+		}
+
+		bool WriteMap(const FJWNU_JsonTypeHandler& InHandler, const void* InValue)
+		{
+			FScriptMapHelper Helper(static_cast<const FMapProperty*>(InHandler.Property), InValue);
+			const FJWNU_JsonTypeHandler& KeyHandler = InHandler.Children[0];
+			const FJWNU_JsonTypeHandler& ValueHandler = InHandler.Children[1];
+
+			Out.AppendChar(TEXT('{'));
+			++Indent;
+			bool bFirst = true;
+			for (int32 Index = 0, Remaining = Helper.Num(); Remaining > 0; ++Index)
+			{
+				if (Helper.IsValidIndex(Index) == false)
+				{
+					continue;
+				}
+				--Remaining;
+
+				// FJsonObjectConverter와 동일하게 문자열로 표현 가능한 키는 그 값을, 나머지는 익스포트 텍스트를 사용
+				const void* KeyPtr = Helper.GetKeyPtr(Index);
+				FString KeyString;
+				switch (KeyHandler.Kind)
+				{
+				case EJWNU_JsonValueKind::String:
+					KeyString = *static_cast<const FString*>(KeyPtr);
+					break;
+				case EJWNU_JsonValueKind::Name:
+					KeyString = static_cast<const FName*>(KeyPtr)->ToString();
+					break;
+				case EJWNU_JsonValueKind::Text:
+					KeyString = static_cast<const FText*>(KeyPtr)->ToString();
+					break;
+				case EJWNU_JsonValueKind::Enum:
+					KeyString = KeyHandler.Enum->GetNameStringByValue(KeyHandler.NumericProperty->GetSignedIntPropertyValue(KeyPtr));
+					break;
+				default:
+					KeyHandler.Property->ExportTextItem_Direct(KeyString, KeyPtr, nullptr, nullptr, PPF_None);
+					break;
+				}
+				if (KeyString.IsEmpty())
+				{
+					PRINT_LOG(LogJWNU_JsonStructWriter, Warning, TEXT("Unable to convert map key of %s"), *InHandler.Property->GetName());
+					return false;
+				}
+
+				if (bFirst == false)
+				{
+					Out.AppendChar(TEXT(','));
+				}
+				bFirst = false;
+				WriteNewLine();
+				WriteQuoted(KeyString);
+				Out.AppendAscii(bPrettyPrint ? TEXT(": ") : TEXT(":"));
+				if (WriteValue(ValueHandler, Helper.GetValuePtr(Index)) == false)
+				{
+					return false;
+				}
+			}
+			--Indent;
+			if (bFirst == false)
+			{
+				WriteNewLine();
+			}
+			Out.AppendChar(TEXT('}'));
+			return true;
+		}
+
+		/**
+		 * 값 하나만 FJsonValue로 변환해 직렬화하는 함수. (직접 처리하지 않는 타입 전용)
+		 */
+		bool WriteWithConverter(const FProperty* InProperty, const void* InValue)
+		{
+			const TSharedPtr<FJsonValue> JsonValue = FJsonObjectConverter::UPropertyToJsonValue(const_cast<FProperty*>(InProperty), InValue, 0, 0);
+			if (JsonValue.IsValid() == false)
+			{
+				PRINT_LOG(LogJWNU_JsonStructWriter, Warning, TEXT("Unhandled property type: %s"), *InProperty->GetName());
+				return false;
+			}
+
+			FString ValueText;
+			const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ValueText);
+			if (FJsonSerializer::Serialize(JsonValue, FString(), JsonWriter) == false)
+			{
+				return false;
+			}
+			Out.AppendText(*ValueText, ValueText.Len());
+			return true;
+		}
+	};
+}
+
+bool FJWNU_JsonStructWriter::WriteString(const UStruct* InStruct, const void* InStructData, FString& OutJson, const bool bInPrettyPrint)
+{
+	OutJson.Reset();
+	if (InStruct == nullptr || InStructData == nullptr)
+	{
+		return false;
+	}
+
+	JWNU_JsonStructWriter_Private::FStringSink Sink(OutJson);
+	JWNU_JsonStructWriter_Private::TJsonStructEmitter<JWNU_JsonStructWriter_Private::FStringSink> Emitter(Sink, bInPrettyPrint);
+	if (Emitter.WriteObject(InStruct, InStructData))
+	{
+		return true;
+	}
+
+	OutJson.Reset();
+	return false;
+}
+
+bool FJWNU_JsonStructWriter::WriteUtf8(const UStruct* InStruct, const void* InStructData, TArray<uint8>& OutJson, const bool bInPrettyPrint)
+{
+	OutJson.Reset();
+	if (InStruct == nullptr || InStructData == nullptr)
+	{
+		return false;
+	}
+
+	JWNU_JsonStructWriter_Private::FUtf8Sink Sink(OutJson);
+	JWNU_JsonStructWriter_Private::TJsonStructEmitter<JWNU_JsonStructWriter_Private::FUtf8Sink> Emitter(Sink, bInPrettyPrint);
+	if (Emitter.WriteObject(InStruct, InStructData))
+	{
+		return true;
+	}
+
+	OutJson.Reset();
+	return false;
+}
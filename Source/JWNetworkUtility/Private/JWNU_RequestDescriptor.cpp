@@ -0,0 +1,90 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#include "JWNU_RequestDescriptor.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+
+TArray<uint8> FJWNU_RequestBody::ConsumeUtf8()
+{
+	if (bIsUtf8)
+	{
+		return MoveTemp(Utf8Bytes);
+	}
+
+	TArray<uint8> Result;
+	if (Text.IsEmpty() == false)
+	{
+		const FTCHARToUTF8 Utf8Text(Text.GetData(), Text.Len());
+		Result.Append(reinterpret_cast<const uint8*>(Utf8Text.Get()), Utf8Text.Length());
+	}
+	Text = FStringView();
+	return Result;
+}
+
+FJWNU_RequestDescriptorRef FJWNU_RequestDescriptor::Create(
+	const EJWNU_HttpMethod InMethod,
+	const EJWNU_ServiceType InServiceType,
+	FString&& InBaseURL,
+	FJWNU_RequestBody&& InContentBody,
+	const TMap<FString, FString>& InQueryParams,
+	const FJWNU_RequestConfig& InConfig,
+	const uint64 InEndpointId)
+{
+	// 바디는 여기서 한 번만 UTF-8로 변환(또는 이동)하고, 이후 전송마다 다시 변환하지 않는다
+	return MakeShared<FJWNU_RequestDescriptor, ESPMode::ThreadSafe>(InMethod, InServiceType, BuildURL(MoveTemp(InBaseURL), InQueryParams), InContentBody.ConsumeUtf8(), InConfig, InEndpointId);
+}
+
+FJWNU_RequestDescriptor::FJWNU_RequestDescriptor(
+	const EJWNU_HttpMethod InMethod,
+	const EJWNU_ServiceType InServiceType,
+	FString&& InURL,
+	TArray<uint8>&& InContentBytes,
+	const FJWNU_RequestConfig& InConfig,
+	const uint64 InEndpointId)
+	: Method(InMethod)
+	, ServiceType(InServiceType)
+	, URL(MoveTemp(InURL))
+	, ContentBytes(MoveTemp(InContentBytes))
+	, Config(InConfig)
+	, EndpointId(InEndpointId)
+{
+}
+
+const TCHAR* FJWNU_RequestDescriptor::GetVerb() const
+{
+	switch (Method)
+	{
+	case EJWNU_HttpMethod::Get:
+		return TEXT("GET");
+	case EJWNU_HttpMethod::Post:
+		return TEXT("POST");
+	case EJWNU_HttpMethod::Put:
+		return TEXT("PUT");
+	case EJWNU_HttpMethod::Delete:
+		return TEXT("DELETE");
+	}
+	return TEXT("GET");
+}
+
+FString FJWNU_RequestDescriptor::BuildURL(FString&& BaseURL, const TMap<FString, FString>& QueryParams)
+{
+	FString Result = MoveTemp(BaseURL);
+	if (QueryParams.Num() == 0)
+	{
+		return Result;
+	}
+
+	// 기존 URL에 ?가 포함되어 있는지 확인 후 결합
+	TCHAR Separator = Result.Contains(TEXT("?")) ? TEXT('&') : TEXT('?');
+	for (auto& It : QueryParams)
+	{
+		// 특수 문자가 포함될 수 있으므로 인코딩 처리
+		Result.AppendChar(Separator);
+		Result += FGenericPlatformHttp::UrlEncode(It.Key);
+		Result.AppendChar(TEXT('='));
+		Result += FGenericPlatformHttp::UrlEncode(It.Value);
+		Separator = TEXT('&');
+	}
+
+	// 반환
+	return Result;
+}
@@ -0,0 +1,272 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#include "JWNU_RequestGraph.h"
+#include "JWNetworkUtility.h"
+
+DEFINE_LOG_CATEGORY(LogJWNU_RequestGraph);
+
+TSharedRef<FJWNU_RequestGraph, ESPMode::ThreadSafe> FJWNU_RequestGraph::Create(const int32 InMaxConcurrency)
+{
+	return MakeShared<FJWNU_RequestGraph, ESPMode::ThreadSafe>(InMaxConcurrency);
+}
+
+FJWNU_RequestGraph::FJWNU_RequestGraph(const int32 InMaxConcurrency)
+	: MaxConcurrency(InMaxConcurrency)
+{
+}
+
+FJWNU_RequestGraph::~FJWNU_RequestGraph()
+{
+	// 실행 중에는 자기 참조로 유지되므로 여기까지 왔다면 진행 중인 호출은 없다
+	for (const TUniquePtr<FNode>& Node : Nodes)
+	{
+		Node->CancelCall();
+	}
+}
+
+EJWNU_RequestGraphNodeState FJWNU_RequestGraph::GetNodeState(const FJWNU_RequestGraphNodeId InNode) const
+{
+	check(Nodes.IsValidIndex(InNode.Index));
+	return Nodes[InNode.Index]->Report.State;
+}
+
+int32 FJWNU_RequestGraph::AddNode(TUniquePtr<FNode>&& InNode, const FName InName, const TConstArrayView<FJWNU_RequestGraphNodeId> InDependencies)
+{
+	checkf(bStarted == false, TEXT("Cannot add nodes to a request graph that is already running"));
+
+	const int32 Index = Nodes.Num();
+	InNode->Report.Name = InName;
+	for (const FJWNU_RequestGraphNodeId Dependency : InDependencies)
+	{
+		// 선행 노드는 항상 먼저 추가된 노드이므로 순환이 생기지 않는다
+		checkf(Dependency.Index >= 0 && Dependency.Index < Index, TEXT("Request graph node '%s' depends on an unknown node"), *InName.ToString());
+		if (InNode->Dependencies.Contains(Dependency.Index))
+		{
+			continue;
+		}
+		InNode->Dependencies.Add(Dependency.Index);
+		Nodes[Dependency.Index]->Dependents.Add(Index);
+	}
+	InNode->PendingDependencyCount = InNode->Dependencies.Num();
+	Nodes.Add(MoveTemp(InNode));
+	return Index;
+}
+
+void FJWNU_RequestGraph::Run(FOnGraphCompleted&& InOnCompleted)
+{
+	checkf(bStarted == false, TEXT("Request graph can only run once"));
+	bStarted = true;
+	OnCompleted = MoveTemp(InOnCompleted);
+	SelfWhileRunning = AsShared();
+	StartTime = FPlatformTime::Seconds();
+
+	PRINT_LOG(LogJWNU_RequestGraph, Display, TEXT("Running request graph. (Nodes: %d, MaxConcurrency: %d)"), Nodes.Num(), MaxConcurrency);
+
+	// 선행 노드가 없는 노드는 모두 곧바로 준비 상태
+	ReadyQueue.Reserve(Nodes.Num());
+	for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+	{
+		if (Nodes[Index]->PendingDependencyCount == 0)
+		{
+			ReadyQueue.Add(Index);
+		}
+	}
+
+	DispatchReadyNodes();
+}
+
+void FJWNU_RequestGraph::Cancel()
+{
+	if (IsRunning() == false || bCancelled)
+	{
+		return;
+	}
+	bCancelled = true;
+
+	const double Now = GetElapsedSeconds();
+	for (const TUniquePtr<FNode>& Node : Nodes)
+	{
+		if (Node->Report.State == EJWNU_RequestGraphNodeState::Running)
+		{
+			Node->CancelCall();
+			Node->Report.EndSeconds = Now;
+		}
+		if (Node->Report.State == EJWNU_RequestGraphNodeState::Running || Node->Report.State == EJWNU_RequestGraphNodeState::Pending)
+		{
+			Node->Report.State = EJWNU_RequestGraphNodeState::Cancelled;
+			++SettledCount;
+		}
+	}
+	RunningCount = 0;
+
+	PRINT_LOG(LogJWNU_RequestGraph, Display, TEXT("Request graph cancelled."));
+	if (bDispatching == false)
+	{
+		Finish();
+	}
+}
+
+void FJWNU_RequestGraph::DispatchReadyNodes()
+{
+	// 보내는 도중 동기적으로 끝난 노드는 바깥 루프가 이어서 처리
+	if (bDispatching)
+	{
+		return;
+	}
+
+	bDispatching = true;
+	while (bCancelled == false && ReadyHead < ReadyQueue.Num() && (MaxConcurrency <= 0 || RunningCount < MaxConcurrency))
+	{
+		const int32 Index = ReadyQueue[ReadyHead++];
+		FNode& Node = *Nodes[Index];
+		Node.Report.State = EJWNU_RequestGraphNodeState::Running;
+		Node.Report.StartSeconds = GetElapsedSeconds();
+		++RunningCount;
+		PeakConcurrency = FMath::Max(PeakConcurrency, RunningCount);
+
+		PRINT_LOG(LogJWNU_RequestGraph, Verbose, TEXT("Dispatching node '%s'. (Running: %d)"), *Node.Report.Name.ToString(), RunningCount);
+		Node.Launch(*this, Index);
+	}
+	bDispatching = false;
+
+	if (SettledCount == Nodes.Num())
+	{
+		Finish();
+	}
+}
+
+void FJWNU_RequestGraph::OnNodeCompleted(const int32 InIndex)
+{
+	FNode& Node = *Nodes[InIndex];
+	if (bCancelled || Node.Report.State != EJWNU_RequestGraphNodeState::Running)
+	{
+		return;
+	}
+
+	const double Now = GetElapsedSeconds();
+	Node.Report.EndSeconds = Now;
+	--RunningCount;
+	++SettledCount;
+
+	FJWNU_ApiError Error;
+	if (Node.ConsumeResult(Error))
+	{
+		Node.Report.State = EJWNU_RequestGraphNodeState::Succeeded;
+		PRINT_LOG(LogJWNU_RequestGraph, Verbose, TEXT("Node '%s' succeeded in %.1f ms."), *Node.Report.Name.ToString(), Node.Report.GetDurationSeconds() * 1000.0);
+
+		// 마지막 선행 노드였다면 의존 노드를 준비 상태로
+		for (const int32 DependentIndex : Node.Dependents)
+		{
+			FNode& Dependent = *Nodes[DependentIndex];
+			if (--Dependent.PendingDependencyCount == 0 && Dependent.Report.State == EJWNU_RequestGraphNodeState::Pending)
+			{
+				Dependent.Report.ReadySeconds = Now;
+				ReadyQueue.Add(DependentIndex);
+			}
+		}
+	}
+	else
+	{
+		Node.Report.State = EJWNU_RequestGraphNodeState::Failed;
+		Node.Report.Error = MoveTemp(Error);
+		PRINT_LOG(LogJWNU_RequestGraph, Warning, TEXT("Node '%s' failed, skipping its dependents. (%s: %s)"), *Node.Report.Name.ToString(), *Node.Report.Error.Code, *Node.Report.Error.Message);
+		SkipDependents(InIndex);
+	}
+
+	DispatchReadyNodes();
+}
+
+void FJWNU_RequestGraph::SkipDependents(const int32 InIndex)
+{
+	for (const int32 DependentIndex : Nodes[InIndex]->Dependents)
+	{
+		FNode& Dependent = *Nodes[DependentIndex];
+		if (Dependent.Report.State != EJWNU_RequestGraphNodeState::Pending)
+		{
+			continue;
+		}
+		Dependent.Report.State = EJWNU_RequestGraphNodeState::Skipped;
+		++SettledCount;
+		SkipDependents(DependentIndex);
+	}
+}
+
+void FJWNU_RequestGraph::Finish()
+{
+	if (bFinished)
+	{
+		return;
+	}
+	bFinished = true;
+
+	// 콜백 도중 마지막 참조가 사라지지 않도록 유지
+	const TSharedPtr<FJWNU_RequestGraph, ESPMode::ThreadSafe> KeepAlive = MoveTemp(SelfWhileRunning);
+
+	const FJWNU_RequestGraphReport Report = BuildReport();
+	TStringBuilder<256> CriticalPath;
+	for (const FName& Name : Report.CriticalPath)
+	{
+		if (CriticalPath.Len() > 0)
+		{
+			CriticalPath << TEXT(" -> ");
+		}
+		CriticalPath << Name;
+	}
+	PRINT_LOG(LogJWNU_RequestGraph, Display, TEXT("Request graph finished in %.1f ms. (Serial: %.1f ms, PeakConcurrency: %d, Succeeded: %s, CriticalPath: %s)"),
+		Report.TotalSeconds * 1000.0, Report.SerialSeconds * 1000.0, Report.PeakConcurrency, Report.bSucceeded ? TEXT("true") : TEXT("false"), CriticalPath.ToString());
+
+	if (OnCompleted)
+	{
+		const FOnGraphCompleted Callback = MoveTemp(OnCompleted);
+		OnCompleted = nullptr;
+		Callback(Report);
+	}
+}
+
+FJWNU_RequestGraphReport FJWNU_RequestGraph::BuildReport() const
+{
+	FJWNU_RequestGraphReport Report;
+	Report.Nodes.Reserve(Nodes.Num());
+	Report.PeakConcurrency = PeakConcurrency;
+	Report.bSucceeded = bCancelled == false;
+
+	int32 LastIndex = INDEX_NONE;
+	for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+	{
+		const FJWNU_RequestGraphNodeReport& NodeReport = Nodes[Index]->Report;
+		Report.Nodes.Add(NodeReport);
+		Report.bSucceeded &= NodeReport.State == EJWNU_RequestGraphNodeState::Succeeded;
+
+		const bool bWasSent = NodeReport.State == EJWNU_RequestGraphNodeState::Succeeded || NodeReport.State == EJWNU_RequestGraphNodeState::Failed;
+		if (bWasSent)
+		{
+			Report.SerialSeconds += NodeReport.GetDurationSeconds();
+			if (LastIndex == INDEX_NONE || NodeReport.EndSeconds > Nodes[LastIndex]->Report.EndSeconds)
+			{
+				LastIndex = Index;
+			}
+		}
+	}
+	Report.TotalSeconds = GetElapsedSeconds();
+
+	// 가장 늦게 끝난 노드에서 출발해, 매번 가장 늦게 끝난 선행 노드를 따라 거슬러 올라간다
+	for (int32 Index = LastIndex; Index != INDEX_NONE;)
+	{
+		Report.CriticalPath.Insert(Nodes[Index]->Report.Name, 0);
+		int32 GatingIndex = INDEX_NONE;
+		for (const int32 DependencyIndex : Nodes[Index]->Dependencies)
+		{
+			if (GatingIndex == INDEX_NONE || Nodes[DependencyIndex]->Report.EndSeconds > Nodes[GatingIndex]->Report.EndSeconds)
+			{
+				GatingIndex = DependencyIndex;
+			}
+		}
+		Index = GatingIndex;
+	}
+	return Report;
+}
+
+double FJWNU_RequestGraph::GetElapsedSeconds() const
+{
+	return FPlatformTime::Seconds() - StartTime;
+}
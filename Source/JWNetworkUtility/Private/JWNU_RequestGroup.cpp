@@ -0,0 +1,178 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#include "JWNU_RequestGroup.h"
+#include "JWNetworkUtility.h"
+#include "JWNU_HttpRequestJobHandle.h"
+#include "GameFramework/Actor.h"
+#include "Components/ActorComponent.h"
+#include "Engine/World.h"
+
+DEFINE_LOG_CATEGORY(LogJWNU_RequestGroup);
+
+// ──────── FJWNU_RequestGroup ────────
+
+FJWNU_RequestGroup::~FJWNU_RequestGroup()
+{
+	CancelAll();
+}
+
+FJWNU_RequestGroup::FJWNU_RequestGroup(FJWNU_RequestGroup&& Other)
+	: Handles(MoveTemp(Other.Handles))
+{
+}
+
+FJWNU_RequestGroup& FJWNU_RequestGroup::operator=(FJWNU_RequestGroup&& Other)
+{
+	if (this != &Other)
+	{
+		// 덮어쓰기 전에 기존 요청은 취소
+		CancelAll();
+		Handles = MoveTemp(Other.Handles);
+	}
+	return *this;
+}
+
+FJWNU_RequestHandle FJWNU_RequestGroup::Add(const FJWNU_RequestHandle& InHandle)
+{
+	if (InHandle.IsValid() == false)
+	{
+		return InHandle;
+	}
+
+	// 배열이 늘어나야 할 때만 끝난 요청을 정리해 요청이 계속 들어와도 추가 비용을 일정하게 유지
+	if (Handles.Num() == Handles.Max())
+	{
+		RemoveFinished();
+	}
+	Handles.Add(InHandle);
+	return InHandle;
+}
+
+void FJWNU_RequestGroup::CancelAll()
+{
+	if (Handles.Num() == 0)
+	{
+		return;
+	}
+
+	// 취소 도중 다른 요청의 콜백이 그룹을 건드려도 안전하도록 비운 배열로 순회
+	TArray<FJWNU_RequestHandle> HandlesToCancel = MoveTemp(Handles);
+	Handles.Reset();
+
+	int32 CancelledCount = 0;
+	for (const FJWNU_RequestHandle& Handle : HandlesToCancel)
+	{
+		if (Handle.IsRunning())
+		{
+			Handle.Cancel();
+			++CancelledCount;
+		}
+	}
+
+	if (CancelledCount > 0)
+	{
+		PRINT_LOG(LogJWNU_RequestGroup, Display, TEXT("Cancelled %d requests in group"), CancelledCount);
+	}
+}
+
+int32 FJWNU_RequestGroup::GetRunningCount() const
+{
+	int32 RunningCount = 0;
+	for (const FJWNU_RequestHandle& Handle : Handles)
+	{
+		RunningCount += Handle.IsRunning() ? 1 : 0;
+	}
+	return RunningCount;
+}
+
+void FJWNU_RequestGroup::RemoveFinished()
+{
+	Handles.RemoveAllSwap([](const FJWNU_RequestHandle& InHandle)
+	{
+		return InHandle.IsRunning() == false;
+	}, EAllowShrinking::No);
+}
+
+// ──────── UJWNU_RequestGroup ────────
+
+UJWNU_RequestGroup* UJWNU_RequestGroup::CreateRequestGroup(UObject* InOwner)
+{
+	if (InOwner == nullptr)
+	{
+		PRINT_LOG(LogJWNU_RequestGroup, Warning, TEXT("Owner is invalid!"));
+		return nullptr;
+	}
+
+	UJWNU_RequestGroup* NewGroup = NewObject<UJWNU_RequestGroup>(InOwner);
+
+	// 액터(또는 컴포넌트의 소유 액터)라면 EndPlay에 묶는다
+	AActor* OwnerActor = Cast<AActor>(InOwner);
+	if (OwnerActor == nullptr)
+	{
+		if (const UActorComponent* OwnerComponent = Cast<UActorComponent>(InOwner))
+		{
+			OwnerActor = OwnerComponent->GetOwner();
+		}
+	}
+	if (OwnerActor != nullptr)
+	{
+		OwnerActor->OnEndPlay.AddDynamic(NewGroup, &UJWNU_RequestGroup::HandleOwnerEndPlay);
+	}
+
+	// 위젯처럼 파괴 이벤트가 없는 소유자도 레벨 전환에서는 정리되도록 소유자 월드의 정리에 묶는다
+	NewGroup->OwnerWorld = InOwner->GetWorld();
+	NewGroup->WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddUObject(NewGroup, &UJWNU_RequestGroup::HandleWorldCleanup);
+	return NewGroup;
+}
+
+void UJWNU_RequestGroup::AddRequest(UJWNU_HttpRequestJobHandle* InHandle)
+{
+	if (InHandle == nullptr)
+	{
+		return;
+	}
+	Group.Add(InHandle->GetNativeHandle());
+}
+
+void UJWNU_RequestGroup::CancelAll()
+{
+	Group.CancelAll();
+}
+
+int32 UJWNU_RequestGroup::GetRunningCount() const
+{
+	return Group.GetRunningCount();
+}
+
+FJWNU_RequestHandle UJWNU_RequestGroup::Add(const FJWNU_RequestHandle& InHandle)
+{
+	return Group.Add(InHandle);
+}
+
+void UJWNU_RequestGroup::BeginDestroy()
+{
+	if (WorldCleanupHandle.IsValid())
+	{
+		FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+		WorldCleanupHandle.Reset();
+	}
+	Group.CancelAll();
+
+	Super::BeginDestroy();
+}
+
+void UJWNU_RequestGroup::HandleOwnerEndPlay(AActor* InActor, EEndPlayReason::Type InEndPlayReason)
+{
+	PRINT_LOG(LogJWNU_RequestGroup, Verbose, TEXT("Owner actor ended play, cancelling request group"));
+	Group.CancelAll();
+}
+
+void UJWNU_RequestGroup::HandleWorldCleanup(UWorld* InWorld, bool bSessionEnded, bool bCleanupResources)
+{
+	if (InWorld == nullptr || InWorld != OwnerWorld.Get())
+	{
+		return;
+	}
+	PRINT_LOG(LogJWNU_RequestGroup, Verbose, TEXT("Owner world cleaned up, cancelling request group"));
+	Group.CancelAll();
+}
@@ -0,0 +1,172 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#include "JWNU_RequestHandle.h"
+#include "JWNetworkUtility.h"
+#include "JWNU_HttpRequestJob.h"
+
+DEFINE_LOG_CATEGORY(LogJWNU_RequestHandle);
+
+// ──────── FJWNU_RequestHandle ────────
+
+void FJWNU_RequestHandle::Cancel() const
+{
+	if (const TSharedPtr<FJWNU_RequestHandleTable, ESPMode::ThreadSafe> PinnedTable = Table.Pin())
+	{
+		PinnedTable->Cancel(*this);
+	}
+}
+
+bool FJWNU_RequestHandle::IsRunning() const
+{
+	const TSharedPtr<FJWNU_RequestHandleTable, ESPMode::ThreadSafe> PinnedTable = Table.Pin();
+	return PinnedTable.IsValid() && PinnedTable->IsRunning(*this);
+}
+
+bool FJWNU_RequestHandle::IsCancelled() const
+{
+	const TSharedPtr<FJWNU_RequestHandleTable, ESPMode::ThreadSafe> PinnedTable = Table.Pin();
+	return PinnedTable.IsValid() && PinnedTable->IsCancelled(*this);
+}
+
+void FJWNU_RequestHandle::BindJob(UJWNU_HttpRequestJob* InJob) const
+{
+	if (const TSharedPtr<FJWNU_RequestHandleTable, ESPMode::ThreadSafe> PinnedTable = Table.Pin())
+	{
+		PinnedTable->BindJob(*this, InJob);
+	}
+}
+
+void FJWNU_RequestHandle::Release() const
+{
+	if (const TSharedPtr<FJWNU_RequestHandleTable, ESPMode::ThreadSafe> PinnedTable = Table.Pin())
+	{
+		PinnedTable->Release(*this);
+	}
+}
+
+// ──────── FJWNU_RequestHandleTable ────────
+
+FJWNU_RequestHandle FJWNU_RequestHandleTable::Allocate()
+{
+	check(IsInGameThread());
+
+	const int32 Index = FreeIndices.Num() > 0 ? FreeIndices.Pop(EAllowShrinking::No) : Entries.AddDefaulted();
+	FEntry& Entry = Entries[Index];
+	Entry.Generation = Entry.Generation + 1 == 0 ? 1 : Entry.Generation + 1;
+	Entry.bInUse = true;
+	Entry.bCancelled = false;
+	Entry.Job.Reset();
+	++InFlightCount;
+
+	return FJWNU_RequestHandle(AsWeak(), Index, Entry.Generation);
+}
+
+void FJWNU_RequestHandleTable::Release(const FJWNU_RequestHandle& InHandle)
+{
+	check(IsInGameThread());
+
+	FEntry* Entry = FindEntry(InHandle);
+	if (Entry == nullptr || Entry->bInUse == false)
+	{
+		return;
+	}
+	FreeEntry(*Entry, InHandle.Index);
+}
+
+void FJWNU_RequestHandleTable::Cancel(const FJWNU_RequestHandle& InHandle)
+{
+	check(IsInGameThread());
+
+	FEntry* Entry = FindEntry(InHandle);
+	if (Entry == nullptr || Entry->bInUse == false)
+	{
+		return;
+	}
+
+	Entry->bCancelled = true;
+	UJWNU_HttpRequestJob* Job = Entry->Job.Get();
+	FreeEntry(*Entry, InHandle.Index);
+
+	// Job 취소는 콜백을 호출하지 않지만, 슬롯을 먼저 비워 두어 어떤 경로로 돌아오더라도 결과가 버려지도록 한다
+	if (Job != nullptr && Job->IsRunning())
+	{
+		Job->Cancel();
+	}
+	PRINT_LOG(LogJWNU_RequestHandle, Verbose, TEXT("Request cancelled. (Slot %d)"), InHandle.Index);
+}
+
+void FJWNU_RequestHandleTable::BindJob(const FJWNU_RequestHandle& InHandle, UJWNU_HttpRequestJob* InJob)
+{
+	check(IsInGameThread());
+
+	if (FEntry* Entry = FindEntry(InHandle))
+	{
+		if (Entry->bInUse)
+		{
+			Entry->Job = InJob;
+		}
+	}
+}
+
+bool FJWNU_RequestHandleTable::IsRunning(const FJWNU_RequestHandle& InHandle) const
+{
+	const FEntry* Entry = FindEntry(InHandle);
+	return Entry != nullptr && Entry->bInUse && Entry->bCancelled == false;
+}
+
+bool FJWNU_RequestHandleTable::IsCancelled(const FJWNU_RequestHandle& InHandle) const
+{
+	const FEntry* Entry = FindEntry(InHandle);
+	return Entry != nullptr && Entry->bCancelled;
+}
+
+void FJWNU_RequestHandleTable::CancelAll()
+{
+	check(IsInGameThread());
+
+	int32 CancelledCount = 0;
+	for (int32 Index = 0; Index < Entries.Num(); ++Index)
+	{
+		FEntry& Entry = Entries[Index];
+		if (Entry.bInUse == false)
+		{
+			continue;
+		}
+		Entry.bCancelled = true;
+		UJWNU_HttpRequestJob* Job = Entry.Job.Get();
+		FreeEntry(Entry, Index);
+		if (Job != nullptr && Job->IsRunning())
+		{
+			Job->Cancel();
+		}
+		++CancelledCount;
+	}
+
+	if (CancelledCount > 0)
+	{
+		PRINT_LOG(LogJWNU_RequestHandle, Display, TEXT("Cancelled %d in-flight requests."), CancelledCount);
+	}
+}
+
+FJWNU_RequestHandleTable::FEntry* FJWNU_RequestHandleTable::FindEntry(const FJWNU_RequestHandle& InHandle)
+{
+	return const_cast<FEntry*>(static_cast<const FJWNU_RequestHandleTable*>(this)->FindEntry(InHandle));
+}
+
+const FJWNU_RequestHandleTable::FEntry* FJWNU_RequestHandleTable::FindEntry(const FJWNU_RequestHandle& InHandle) const
+{
+	if (InHandle.IsValid() == false || Entries.IsValidIndex(InHandle.Index) == false)
+	{
+		return nullptr;
+	}
+	const FEntry& Entry = Entries[InHandle.Index];
+	return Entry.Generation == InHandle.Generation ? &Entry : nullptr;
+}
+
+void FJWNU_RequestHandleTable::FreeEntry(FEntry& InEntry, const int32 InIndex)
+{
+	InEntry.bInUse = false;
+	InEntry.Job.Reset();
+	FreeIndices.Push(InIndex);
+	--InFlightCount;
+}
@@ -0,0 +1,429 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#include "JWNU_TokenCipher.h"
+#include "JWNetworkUtility.h"
+#include "Misc/AES.h"
+#include "Misc/SecureHash.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Base64.h"
+#include "Misc/App.h"
+#include "HAL/PlatformFileManager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/AllowWindowsPlatformTypes.h"
+#include <windows.h>
+#include <dpapi.h>
+#include <bcrypt.h>
+#include "Windows/HideWindowsPlatformTypes.h"
+#pragma comment(lib, "crypt32.lib")
+#pragma comment(lib, "bcrypt.lib")
+#elif PLATFORM_APPLE
+#include <stdlib.h>
+#elif PLATFORM_LINUX || PLATFORM_ANDROID
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+
+DEFINE_LOG_CATEGORY(LogJWNU_TokenCipher);
+
+namespace JWNU_TokenCipher_Private
+{
+	/** 포터블 백엔드의 논스 길이 */
+	constexpr int32 NonceSize = FAES::AESBlockSize;
+
+	/** 포터블 백엔드의 HMAC 길이 */
+	constexpr int32 MacSize = FSHA1::DigestSize;
+
+	/** 설치별 솔트 길이 */
+	constexpr int32 SaltSize = 32;
+
+	/**
+	 * 두 바이트 배열을 상수 시간으로 비교하는 함수. (타이밍 공격 방지)
+	 */
+	bool ConstantTimeEquals(const uint8* A, const uint8* B, const int32 Num)
+	{
+		uint8 Diff = 0;
+		for (int32 i = 0; i < Num; i++)
+		{
+			Diff |= A[i] ^ B[i];
+		}
+		return Diff == 0;
+	}
+
+	/**
+	 * 운영체제의 암호학적 난수 생성기로 무작위 바이트를 채우는 함수. (GUID 생성기는 예측 가능하므로 키와 논스에 쓰지 않는다)
+	 * 윈도우는 BCryptGenRandom, 애플 플랫폼은 arc4random_buf, 리눅스와 안드로이드는 getrandom 시스템 콜과 /dev/urandom을 사용한다.
+	 * @return 요청한 길이를 모두 채웠는지 여부
+	 */
+	bool FillRandomBytes(uint8* OutBytes, const int32 Num)
+	{
+		if (Num <= 0)
+		{
+			return true;
+		}
+
+#if PLATFORM_WINDOWS
+		return BCRYPT_SUCCESS(BCryptGenRandom(nullptr, OutBytes, static_cast<ULONG>(Num), BCRYPT_USE_SYSTEM_PREFERRED_RNG));
+#elif PLATFORM_APPLE
+		arc4random_buf(OutBytes, static_cast<size_t>(Num));
+		return true;
+#elif PLATFORM_LINUX || PLATFORM_ANDROID
+		int32 Offset = 0;
+#if defined(SYS_getrandom)
+		// 커널 엔트로피 풀이 초기화될 때까지 대기하며, 신호로 중단되면 이어서 채운다
+		while (Offset < Num)
+		{
+			const long Read = syscall(SYS_getrandom, OutBytes + Offset, static_cast<size_t>(Num - Offset), 0);
+			if (Read > 0)
+			{
+				Offset += static_cast<int32>(Read);
+			}
+			else if (Read < 0 && errno != EINTR)
+			{
+				break;
+			}
+		}
+#endif
+		// getrandom을 지원하지 않는 커널이라면 /dev/urandom으로 나머지를 채운다
+		if (Offset < Num)
+		{
+			const int FileDescriptor = open("/dev/urandom", O_RDONLY | O_CLOEXEC);
+			if (FileDescriptor < 0)
+			{
+				return false;
+			}
+			while (Offset < Num)
+			{
+				const ssize_t Read = read(FileDescriptor, OutBytes + Offset, static_cast<size_t>(Num - Offset));
+				if (Read > 0)
+				{
+					Offset += static_cast<int32>(Read);
+				}
+				else if (Read == 0 || errno != EINTR)
+				{
+					break;
+				}
+			}
+			close(FileDescriptor);
+		}
+		return Offset == Num;
+#else
+		// 운영체제 난수 생성기를 알 수 없는 플랫폼에서는 안전하지 않은 키를 만들지 않는다
+		return false;
+#endif
+	}
+
+	/**
+	 * 설치별 솔트 파일 경로를 반환하는 함수.
+	 * 키스토어와 함께 복사되지 않도록 프로젝트 Saved 폴더가 아닌 사용자 설정 폴더에 둔다.
+	 */
+	FString GetInstallSaltPath()
+	{
+		return FPaths::Combine(FPlatformProcess::UserSettingsDir(), TEXT("JWNetworkUtility"), FApp::GetProjectName(), TEXT("keystore.salt"));
+	}
+
+	/**
+	 * 설치별 솔트를 로드하고, 없다면 새로 생성해서 저장하는 함수.
+	 * 구버전이 키스토어 옆에 기록한 솔트가 있다면 사용자 설정 폴더로 옮긴 뒤 지운다.
+	 * @param OutSalt 설치별 솔트
+	 * @return 솔트 확보 여부 (난수 생성기를 쓸 수 없어 새로 만들지 못했다면 false)
+	 */
+	bool LoadOrCreateInstallSalt(TArray<uint8>& OutSalt)
+	{
+		const FString SaltPath = GetInstallSaltPath();
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+		if (FFileHelper::LoadFileToArray(OutSalt, *SaltPath, FILEREAD_Silent) && OutSalt.Num() == SaltSize)
+		{
+			return true;
+		}
+
+		// 구버전 솔트 이관 (새 위치에 기록한 뒤에만 지워서, 중간에 중단되어도 기존 키스토어를 열 수 있게 한다)
+		const FString LegacySaltPath = FPaths::ProjectSavedDir() + TEXT("Config/JWNetworkUtility/keystore.salt");
+		if (FFileHelper::LoadFileToArray(OutSalt, *LegacySaltPath, FILEREAD_Silent) && OutSalt.Num() == SaltSize)
+		{
+			PlatformFile.CreateDirectoryTree(*FPaths::GetPath(SaltPath));
+			if (FFileHelper::SaveArrayToFile(OutSalt, *SaltPath))
+			{
+				PlatformFile.DeleteFile(*LegacySaltPath);
+				PRINT_LOG(LogJWNU_TokenCipher, Display, TEXT("Moved keystore salt out of the project folder to %s"), *SaltPath);
+			}
+			return true;
+		}
+
+		OutSalt.SetNumUninitialized(SaltSize);
+		if (FillRandomBytes(OutSalt.GetData(), SaltSize) == false)
+		{
+			PRINT_LOG(LogJWNU_TokenCipher, Error, TEXT("Secure random source is unavailable, keystore writes are locked for this session!"));
+			OutSalt.Reset();
+			return false;
+		}
+
+		PlatformFile.CreateDirectoryTree(*FPaths::GetPath(SaltPath));
+		if (FFileHelper::SaveArrayToFile(OutSalt, *SaltPath) == false)
+		{
+			PRINT_LOG(LogJWNU_TokenCipher, Warning, TEXT("Failed to save keystore salt! Tokens will not survive restart."));
+		}
+		return true;
+	}
+}
+
+// ──────── Factory ────────
+
+TSharedRef<IJWNU_TokenCipher, ESPMode::ThreadSafe> IJWNU_TokenCipher::CreateDefault()
+{
+#if PLATFORM_WINDOWS
+	return MakeShared<FJWNU_DpapiTokenCipher, ESPMode::ThreadSafe>();
+#else
+	return FJWNU_PortableTokenCipher::CreateForThisMachine();
+#endif
+}
+
+TSharedPtr<IJWNU_TokenCipher, ESPMode::ThreadSafe> IJWNU_TokenCipher::CreateById(const EJWNU_TokenCipherId InCipherId)
+{
+	switch (InCipherId)
+	{
+#if PLATFORM_WINDOWS
+	case EJWNU_TokenCipherId::WindowsDpapi:
+		return MakeShared<FJWNU_DpapiTokenCipher, ESPMode::ThreadSafe>();
+#endif
+	case EJWNU_TokenCipherId::PortableAes:
+		return FJWNU_PortableTokenCipher::CreateForThisMachine();
+	default:
+		PRINT_LOG(LogJWNU_TokenCipher, Warning, TEXT("Token cipher %d is not available on this platform!"), static_cast<int32>(InCipherId));
+		return nullptr;
+	}
+}
+
+// ──────── Windows DPAPI ────────
+
+#if PLATFORM_WINDOWS
+
+const TArray<uint8>& FJWNU_DpapiTokenCipher::GetEntropyBytes()
+{
+	// 기기 ID를 솔트로 사용하기 위해 변환 (함수 내 정적 변수로 최초 호출 시 1회만 초기화)
+	static const TArray<uint8> EntropyBytes = []()
+	{
+		const FString DeviceID = FPlatformMisc::GetDeviceId() + TEXT("JWNetworkUtility");
+		const FTCHARToUTF8 EntropyConverter(*DeviceID);
+		TArray<uint8> Bytes;
+		Bytes.Append((const uint8*)EntropyConverter.Get(), EntropyConverter.Length());
+		return Bytes;
+	}();
+	return EntropyBytes;
+}
+
+bool FJWNU_DpapiTokenCipher::Encrypt(const TArray<uint8>& InPlainData, TArray<uint8>& OutEncryptedData) const
+{
+	const TArray<uint8>& EntropyBytes = GetEntropyBytes();
+
+	DATA_BLOB DataIn;
+	DataIn.pbData = (BYTE*)InPlainData.GetData();
+	DataIn.cbData = InPlainData.Num();
+
+	DATA_BLOB DataEntropy;
+	DataEntropy.pbData = (BYTE*)EntropyBytes.GetData();
+	DataEntropy.cbData = EntropyBytes.Num();
+
+	DATA_BLOB DataOut;
+
+	// 윈도우 DPAPI 호출 (현재 로그인된 사용자 계정으로 암호화)
+	if (CryptProtectData(&DataIn, nullptr, &DataEntropy, nullptr, nullptr, 0, &DataOut))
+	{
+		OutEncryptedData.Empty();
+		OutEncryptedData.Append((uint8*)DataOut.pbData, DataOut.cbData);
+
+		// 메모리 해제 필수
+		LocalFree(DataOut.pbData);
+		return true;
+	}
+	return false;
+}
+
+bool FJWNU_DpapiTokenCipher::Decrypt(const TArray<uint8>& InEncryptedData, TArray<uint8>& OutPlainData) const
+{
+	const TArray<uint8>& EntropyBytes = GetEntropyBytes();
+
+	DATA_BLOB DataIn;
+	DataIn.pbData = (BYTE*)InEncryptedData.GetData();
+	DataIn.cbData = InEncryptedData.Num();
+
+	DATA_BLOB DataEntropy;
+	DataEntropy.pbData = (BYTE*)EntropyBytes.GetData();
+	DataEntropy.cbData = EntropyBytes.Num();
+
+	DATA_BLOB DataOut;
+
+	// 윈도우 DPAPI 호출 (현재 로그인된 사용자 계정으로 복호화)
+	if (CryptUnprotectData(&DataIn, nullptr, &DataEntropy, nullptr, nullptr, 0, &DataOut))
+	{
+		OutPlainData.Empty();
+		OutPlainData.Append((uint8*)DataOut.pbData, DataOut.cbData);
+
+		// 메모리 해제 필수
+		LocalFree(DataOut.pbData);
+		return true;
+	}
+	return false;
+}
+
+#endif
+
+// ──────── Portable AES-CTR + HMAC-SHA1 ────────
+
+FJWNU_PortableTokenCipher::FJWNU_PortableTokenCipher(const TArray<uint8>& InMasterKey)
+{
+	// 마스터 키에서 용도별 키를 유도 (HMAC 기반 키 유도)
+	const auto Derive = [&InMasterKey](const ANSICHAR* Label, uint8* OutDigest)
+	{
+		FSHA1::HMACBuffer(InMasterKey.GetData(), InMasterKey.Num(), Label, FCStringAnsi::Strlen(Label), OutDigest);
+	};
+
+	uint8 EncryptionKeyLow[FSHA1::DigestSize];
+	uint8 EncryptionKeyHigh[FSHA1::DigestSize];
+	Derive("JWNU.Keystore.Enc.1", EncryptionKeyLow);
+	Derive("JWNU.Keystore.Enc.2", EncryptionKeyHigh);
+	FMemory::Memcpy(EncryptionKey, EncryptionKeyLow, 16);
+	FMemory::Memcpy(EncryptionKey + 16, EncryptionKeyHigh, 16);
+
+	Derive("JWNU.Keystore.Mac", MacKey);
+}
+
+TSharedRef<FJWNU_PortableTokenCipher, ESPMode::ThreadSafe> FJWNU_PortableTokenCipher::CreateForThisMachine()
+{
+	using namespace JWNU_TokenCipher_Private;
+
+	// 배포 환경에서 주입한 키가 있다면 우선 사용 (데디케이티드 서버 등)
+	const FString InjectedKey = FPlatformMisc::GetEnvironmentVariable(TEXT("JWNU_KEYSTORE_KEY"));
+	if (InjectedKey.IsEmpty() == false)
+	{
+		TArray<uint8> MasterKey;
+		if (FBase64::Decode(InjectedKey, MasterKey) == false || MasterKey.Num() == 0)
+		{
+			const FTCHARToUTF8 Converter(*InjectedKey);
+			MasterKey.Append((const uint8*)Converter.Get(), Converter.Length());
+		}
+		return MakeShared<FJWNU_PortableTokenCipher, ESPMode::ThreadSafe>(MasterKey);
+	}
+
+	// 기기 식별자를 설치별 솔트로 HMAC하여 마스터 키를 만든다
+	TArray<uint8> Salt;
+	const bool bHasSalt = LoadOrCreateInstallSalt(Salt);
+	const FString MachineIdentity = FPlatformMisc::GetLoginId() + FPlatformMisc::GetDeviceId() + TEXT("JWNetworkUtility");
+	const FTCHARToUTF8 IdentityConverter(*MachineIdentity);
+
+	TArray<uint8> MasterKey;
+	MasterKey.SetNumUninitialized(FSHA1::DigestSize);
+	FSHA1::HMACBuffer(Salt.GetData(), Salt.Num(), IdentityConverter.Get(), IdentityConverter.Length(), MasterKey.GetData());
+	const TSharedRef<FJWNU_PortableTokenCipher, ESPMode::ThreadSafe> Cipher = MakeShared<FJWNU_PortableTokenCipher, ESPMode::ThreadSafe>(MasterKey);
+
+	// 솔트 없이 유도한 키는 기기 식별자만 알면 다시 계산할 수 있으므로, 그 키로는 기록하지 않는다
+	Cipher->bEncryptionLocked = bHasSalt == false;
+	return Cipher;
+}
+
+bool FJWNU_PortableTokenCipher::Encrypt(const TArray<uint8>& InPlainData, TArray<uint8>& OutEncryptedData) const
+{
+	using namespace JWNU_TokenCipher_Private;
+
+	if (bEncryptionLocked)
+	{
+		PRINT_LOG(LogJWNU_TokenCipher, Error, TEXT("Keystore key has no install salt, refusing to encrypt!"));
+		OutEncryptedData.Reset();
+		return false;
+	}
+
+	// [Nonce][Ciphertext][Mac]
+	OutEncryptedData.SetNumUninitialized(NonceSize + InPlainData.Num() + MacSize);
+	uint8* Nonce = OutEncryptedData.GetData();
+	uint8* Ciphertext = Nonce + NonceSize;
+	uint8* Mac = Ciphertext + InPlainData.Num();
+
+	if (FillRandomBytes(Nonce, NonceSize) == false)
+	{
+		PRINT_LOG(LogJWNU_TokenCipher, Error, TEXT("Secure random source is unavailable, refusing to encrypt!"));
+		OutEncryptedData.Reset();
+		return false;
+	}
+	FMemory::Memcpy(Ciphertext, InPlainData.GetData(), InPlainData.Num());
+	ApplyKeyStream(Nonce, Ciphertext, InPlainData.Num());
+	ComputeMac(Nonce, NonceSize + InPlainData.Num(), Mac);
+	return true;
+}
+
+bool FJWNU_PortableTokenCipher::Decrypt(const TArray<uint8>& InEncryptedData, TArray<uint8>& OutPlainData) const
+{
+	using namespace JWNU_TokenCipher_Private;
+
+	if (InEncryptedData.Num() < NonceSize + MacSize)
+	{
+		PRINT_LOG(LogJWNU_TokenCipher, Warning, TEXT("Encrypted data is too short!"));
+		return false;
+	}
+
+	const int32 CiphertextSize = InEncryptedData.Num() - NonceSize - MacSize;
+	const uint8* Nonce = InEncryptedData.GetData();
+	const uint8* Ciphertext = Nonce + NonceSize;
+	const uint8* Mac = Ciphertext + CiphertextSize;
+
+	// 복호화 전에 무결성부터 검증
+	uint8 ExpectedMac[MacSize];
+	ComputeMac(Nonce, NonceSize + CiphertextSize, ExpectedMac);
+	if (ConstantTimeEquals(Mac, ExpectedMac, MacSize) == false)
+	{
+		PRINT_LOG(LogJWNU_TokenCipher, Warning, TEXT("Integrity check failed! Wrong key or tampered data."));
+		return false;
+	}
+
+	OutPlainData.SetNumUninitialized(CiphertextSize);
+	FMemory::Memcpy(OutPlainData.GetData(), Ciphertext, CiphertextSize);
+	ApplyKeyStream(Nonce, OutPlainData.GetData(), CiphertextSize);
+	return true;
+}
+
+void FJWNU_PortableTokenCipher::ApplyKeyStream(const uint8* InNonce, uint8* InOutData, const int32 InNum) const
+{
+	using namespace JWNU_TokenCipher_Private;
+
+	if (InNum <= 0)
+	{
+		return;
+	}
+
+	// 카운터 블록을 한 번에 만들어 AES 블록 암호화로 키 스트림을 생성
+	const int32 NumBlocks = FMath::DivideAndRoundUp(InNum, static_cast<int32>(FAES::AESBlockSize));
+	TArray<uint8> KeyStream;
+	KeyStream.SetNumUninitialized(NumBlocks * FAES::AESBlockSize);
+	for (int32 Block = 0; Block < NumBlocks; Block++)
+	{
+		uint8* Counter = KeyStream.GetData() + Block * FAES::AESBlockSize;
+		FMemory::Memcpy(Counter, InNonce, NonceSize);
+
+		// 논스 뒤쪽 4바이트에 블록 번호를 빅엔디안으로 더한다
+		uint32 Carry = static_cast<uint32>(Block);
+		for (int32 Index = NonceSize - 1; Index >= NonceSize - 4 && Carry > 0; Index--)
+		{
+			const uint32 Sum = Counter[Index] + (Carry & 0xFF);
+			Counter[Index] = static_cast<uint8>(Sum);
+			Carry = (Carry >> 8) + (Sum >> 8);
+		}
+	}
+
+	FAES::FAESKey AESKey;
+	FMemory::Memcpy(AESKey.Key, EncryptionKey, FAES::FAESKey::KeySize);
+	FAES::EncryptData(KeyStream.GetData(), KeyStream.Num(), AESKey);
+
+	for (int32 i = 0; i < InNum; i++)
+	{
+		InOutData[i] ^= KeyStream[i];
+	}
+}
+
+void FJWNU_PortableTokenCipher::ComputeMac(const uint8* InData, const int32 InNum, uint8* OutMac) const
+{
+	FSHA1::HMACBuffer(MacKey, sizeof(MacKey), InData, InNum, OutMac);
+}
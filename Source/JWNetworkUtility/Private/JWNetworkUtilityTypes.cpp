@@ -1,3 +1,16 @@
 ﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
 
 #include "JWNetworkUtilityTypes.h"
+#include "JWNU_JsonStructWriter.h"
+
+FString FJWNU_ApiError::ToResponseBody() const
+{
+	FJWNU_RES_Base ErrorResult;
+	ErrorResult.Success = false;
+	ErrorResult.Code = Code;
+	ErrorResult.Message = Message;
+
+	FString ResponseBody;
+	FJWNU_JsonStructWriter::WriteString(ErrorResult, ResponseBody);
+	return ResponseBody;
+}
@@ -0,0 +1,48 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#include "JWNU_RequestDescriptor.h"
+#include "JWNU_HttpRequestJob.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * 직렬화가 끝난 1MB POST 바디가 요청 바디 인자 → 요청 기술자 → Job 초기화를 거치는 동안 한 번도 복사되거나 재할당되지 않는지 검사한다.
+ * 버퍼 주소와 길이가 처음과 같다면 이동만 일어났다는 뜻이고, Job이 같은 기술자 인스턴스를 참조한다면 Job 쪽에서도 복사가 없다는 뜻이다.
+ * 예외로, 시도마다 IHttpRequest::SetContent가 HTTP 모듈 쪽 버퍼로 한 번 복사하는 것은 엔진 인터페이스가 const 참조만 받기 때문에 피할 수 없으며, 이 테스트의 범위 밖이다.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJWNU_RequestBodyZeroCopyTest, "JWNetworkUtility.RequestBody.ZeroCopyPostBody", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FJWNU_RequestBodyZeroCopyTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 BodySize = 1024 * 1024;
+
+	// 직렬화가 끝난 바디를 흉내 낸 1MB 버퍼
+	TArray<uint8> SerializedBody;
+	SerializedBody.SetNumUninitialized(BodySize);
+	FMemory::Memset(SerializedBody.GetData(), 'a', BodySize);
+	const uint8* const OriginalData = SerializedBody.GetData();
+
+	// 1. 요청 바디 인자로 이동
+	FJWNU_RequestBody Body(MoveTemp(SerializedBody));
+	TestEqual(TEXT("Source buffer is emptied by the move into the body"), SerializedBody.Num(), 0);
+
+	// 2. 요청 기술자로 이동
+	const FJWNU_RequestDescriptorRef Descriptor = FJWNU_RequestDescriptor::Create(EJWNU_HttpMethod::Post, EJWNU_ServiceType::GameServer, TEXT("https://example.com/api"), MoveTemp(Body), TMap<FString, FString>(), FJWNU_RequestConfig());
+	TestTrue(TEXT("Descriptor keeps the original body buffer"), Descriptor->GetContentBytes().GetData() == OriginalData);
+	TestEqual(TEXT("Descriptor body size is unchanged"), Descriptor->GetContentBytes().Num(), BodySize);
+	TestTrue(TEXT("Body argument is empty after the descriptor consumed it"), Body.IsEmpty());
+
+	// 3. Job 초기화, 기술자를 복사하지 않고 참조만 보관해야 한다
+	const int32 RefCountBeforeJob = Descriptor.GetSharedReferenceCount();
+	UJWNU_HttpRequestJob* Job = NewObject<UJWNU_HttpRequestJob>(GetTransientPackage());
+	Job->Initialize(Descriptor, FString());
+	TestEqual(TEXT("Job shares the descriptor instance instead of copying it"), Descriptor.GetSharedReferenceCount(), RefCountBeforeJob + 1);
+	TestTrue(TEXT("Job reads the URL from the shared descriptor"), &Job->GetURL() == &Descriptor->GetURL());
+	TestTrue(TEXT("Descriptor still owns the original body buffer after Job initialization"), Descriptor->GetContentBytes().GetData() == OriginalData);
+
+	return true;
+}
+
+#endif
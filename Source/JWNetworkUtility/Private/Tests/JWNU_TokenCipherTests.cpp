@@ -0,0 +1,229 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#include "JWNU_TokenCipher.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Base64.h"
+#include "Misc/AES.h"
+#include "Misc/SecureHash.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace JWNU_TokenCipherTests_Private
+{
+	constexpr EAutomationTestFlags TestFlags = EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter;
+
+	/** 포터블 백엔드의 암호문 오버헤드 [Nonce 16 bytes][HMAC 20 bytes] */
+	constexpr int32 CiphertextOverhead = FAES::AESBlockSize + FSHA1::DigestSize;
+
+	TArray<uint8> FromHex(const TCHAR* InHex)
+	{
+		const FString Hex(InHex);
+		TArray<uint8> Bytes;
+		Bytes.SetNumUninitialized(Hex.Len() / 2);
+		HexToBytes(Hex, Bytes.GetData());
+		return Bytes;
+	}
+
+	TArray<uint8> MakeSamplePlainData()
+	{
+		// 블록 경계에 맞지 않는 길이로 마지막 부분 블록까지 검사한다
+		const FTCHARToUTF8 Converter(TEXT("{\"refreshToken\":\"eyJhbGciOiJIUzI1NiJ9.sample.signature\",\"userId\":42}"));
+		return TArray<uint8>(reinterpret_cast<const uint8*>(Converter.Get()), Converter.Length());
+	}
+
+	/**
+	 * 테스트 동안 JWNU_KEYSTORE_KEY를 바꿔 두고, 끝나면 원래 값으로 되돌리는 헬퍼.
+	 */
+	struct FScopedKeystoreKey
+	{
+		explicit FScopedKeystoreKey(const FString& InValue)
+			: PreviousValue(FPlatformMisc::GetEnvironmentVariable(TEXT("JWNU_KEYSTORE_KEY")))
+		{
+			FPlatformMisc::SetEnvironmentVar(TEXT("JWNU_KEYSTORE_KEY"), *InValue);
+		}
+
+		~FScopedKeystoreKey()
+		{
+			FPlatformMisc::SetEnvironmentVar(TEXT("JWNU_KEYSTORE_KEY"), *PreviousValue);
+		}
+
+		const FString PreviousValue;
+	};
+}
+
+/**
+ * NIST SP 800-38A F.5.5 (CTR-AES256.Encrypt) 벡터로 키 스트림을 검증한다.
+ * 초기 카운터의 뒤쪽 바이트가 fe ff에서 ff 00으로 넘어가므로, 블록 번호를 더할 때의 자리 올림까지 확인할 수 있다.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJWNU_PortableTokenCipherKnownAnswerTest, "JWNetworkUtility.TokenCipher.Portable.CtrKnownAnswer", JWNU_TokenCipherTests_Private::TestFlags)
+
+bool FJWNU_PortableTokenCipherKnownAnswerTest::RunTest(const FString& Parameters)
+{
+	using namespace JWNU_TokenCipherTests_Private;
+
+	const TArray<uint8> Key = FromHex(TEXT("603deb1015ca71be2b73aef0857d77811f352c073b6108d72d9810a30914dff4"));
+	const TArray<uint8> InitialCounter = FromHex(TEXT("f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff"));
+	const TArray<uint8> PlainData = FromHex(TEXT(
+		"6bc1bee22e409f96e93d7e117393172a"
+		"ae2d8a571e03ac9c9eb76fac45af8e51"
+		"30c81c46a35ce411e5fbc1191a0a52ef"
+		"f69f2445df4f9b17ad2b417be66c3710"));
+	const TArray<uint8> ExpectedCiphertext = FromHex(TEXT(
+		"601ec313775789a5b7a7f504bbf3d228"
+		"f443e3ca4d62b59aca84e990cacaf5c5"
+		"2b0930daa23de94ce87017ba2d84988d"
+		"dfc9c58db67aada613c2dd08457941a6"));
+
+	// 키 유도를 건너뛰고 벡터의 키를 그대로 사용
+	FJWNU_PortableTokenCipher Cipher(TArray<uint8>{});
+	FMemory::Memcpy(Cipher.EncryptionKey, Key.GetData(), sizeof(Cipher.EncryptionKey));
+
+	TArray<uint8> Data = PlainData;
+	Cipher.ApplyKeyStream(InitialCounter.GetData(), Data.GetData(), Data.Num());
+	TestTrue(TEXT("Key stream matches the SP 800-38A CTR-AES256 vector"), Data == ExpectedCiphertext);
+
+	// 부분 블록도 같은 키 스트림의 앞부분을 써야 한다
+	TArray<uint8> Partial(PlainData.GetData(), 20);
+	Cipher.ApplyKeyStream(InitialCounter.GetData(), Partial.GetData(), Partial.Num());
+	TestTrue(TEXT("Partial block uses the prefix of the key stream"), FMemory::Memcmp(Partial.GetData(), ExpectedCiphertext.GetData(), Partial.Num()) == 0);
+
+	// CTR 모드는 같은 키 스트림을 다시 적용하면 평문으로 돌아온다
+	Cipher.ApplyKeyStream(InitialCounter.GetData(), Data.GetData(), Data.Num());
+	TestTrue(TEXT("Applying the key stream twice restores the plain data"), Data == PlainData);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJWNU_PortableTokenCipherRoundTripTest, "JWNetworkUtility.TokenCipher.Portable.RoundTrip", JWNU_TokenCipherTests_Private::TestFlags)
+
+bool FJWNU_PortableTokenCipherRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace JWNU_TokenCipherTests_Private;
+
+	const FJWNU_PortableTokenCipher Cipher(FromHex(TEXT("000102030405060708090a0b0c0d0e0f")));
+	const TArray<uint8> PlainData = MakeSamplePlainData();
+
+	TArray<uint8> EncryptedData;
+	if (TestTrue(TEXT("Encrypt succeeds"), Cipher.Encrypt(PlainData, EncryptedData)) == false)
+	{
+		return false;
+	}
+	TestEqual(TEXT("Ciphertext carries the nonce and MAC"), EncryptedData.Num(), PlainData.Num() + CiphertextOverhead);
+
+	TArray<uint8> DecryptedData;
+	TestTrue(TEXT("Decrypt succeeds"), Cipher.Decrypt(EncryptedData, DecryptedData));
+	TestTrue(TEXT("Round trip restores the plain data"), DecryptedData == PlainData);
+
+	// 논스가 매번 새로 뽑히므로 같은 평문이라도 암호문이 달라야 한다
+	TArray<uint8> SecondEncryptedData;
+	TestTrue(TEXT("Second encrypt succeeds"), Cipher.Encrypt(PlainData, SecondEncryptedData));
+	TestTrue(TEXT("Each encryption uses a fresh nonce"), SecondEncryptedData != EncryptedData);
+
+	// 빈 평문도 오버헤드만 가진 암호문으로 왕복해야 한다
+	TArray<uint8> EmptyEncryptedData;
+	TArray<uint8> EmptyDecryptedData;
+	TestTrue(TEXT("Empty plain data encrypts"), Cipher.Encrypt(TArray<uint8>(), EmptyEncryptedData));
+	TestEqual(TEXT("Empty ciphertext is only the overhead"), EmptyEncryptedData.Num(), CiphertextOverhead);
+	TestTrue(TEXT("Empty ciphertext decrypts"), Cipher.Decrypt(EmptyEncryptedData, EmptyDecryptedData));
+	TestEqual(TEXT("Empty round trip stays empty"), EmptyDecryptedData.Num(), 0);
+
+	return true;
+}
+
+/**
+ * 논스, 암호문, MAC 중 어느 한 비트라도 바뀌면 복호화가 무결성 검증에서 실패해야 한다.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJWNU_PortableTokenCipherTamperTest, "JWNetworkUtility.TokenCipher.Portable.BitFlipFailsMac", JWNU_TokenCipherTests_Private::TestFlags)
+
+bool FJWNU_PortableTokenCipherTamperTest::RunTest(const FString& Parameters)
+{
+	using namespace JWNU_TokenCipherTests_Private;
+
+	const FJWNU_PortableTokenCipher Cipher(FromHex(TEXT("000102030405060708090a0b0c0d0e0f")));
+	const FJWNU_PortableTokenCipher OtherCipher(FromHex(TEXT("0f0e0d0c0b0a09080706050403020100")));
+	const TArray<uint8> PlainData = MakeSamplePlainData();
+
+	TArray<uint8> EncryptedData;
+	if (TestTrue(TEXT("Encrypt succeeds"), Cipher.Encrypt(PlainData, EncryptedData)) == false)
+	{
+		return false;
+	}
+
+	const TPair<const TCHAR*, int32> FlipTargets[] =
+	{
+		{ TEXT("nonce"), 0 },
+		{ TEXT("ciphertext"), FAES::AESBlockSize + 3 },
+		{ TEXT("MAC"), EncryptedData.Num() - 1 },
+	};
+
+	AddExpectedError(TEXT("Integrity check failed"), EAutomationExpectedErrorFlags::Contains, UE_ARRAY_COUNT(FlipTargets) + 1);
+	for (const TPair<const TCHAR*, int32>& Target : FlipTargets)
+	{
+		TArray<uint8> TamperedData = EncryptedData;
+		TamperedData[Target.Value] ^= 0x01;
+
+		TArray<uint8> DecryptedData;
+		TestFalse(FString::Printf(TEXT("Flipping a bit in the %s fails the MAC"), Target.Key), Cipher.Decrypt(TamperedData, DecryptedData));
+		TestEqual(FString::Printf(TEXT("No plain data is produced after tampering the %s"), Target.Key), DecryptedData.Num(), 0);
+	}
+
+	// 다른 키로 만든 백엔드도 같은 이유로 거부해야 한다
+	TArray<uint8> WrongKeyData;
+	TestFalse(TEXT("Decrypting with another key fails the MAC"), OtherCipher.Decrypt(EncryptedData, WrongKeyData));
+
+	// 논스와 MAC보다 짧은 입력은 검증 전에 거부한다
+	AddExpectedError(TEXT("Encrypted data is too short"), EAutomationExpectedErrorFlags::Contains, 1);
+	TArray<uint8> TruncatedData(EncryptedData.GetData(), CiphertextOverhead - 1);
+	TArray<uint8> TruncatedPlainData;
+	TestFalse(TEXT("Truncated data is rejected"), Cipher.Decrypt(TruncatedData, TruncatedPlainData));
+
+	return true;
+}
+
+/**
+ * JWNU_KEYSTORE_KEY로 주입한 키가 있으면 CreateById가 솔트 파일 없이 그 키로 백엔드를 만드는지 검사한다.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJWNU_PortableTokenCipherInjectedKeyTest, "JWNetworkUtility.TokenCipher.Portable.InjectedKey", JWNU_TokenCipherTests_Private::TestFlags)
+
+bool FJWNU_PortableTokenCipherInjectedKeyTest::RunTest(const FString& Parameters)
+{
+	using namespace JWNU_TokenCipherTests_Private;
+
+	const TArray<uint8> MasterKey = FromHex(TEXT("8f2e4c6a1b3d5f7092a4c6e8f0123456789abcdef0123456789abcdef0123456"));
+	const FJWNU_PortableTokenCipher ExpectedCipher(MasterKey);
+	const TArray<uint8> PlainData = MakeSamplePlainData();
+
+	TArray<uint8> EncryptedData;
+	{
+		const FScopedKeystoreKey ScopedKey(FBase64::Encode(MasterKey));
+		const TSharedPtr<IJWNU_TokenCipher, ESPMode::ThreadSafe> Cipher = IJWNU_TokenCipher::CreateById(EJWNU_TokenCipherId::PortableAes);
+		if (TestTrue(TEXT("CreateById returns the portable backend"), Cipher.IsValid()) == false)
+		{
+			return false;
+		}
+		TestTrue(TEXT("Backend reports the portable cipher id"), Cipher->GetCipherId() == EJWNU_TokenCipherId::PortableAes);
+		TestTrue(TEXT("Encrypt with the injected key succeeds"), Cipher->Encrypt(PlainData, EncryptedData));
+	}
+
+	// 같은 키를 직접 넘긴 백엔드로 풀린다면 주입한 키가 그대로 마스터 키로 쓰였다는 뜻이다
+	TArray<uint8> DecryptedData;
+	TestTrue(TEXT("Backend built from the same master key decrypts"), ExpectedCipher.Decrypt(EncryptedData, DecryptedData));
+	TestTrue(TEXT("Injected key round trip restores the plain data"), DecryptedData == PlainData);
+
+	// Base64가 아닌 값은 UTF-8 바이트를 그대로 마스터 키로 쓴다
+	{
+		const FScopedKeystoreKey ScopedKey(TEXT("not*base64*secret"));
+		const TSharedPtr<IJWNU_TokenCipher, ESPMode::ThreadSafe> Cipher = IJWNU_TokenCipher::CreateById(EJWNU_TokenCipherId::PortableAes);
+		const FTCHARToUTF8 Converter(TEXT("not*base64*secret"));
+		const FJWNU_PortableTokenCipher RawKeyCipher(TArray<uint8>(reinterpret_cast<const uint8*>(Converter.Get()), Converter.Length()));
+
+		TArray<uint8> RawEncryptedData;
+		TArray<uint8> RawDecryptedData;
+		TestTrue(TEXT("Encrypt with the raw injected key succeeds"), Cipher.IsValid() && Cipher->Encrypt(PlainData, RawEncryptedData));
+		TestTrue(TEXT("Raw injected key is used as the master key"), RawKeyCipher.Decrypt(RawEncryptedData, RawDecryptedData) && RawDecryptedData == PlainData);
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,216 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "JWNU_Coroutine.h"
+#include "JWNU_GIS_HttpRequestJobProcessor.h"
+#include <atomic>
+
+/**
+ * 클래스 전용 로그 카테고리 선언
+ */
+JWNETWORKUTILITY_API DECLARE_LOG_CATEGORY_EXTERN(LogJWNU_ApiSubmitter, Log, All);
+
+/**
+ * FJWNU_ApiSubmitter로 제출한 호출 하나. 어느 스레드에서든 취소하거나 상태를 조회할 수 있다.
+ */
+class JWNETWORKUTILITY_API FJWNU_ApiSubmission : public TSharedFromThis<FJWNU_ApiSubmission, ESPMode::ThreadSafe>
+{
+public:
+	FJWNU_ApiSubmission(const TSharedRef<FJWNU_RequestSubmissionQueue, ESPMode::ThreadSafe>& InQueue, const ENamedThreads::Type InCompletionThread);
+
+	/**
+	 * 호출을 취소한다. 아직 보내지 않았다면 보내지 않고, 진행 중이라면 다음 드레인 때 게임 스레드에서 Job을 취소한다.
+	 * 완료 콜백은 호출되지 않는다. (결과 전달이 이미 시작된 뒤의 취소는 효과가 없다)
+	 */
+	void Cancel();
+
+	bool IsCancelled() const { return bCancelled.load(std::memory_order_acquire); }
+
+	/**
+	 * 결과 전달이 시작되었는지 여부. (완료 스레드에서 콜백이 아직 실행 중일 수 있다)
+	 */
+	bool IsCompleted() const { return bCompleted.load(std::memory_order_acquire); }
+
+private:
+	friend class FJWNU_ApiSubmitter;
+
+	/**
+	 * 결과 전달 권한을 얻는 함수. 취소되었거나 이미 전달했다면 false를 반환한다.
+	 */
+	bool TryBeginDelivery();
+
+	/**
+	 * 제출 시 지정한 스레드에서 전달 함수를 실행한다. 지정한 스레드가 게임 스레드이고 지금 게임 스레드라면 곧바로 실행한다.
+	 */
+	void DispatchToCompletionThread(TUniqueFunction<void()>&& InDelivery) const;
+
+	TWeakPtr<FJWNU_RequestSubmissionQueue, ESPMode::ThreadSafe> Queue;
+	ENamedThreads::Type CompletionThread;
+	std::atomic<bool> bCancelled = false;
+	std::atomic<bool> bCompleted = false;
+
+	/**
+	 * 보낸 요청의 핸들. (게임 스레드에서만 접근)
+	 */
+	FJWNU_RequestHandle Handle;
+};
+
+/**
+ * 게임 스레드 밖에서 UJWNU_GIS_ApiClientService 호출을 제출하는 객체.
+ * 세이브 동기화나 통계 집계처럼 워커 스레드에서 도는 작업이 게임 스레드로 돌아가지 않고 요청을 보낼 수 있게 한다.
+ * 제출은 프로세서의 락 없는 제출 큐에 적재되고, 다음 틱에 게임 스레드에서 CallApi_Template과 같은 경로(호스트, 인증 토큰, 401 리프레시, 경로 정책)로 보내진다.
+ * 결과는 제출 시 지정한 스레드로 전달된다. 생성은 게임 스레드에서 하고, 생성한 뒤에는 어느 스레드에서든 사용할 수 있다.
+ *
+ *	// 게임 스레드
+ *	ApiSubmitter = FJWNU_ApiSubmitter::Create(this);
+ *	// 워커 스레드
+ *	ApiSubmitter->CallApi<FMySyncResponse>(EJWNU_HttpMethod::Post, EJWNU_ServiceType::GameServer, TEXT("/save/sync"), MoveTemp(BodyBytes), {},
+ *		[](TJWNU_ApiResult<FMySyncResponse>&& Result) { ... }, ENamedThreads::AnyBackgroundThreadNormalTask);
+ */
+class JWNETWORKUTILITY_API FJWNU_ApiSubmitter : public TSharedFromThis<FJWNU_ApiSubmitter, ESPMode::ThreadSafe>
+{
+public:
+	using FSubmissionRef = TSharedRef<FJWNU_ApiSubmission, ESPMode::ThreadSafe>;
+
+	/**
+	 * 제출 객체를 생성하는 함수. 게임 스레드에서만 호출한다.
+	 * @param WorldContextObject 월드 컨텍스트 오브젝트
+	 * @return 제출 객체 (서비스를 찾지 못하면 nullptr)
+	 */
+	static TSharedPtr<FJWNU_ApiSubmitter, ESPMode::ThreadSafe> Create(const UObject* WorldContextObject);
+
+	FJWNU_ApiSubmitter(UJWNU_GIS_ApiClientService* InService, const TSharedRef<FJWNU_RequestSubmissionQueue, ESPMode::ThreadSafe>& InQueue);
+
+	/**
+	 * API 호출을 제출하는 함수. 어느 스레드에서든 호출할 수 있다.
+	 * 바디는 이 시점에 UTF-8 바이트로 옮겨 두므로 호출 스레드의 버퍼가 사라져도 된다.
+	 * @tparam StructType JSON 리스폰스 바디에서 파싱하길 원하는 언리얼 구조체 타입
+	 * @param InMethod HTTP 메서드
+	 * @param InServiceType 서비스 타입
+	 * @param InEndpoint API 엔드포인트
+	 * @param InContentBody JSON 바디
+	 * @param InQueryParams URL 쿼리 패러미터
+	 * @param InOnCompleted 결과 콜백 (성공 또는 구조화된 에러, 한 번만 호출)
+	 * @param InCompletionThread 결과 콜백을 실행할 스레드
+	 * @param bRequiresAuth 인증 토큰 필요 여부
+	 * @param InIdentityContext 요청을 보낼 인증 컨텍스트 (nullptr 시 IdentityProvider의 기본 컨텍스트)
+	 * @param InRequestConfig 호출 단위 HTTP 리퀘스트 설정
+	 * @return 제출한 호출
+	 */
+	template<typename StructType>
+	FSubmissionRef CallApi(
+		const EJWNU_HttpMethod InMethod,
+		const EJWNU_ServiceType InServiceType,
+		const FStringView InEndpoint,
+		FJWNU_RequestBody InContentBody,
+		const TMap<FString, FString>& InQueryParams,
+		TFunction<void(TJWNU_ApiResult<StructType>&&)> InOnCompleted,
+		const ENamedThreads::Type InCompletionThread = ENamedThreads::AnyBackgroundThreadNormalTask,
+		const bool bRequiresAuth = true,
+		const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext = nullptr,
+		const TOptional<FJWNU_RequestConfig>& InRequestConfig = NullOpt) const
+	{
+		return Submit<StructType>(
+			[InMethod, InServiceType, Endpoint = FString(InEndpoint), BodyBytes = InContentBody.ConsumeUtf8(), InQueryParams, bRequiresAuth, InIdentityContext, InRequestConfig]
+			(UJWNU_GIS_ApiClientService* InService, TFunction<void(const StructType&)>&& OnResponse, TFunction<void(const FJWNU_ApiError&)>&& OnApiError) mutable
+			{
+				return UJWNU_GIS_ApiClientService::CallApi_Template<StructType>(InService, InMethod, InServiceType, Endpoint, FJWNU_RequestBody(MoveTemp(BodyBytes)), InQueryParams,
+					MoveTemp(OnResponse), FOnHttpRequestJobRetryDelegate(), bRequiresAuth, InIdentityContext, MoveTemp(OnApiError), InRequestConfig);
+			},
+			MoveTemp(InOnCompleted), InCompletionThread);
+	}
+
+	/**
+	 * 요청 구조체를 바디로 받는 CallApi. 요청 구조체는 복사해 두었다가 게임 스레드에서 UTF-8 바이트로 직렬화한다.
+	 * @tparam StructType JSON 리스폰스 바디에서 파싱하길 원하는 언리얼 구조체 타입
+	 * @tparam RequestStructType JSON 리퀘스트 바디로 직렬화할 언리얼 구조체 타입
+	 */
+	template<typename StructType, typename RequestStructType> requires TModels_V<CStaticStructProvider, RequestStructType>
+	FSubmissionRef CallApi(
+		const EJWNU_HttpMethod InMethod,
+		const EJWNU_ServiceType InServiceType,
+		const FStringView InEndpoint,
+		const RequestStructType& InRequestBody,
+		const TMap<FString, FString>& InQueryParams,
+		TFunction<void(TJWNU_ApiResult<StructType>&&)> InOnCompleted,
+		const ENamedThreads::Type InCompletionThread = ENamedThreads::AnyBackgroundThreadNormalTask,
+		const bool bRequiresAuth = true,
+		const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext = nullptr,
+		const TOptional<FJWNU_RequestConfig>& InRequestConfig = NullOpt) const
+	{
+		return Submit<StructType>(
+			[InMethod, InServiceType, Endpoint = FString(InEndpoint), RequestBody = InRequestBody, InQueryParams, bRequiresAuth, InIdentityContext, InRequestConfig]
+			(UJWNU_GIS_ApiClientService* InService, TFunction<void(const StructType&)>&& OnResponse, TFunction<void(const FJWNU_ApiError&)>&& OnApiError)
+			{
+				return UJWNU_GIS_ApiClientService::CallApi_Template<StructType, RequestStructType>(InService, InMethod, InServiceType, Endpoint, RequestBody, InQueryParams,
+					MoveTemp(OnResponse), FOnHttpRequestJobRetryDelegate(), bRequiresAuth, InIdentityContext, MoveTemp(OnApiError), InRequestConfig);
+			},
+			MoveTemp(InOnCompleted), InCompletionThread);
+	}
+
+private:
+	template<typename StructType>
+	using TLauncher = TUniqueFunction<FJWNU_RequestHandle(UJWNU_GIS_ApiClientService*, TFunction<void(const StructType&)>&&, TFunction<void(const FJWNU_ApiError&)>&&)>;
+
+	/**
+	 * 게임 스레드에서 요청을 보내는 함수를 제출 큐에 적재하고, 결과를 완료 스레드로 옮기는 콜백을 잇는다.
+	 */
+	template<typename StructType>
+	FSubmissionRef Submit(TLauncher<StructType>&& InLauncher, TFunction<void(TJWNU_ApiResult<StructType>&&)>&& InOnCompleted, const ENamedThreads::Type InCompletionThread) const
+	{
+		using FResult = TJWNU_ApiResult<StructType>;
+
+		const FSubmissionRef Submission = MakeShared<FJWNU_ApiSubmission, ESPMode::ThreadSafe>(Queue, InCompletionThread);
+
+		// 성공, 실패, 중단 경로가 함께 쓰므로 공유하고, 실제 전달은 한 번만 일어난다
+		const TSharedRef<TFunction<void(FResult&&)>, ESPMode::ThreadSafe> OnCompleted = MakeShared<TFunction<void(FResult&&)>, ESPMode::ThreadSafe>(MoveTemp(InOnCompleted));
+		auto Deliver = [Submission, OnCompleted](FResult&& InResult)
+		{
+			if (Submission->TryBeginDelivery() == false)
+			{
+				return;
+			}
+			Submission->DispatchToCompletionThread([OnCompleted, Result = MoveTemp(InResult)]() mutable
+			{
+				(*OnCompleted)(MoveTemp(Result));
+			});
+		};
+
+		Queue->Submit(
+			[WeakService = Service, Launcher = MoveTemp(InLauncher), Submission, Deliver]() mutable
+			{
+				if (Submission->IsCancelled())
+				{
+					return;
+				}
+
+				UJWNU_GIS_ApiClientService* ServicePtr = WeakService.Get();
+				const FJWNU_RequestHandle NewHandle = ServicePtr != nullptr ? Launcher(ServicePtr,
+					[Deliver](const StructType& InResponse) { Deliver(FResult(MakeValue(InResponse))); },
+					[Deliver](const FJWNU_ApiError& InError) { Deliver(FResult(MakeError(InError))); }) : FJWNU_RequestHandle();
+
+				// 서비스를 찾지 못해 콜백 없이 끝난 경우 (이미 에러를 전달했다면 무시된다)
+				if (NewHandle.IsValid() == false)
+				{
+					Deliver(FResult(MakeError(FJWNU_ApiError(TEXT("SERVICE_NOT_FOUND"), TEXT("Failed to get api client service")))));
+					return;
+				}
+				Submission->Handle = NewHandle;
+			},
+			[Deliver]()
+			{
+				Deliver(FResult(MakeError(FJWNU_ApiError(TEXT("SUBMISSION_QUEUE_CLOSED"), TEXT("Request submission queue is closed")))));
+			});
+
+		return Submission;
+	}
+
+	/**
+	 * 요청을 보낼 서비스. (게임 스레드에서만 역참조)
+	 */
+	TWeakObjectPtr<UJWNU_GIS_ApiClientService> Service;
+
+	TSharedRef<FJWNU_RequestSubmissionQueue, ESPMode::ThreadSafe> Queue;
+};
@@ -65,6 +65,24 @@ public:
 		const FOnHttpResponseBPEvent& InOnHttpResponse,
 		const FOnHttpRequestJobRetryBPEvent& InOnHttpRequestJobRetry,
 		const bool bRequiresAuth);
+
+	/**
+	 * [ Blueprint Function Library ] \n Call API Batch \n 여러 API를 한 번에 호출하고, 모두 끝나면 결과 배열을 한 번에 전달하는 함수.
+	 * 요청마다 블루프린트 이벤트와 핸들을 만들지 않고, 동시 실행 한도 안에서 준비된 요청을 곧바로 보낸다.
+	 * 각 요청은 단건 CallApi와 같은 경로(호스트, 인증 토큰, 401 리프레시, 경로 정책, 완료 디스패치 예산)를 거친다.
+	 * @param WorldContextObject 월드 컨텍스트 오브젝트
+	 * @param InRequests 보낼 요청 배열
+	 * @param InMaxConcurrency 동시에 진행할 최대 요청 수 (0 이하이면 제한 없음)
+	 * @param InOnCompleted 요청 순서대로 정렬된 결과 배열을 받는 블루프린트 이벤트
+	 * @param InOnItemCompleted 요청 하나가 끝날 때마다 호출되는 블루프린트 이벤트 (선택)
+	 */
+	UFUNCTION(BlueprintCallable, Category="JWNU Blueprint Function Library", meta=(WorldContext="WorldContextObject", AutoCreateRefTerm="InOnItemCompleted", InMaxConcurrency="4"))
+	static void CallApiBatch(
+		const UObject* WorldContextObject,
+		const TArray<FJWNU_ApiBatchRequest>& InRequests,
+		const int32 InMaxConcurrency,
+		const FOnApiBatchCompletedBPEvent& InOnCompleted,
+		const FOnApiBatchItemCompletedBPEvent& InOnItemCompleted);
 	
 	/**
 	 * [ Blueprint Function Library ] \n Load Refresh Token Container from WINDOWS \n 윈도우에 암호화되어 저장된 JWT 인증 리프레시 토큰 컨테이너를 로드하는 함수.
@@ -0,0 +1,889 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "JWNU_GIS_ApiClientService.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Templates/ValueOrError.h"
+#include <atomic>
+#include <concepts>
+#include <coroutine>
+
+/**
+ * 클래스 전용 로그 카테고리 선언
+ */
+JWNETWORKUTILITY_API DECLARE_LOG_CATEGORY_EXTERN(LogJWNU_Coroutine, Log, All);
+
+/**
+ * co_await JWNU::CallApi의 결과 타입. 성공 시 파싱된 응답 구조체, 실패 시 구조화된 에러를 담는다.
+ */
+template<typename StructType>
+using TJWNU_ApiResult = TValueOrError<StructType, FJWNU_ApiError>;
+
+// ──────── 코루틴 상태 ────────
+
+/**
+ * TJWNU_Task 코루틴 하나의 수명과 취소를 추적하는 상태 클래스. 코루틴 프레임보다 오래 살아남아 결과와 완료 여부를 보관한다.
+ * 코루틴은 취소 가능한 대기 지점(API 호출, 다른 작업, WhenAll/WhenAny)에서만 파괴된다. 파괴 시 지역 변수와 대기 객체의 소멸자가
+ * 진행 중인 UJWNU_HttpRequestJob을 취소하므로, 취소는 호출 체인 끝까지 그대로 전파된다.
+ * 게임 스레드 전용이다. (ResumeOn으로 다른 스레드에 있는 동안 들어온 취소는 다음 취소 가능한 대기 지점에서 처리된다)
+ */
+class JWNETWORKUTILITY_API FJWNU_TaskState : public TSharedFromThis<FJWNU_TaskState, ESPMode::ThreadSafe>
+{
+public:
+	virtual ~FJWNU_TaskState() = default;
+
+	/**
+	 * 코루틴을 취소하는 함수. 취소 가능한 지점에서 대기 중이라면 프레임을 즉시 파괴하고, 실행 중이라면 다음 대기 지점에서 파괴한다.
+	 * 이 작업을 기다리던 코루틴도 함께 취소된다. 이미 끝났다면 아무 일도 하지 않는다.
+	 */
+	void Cancel();
+
+	/**
+	 * 코루틴이 co_return까지 정상적으로 끝났는지 반환한다.
+	 */
+	bool IsDone() const { return bDone; }
+
+	/**
+	 * 코루틴이 취소됐는지 반환한다.
+	 */
+	bool IsCancelled() const { return bCancelled.load(std::memory_order_acquire); }
+
+	// ──────── 대기 객체 전용 내부 함수 ────────
+
+	/**
+	 * 프레임을 연결하는 내부 함수. (get_return_object에서 호출)
+	 */
+	void AttachFrame(const std::coroutine_handle<> InFrame) { Frame = InFrame; }
+
+	/**
+	 * 취소 가능한 지점에서 대기를 시작하는 내부 함수.
+	 */
+	void BeginSuspend() { bSuspended = true; }
+
+	/**
+	 * 대기를 끝내는 내부 함수. 이후 재개 전까지 들어온 취소는 다음 대기 지점으로 미뤄진다.
+	 */
+	void EndSuspend() { bSuspended = false; }
+
+	/**
+	 * 이 작업이 끝나면 재개할 코루틴을 등록하는 내부 함수.
+	 * @param InContinuation 재개할 프레임
+	 * @param InAwaitingState 재개할 코루틴의 상태 (이 작업이 취소되면 함께 취소)
+	 */
+	void SetContinuation(const std::coroutine_handle<> InContinuation, FJWNU_TaskState& InAwaitingState);
+
+	/**
+	 * 재개할 코루틴 등록을 해제하는 내부 함수. (기다리던 쪽이 먼저 파괴되는 경우)
+	 */
+	void ClearContinuation();
+
+	/**
+	 * 정상 종료를 기록하고 재개할 코루틴을 꺼내는 내부 함수. (final_suspend에서 호출)
+	 * @return 재개할 프레임 (없으면 빈 핸들)
+	 */
+	std::coroutine_handle<> MarkDone();
+
+	/**
+	 * 취소 요청이 들어온 채로 대기 지점에 도달한 프레임을 파괴하는 내부 함수.
+	 * 호출 후에는 프레임 안의 어떤 것(호출한 대기 객체 포함)에도 접근하면 안 된다.
+	 */
+	void DestroyCancelledFrame();
+
+private:
+	/**
+	 * 코루틴 프레임. 프레임이 파괴되면 비운다.
+	 */
+	std::coroutine_handle<> Frame;
+
+	/**
+	 * 이 작업을 기다리는 코루틴 프레임.
+	 */
+	std::coroutine_handle<> Continuation;
+
+	/**
+	 * 이 작업을 기다리는 코루틴의 상태.
+	 */
+	TWeakPtr<FJWNU_TaskState, ESPMode::ThreadSafe> AwaitingState;
+
+	/**
+	 * 취소 요청 여부. ResumeOn으로 옮겨 간 스레드에서도 읽는다.
+	 */
+	std::atomic<bool> bCancelled = false;
+
+	/**
+	 * 취소 가능한 지점에서 대기 중인지 여부.
+	 */
+	bool bSuspended = false;
+
+	bool bDone = false;
+};
+
+/**
+ * 결과 값을 보관하는 코루틴 상태.
+ */
+template<typename ResultType>
+class TJWNU_TaskState : public FJWNU_TaskState
+{
+public:
+	TOptional<ResultType> Result;
+};
+
+template<>
+class TJWNU_TaskState<void> : public FJWNU_TaskState
+{
+};
+
+/**
+ * 취소 가능한 대기 객체를 co_await할 수 있는 프라미스. (TJWNU_Task의 프라미스)
+ */
+template<typename PromiseType>
+concept CJWNU_TaskPromise = requires(PromiseType& InPromise)
+{
+	{ InPromise.GetTaskState() } -> std::same_as<FJWNU_TaskState&>;
+};
+
+// ──────── 작업 ────────
+
+template<typename ResultType>
+class TJWNU_Task;
+
+/**
+ * 코루틴이 끝나면 결과를 남기고 프레임을 파괴한 뒤, 기다리던 코루틴을 곧바로 재개하는 final_suspend 대기 객체.
+ */
+struct FJWNU_TaskFinalAwaiter
+{
+	FJWNU_TaskState* State;
+
+	bool await_ready() const noexcept { return false; }
+
+	std::coroutine_handle<> await_suspend(const std::coroutine_handle<> InFrame) const noexcept
+	{
+		const std::coroutine_handle<> Continuation = State->MarkDone();
+		InFrame.destroy();
+		return Continuation ? Continuation : std::noop_coroutine();
+	}
+
+	void await_resume() const noexcept {}
+};
+
+/**
+ * TJWNU_Task 프라미스의 공통 부분. 코루틴은 즉시 실행을 시작하고(eager), 끝나면 스스로 프레임을 파괴한다.
+ */
+template<typename ResultType>
+class TJWNU_TaskPromiseBase
+{
+public:
+	std::suspend_never initial_suspend() const noexcept { return {}; }
+	FJWNU_TaskFinalAwaiter final_suspend() const noexcept { return FJWNU_TaskFinalAwaiter{ &State.Get() }; }
+
+	void unhandled_exception() const
+	{
+		checkf(false, TEXT("Unhandled exception in JWNU coroutine"));
+	}
+
+	FJWNU_TaskState& GetTaskState() { return State.Get(); }
+
+protected:
+	TSharedRef<TJWNU_TaskState<ResultType>, ESPMode::ThreadSafe> State = MakeShared<TJWNU_TaskState<ResultType>, ESPMode::ThreadSafe>();
+};
+
+template<typename ResultType>
+class TJWNU_TaskPromise : public TJWNU_TaskPromiseBase<ResultType>
+{
+public:
+	TJWNU_Task<ResultType> get_return_object();
+
+	template<typename ValueType>
+	void return_value(ValueType&& InValue)
+	{
+		this->State->Result.Emplace(Forward<ValueType>(InValue));
+	}
+};
+
+template<>
+class TJWNU_TaskPromise<void> : public TJWNU_TaskPromiseBase<void>
+{
+public:
+	TJWNU_Task<void> get_return_object();
+
+	void return_void() const {}
+};
+
+/**
+ * JWNU 코루틴의 반환 타입. 호출 즉시 첫 대기 지점까지 실행되며, 반환값을 버려도 코루틴은 끝까지 진행된다.
+ * 다른 TJWNU_Task 안에서 co_await하면 결과를 기다리고, 기다리던 코루틴이 취소되면 이 작업도 취소된다.
+ * 여러 작업을 동시에 진행하려면 먼저 모두 호출해 두고 차례로 co_await하면 된다.
+ * @tparam ResultType co_return 값 타입 (void 가능)
+ */
+template<typename ResultType>
+class [[nodiscard]] TJWNU_Task
+{
+public:
+	using promise_type = TJWNU_TaskPromise<ResultType>;
+
+	explicit TJWNU_Task(const TSharedRef<TJWNU_TaskState<ResultType>, ESPMode::ThreadSafe>& InState)
+		: State(InState)
+	{
+	}
+
+	/**
+	 * 코루틴을 취소하는 함수. 진행 중인 HTTP 요청까지 취소된다.
+	 */
+	void Cancel() const { State->Cancel(); }
+
+	bool IsDone() const { return State->IsDone(); }
+
+	bool IsCancelled() const { return State->IsCancelled(); }
+
+	/**
+	 * co_return 값을 반환한다. IsDone()이 true일 때만 호출해야 한다.
+	 */
+	template<typename T = ResultType> requires (std::is_void_v<T> == false)
+	const T& GetResult() const
+	{
+		check(State->IsDone());
+		return State->Result.GetValue();
+	}
+
+	/**
+	 * 다른 코루틴에서 이 작업을 기다리는 대기 객체.
+	 */
+	class FAwaiter
+	{
+	public:
+		FAwaiter(const TSharedRef<TJWNU_TaskState<ResultType>, ESPMode::ThreadSafe>& InState, const bool bInMoveResult)
+			: State(InState), bMoveResult(bInMoveResult)
+		{
+		}
+
+		FAwaiter(FAwaiter&&) = default;
+		FAwaiter(const FAwaiter&) = delete;
+
+		~FAwaiter()
+		{
+			// 기다리는 도중에 이쪽 프레임이 파괴됐다면 기다리던 작업도 취소
+			if (AwaitingState)
+			{
+				State->ClearContinuation();
+				State->Cancel();
+			}
+		}
+
+		bool await_ready() const { return State->IsDone(); }
+
+		template<CJWNU_TaskPromise PromiseType>
+		bool await_suspend(const std::coroutine_handle<PromiseType> InFrame)
+		{
+			FJWNU_TaskState& TaskState = InFrame.promise().GetTaskState();
+			if (TaskState.IsCancelled() || State->IsCancelled())
+			{
+				TaskState.Cancel();
+				TaskState.DestroyCancelledFrame();
+				return true;
+			}
+
+			AwaitingState = &TaskState;
+			TaskState.BeginSuspend();
+			State->SetContinuation(InFrame, TaskState);
+			return true;
+		}
+
+		ResultType await_resume()
+		{
+			if (AwaitingState)
+			{
+				AwaitingState->EndSuspend();
+				AwaitingState = nullptr;
+			}
+			if constexpr (std::is_void_v<ResultType> == false)
+			{
+				return bMoveResult ? MoveTemp(State->Result.GetValue()) : State->Result.GetValue();
+			}
+		}
+
+	private:
+		TSharedRef<TJWNU_TaskState<ResultType>, ESPMode::ThreadSafe> State;
+		FJWNU_TaskState* AwaitingState = nullptr;
+		bool bMoveResult;
+	};
+
+	FAwaiter operator co_await() const & { return FAwaiter(State, false); }
+	FAwaiter operator co_await() && { return FAwaiter(State, true); }
+
+private:
+	TSharedRef<TJWNU_TaskState<ResultType>, ESPMode::ThreadSafe> State;
+};
+
+template<typename ResultType>
+TJWNU_Task<ResultType> TJWNU_TaskPromise<ResultType>::get_return_object()
+{
+	this->State->AttachFrame(std::coroutine_handle<TJWNU_TaskPromise>::from_promise(*this));
+	return TJWNU_Task<ResultType>(this->State);
+}
+
+inline TJWNU_Task<void> TJWNU_TaskPromise<void>::get_return_object()
+{
+	State->AttachFrame(std::coroutine_handle<TJWNU_TaskPromise>::from_promise(*this));
+	return TJWNU_Task<void>(State);
+}
+
+// ──────── API 호출 대기 ────────
+
+/**
+ * co_await 한 번에 대응하는 API 호출 하나. 대기 객체가 시작시키고, 대기 객체가 파괴될 때 끝나지 않았다면 요청을 취소한다.
+ * 요청 핸들을 값으로 들고 있으므로 호출자는 핸들을 따로 보관할 필요가 없다.
+ */
+template<typename StructType>
+class TJWNU_ApiOperation : public TSharedFromThis<TJWNU_ApiOperation<StructType>, ESPMode::ThreadSafe>
+{
+public:
+	using FResult = TJWNU_ApiResult<StructType>;
+	using FLauncher = TUniqueFunction<FJWNU_RequestHandle(TFunction<void(const StructType&)>&&, TFunction<void(const FJWNU_ApiError&)>&&)>;
+
+	explicit TJWNU_ApiOperation(FLauncher&& InLauncher)
+		: Launcher(MoveTemp(InLauncher))
+	{
+	}
+
+	/**
+	 * 요청을 보낸다. 보내기 전에 실패했다면 이 안에서 곧바로 완료된다.
+	 */
+	void Start()
+	{
+		if (bStarted)
+		{
+			return;
+		}
+		bStarted = true;
+
+		// 보내기 전 실패로 곧바로 완료되어 소유자가 참조를 놓더라도 이 함수가 끝날 때까지 유지
+		const TSharedRef<TJWNU_ApiOperation, ESPMode::ThreadSafe> KeepAlive = this->AsShared();
+		const TWeakPtr<TJWNU_ApiOperation, ESPMode::ThreadSafe> WeakThis = KeepAlive;
+		const FJWNU_RequestHandle NewHandle = Launcher(
+			[WeakThis](const StructType& InResponse)
+			{
+				if (const auto Pinned = WeakThis.Pin())
+				{
+					Pinned->Complete(FResult(MakeValue(InResponse)));
+				}
+			},
+			[WeakThis](const FJWNU_ApiError& InError)
+			{
+				if (const auto Pinned = WeakThis.Pin())
+				{
+					Pinned->Complete(FResult(MakeError(InError)));
+				}
+			});
+		Launcher = nullptr;
+
+		if (Result.IsSet())
+		{
+			return;
+		}
+		if (NewHandle.IsValid() == false)
+		{
+			// 서비스를 찾지 못해 콜백 없이 끝난 경우
+			Complete(FResult(MakeError(FJWNU_ApiError(TEXT("SERVICE_NOT_FOUND"), TEXT("Failed to get api client service")))));
+			return;
+		}
+		Handle = NewHandle;
+	}
+
+	/**
+	 * 진행 중인 요청을 취소한다. 이후 도착하는 결과는 버린다.
+	 */
+	void Cancel()
+	{
+		if (Result.IsSet() || bCancelled)
+		{
+			return;
+		}
+		bCancelled = true;
+		OnCompleted = nullptr;
+		Handle.Cancel();
+		Handle.Reset();
+	}
+
+	bool IsCompleted() const { return Result.IsSet(); }
+
+	FResult TakeResult()
+	{
+		check(Result.IsSet());
+		return MoveTemp(Result.GetValue());
+	}
+
+	/**
+	 * 완료 시 한 번 호출되는 콜백. (대기 객체가 코루틴 재개에 사용)
+	 */
+	TFunction<void()> OnCompleted;
+
+private:
+	void Complete(FResult&& InResult)
+	{
+		if (bCancelled || Result.IsSet())
+		{
+			return;
+		}
+		Result.Emplace(MoveTemp(InResult));
+		Handle.Reset();
+		if (OnCompleted)
+		{
+			const TFunction<void()> Callback = MoveTemp(OnCompleted);
+			OnCompleted = nullptr;
+			Callback();
+		}
+	}
+
+	FLauncher Launcher;
+	FJWNU_RequestHandle Handle;
+	TOptional<FResult> Result;
+	bool bStarted = false;
+	bool bCancelled = false;
+};
+
+template<typename... StructTypes>
+class TJWNU_WhenAllAwaiter;
+
+template<typename StructType>
+class TJWNU_WhenAnyAwaiter;
+
+/**
+ * JWNU::CallApi가 반환하는 대기 객체. co_await 시점에 요청을 보내고, 결과가 도착하면 지정한 스레드(기본 게임 스레드)에서 코루틴을 재개한다.
+ * co_await하지 않고 버리면 요청은 보내지 않는다. 대기 중에 코루틴이 취소되면 소멸자가 요청을 취소한다.
+ */
+template<typename StructType>
+class [[nodiscard]] TJWNU_ApiAwaiter
+{
+public:
+	using FOperation = TJWNU_ApiOperation<StructType>;
+
+	explicit TJWNU_ApiAwaiter(typename FOperation::FLauncher&& InLauncher)
+		: Operation(MakeShared<FOperation, ESPMode::ThreadSafe>(MoveTemp(InLauncher)))
+	{
+	}
+
+	TJWNU_ApiAwaiter(TJWNU_ApiAwaiter&&) = default;
+	TJWNU_ApiAwaiter& operator=(TJWNU_ApiAwaiter&&) = default;
+	TJWNU_ApiAwaiter(const TJWNU_ApiAwaiter&) = delete;
+	TJWNU_ApiAwaiter& operator=(const TJWNU_ApiAwaiter&) = delete;
+
+	~TJWNU_ApiAwaiter()
+	{
+		if (Operation.IsValid())
+		{
+			Operation->Cancel();
+		}
+	}
+
+	/**
+	 * 결과를 받은 뒤 코루틴을 재개할 스레드를 지정하는 함수.
+	 * @param InThread 재개할 스레드 (예: ENamedThreads::AnyBackgroundThreadNormalTask)
+	 */
+	TJWNU_ApiAwaiter&& ResumeOn(const ENamedThreads::Type InThread) &&
+	{
+		ResumeThread = InThread;
+		return MoveTemp(*this);
+	}
+
+	bool await_ready() const { return false; }
+
+	template<CJWNU_TaskPromise PromiseType>
+	bool await_suspend(const std::coroutine_handle<PromiseType> InFrame)
+	{
+		FJWNU_TaskState& TaskState = InFrame.promise().GetTaskState();
+		if (TaskState.IsCancelled())
+		{
+			TaskState.DestroyCancelledFrame();
+			return true;
+		}
+
+		Operation->Start();
+		if (Operation->IsCompleted())
+		{
+			return false;
+		}
+
+		TaskState.BeginSuspend();
+		Operation->OnCompleted = [InFrame, &TaskState, Thread = ResumeThread]()
+		{
+			// 다른 스레드로 넘기는 동안에는 프레임이 파괴되지 않도록 취소 가능 구간을 먼저 끝낸다
+			TaskState.EndSuspend();
+			if (Thread == ENamedThreads::GameThread && IsInGameThread())
+			{
+				InFrame.resume();
+				return;
+			}
+			AsyncTask(Thread, [InFrame]() { InFrame.resume(); });
+		};
+		return true;
+	}
+
+	TJWNU_ApiResult<StructType> await_resume()
+	{
+		return Operation->TakeResult();
+	}
+
+private:
+	template<typename... StructTypes>
+	friend class TJWNU_WhenAllAwaiter;
+
+	template<typename OtherStructType>
+	friend class TJWNU_WhenAnyAwaiter;
+
+	friend class FJWNU_RequestGraph;
+
+	TSharedPtr<FOperation, ESPMode::ThreadSafe> Operation;
+	ENamedThreads::Type ResumeThread = ENamedThreads::GameThread;
+};
+
+// ──────── 병렬 대기 ────────
+
+/**
+ * 여러 API 호출을 한꺼번에 보내고 모두 끝나면 게임 스레드에서 재개하는 대기 객체. 결과는 인자 순서대로 튜플에 담긴다.
+ * 대기 중에 코루틴이 취소되면 아직 끝나지 않은 요청을 모두 취소한다.
+ */
+template<typename... StructTypes>
+class [[nodiscard]] TJWNU_WhenAllAwaiter
+{
+public:
+	explicit TJWNU_WhenAllAwaiter(TJWNU_ApiAwaiter<StructTypes>&&... InAwaiters)
+		: Operations(MoveTemp(InAwaiters.Operation)...)
+	{
+	}
+
+	TJWNU_WhenAllAwaiter(TJWNU_WhenAllAwaiter&&) = default;
+	TJWNU_WhenAllAwaiter(const TJWNU_WhenAllAwaiter&) = delete;
+
+	~TJWNU_WhenAllAwaiter()
+	{
+		VisitTupleElements([](auto& InOperation) { if (InOperation.IsValid()) { InOperation->Cancel(); } }, Operations);
+	}
+
+	bool await_ready() const { return false; }
+
+	template<CJWNU_TaskPromise PromiseType>
+	bool await_suspend(const std::coroutine_handle<PromiseType> InFrame)
+	{
+		FJWNU_TaskState& TaskState = InFrame.promise().GetTaskState();
+		if (TaskState.IsCancelled())
+		{
+			TaskState.DestroyCancelledFrame();
+			return true;
+		}
+
+		VisitTupleElements([this](auto& InOperation)
+		{
+			InOperation->Start();
+			if (InOperation->IsCompleted() == false)
+			{
+				++Remaining;
+			}
+		}, Operations);
+		if (Remaining == 0)
+		{
+			return false;
+		}
+
+		TaskState.BeginSuspend();
+		VisitTupleElements([this, InFrame, &TaskState](auto& InOperation)
+		{
+			if (InOperation->IsCompleted() == false)
+			{
+				InOperation->OnCompleted = [this, InFrame, &TaskState]()
+				{
+					if (--Remaining == 0)
+					{
+						TaskState.EndSuspend();
+						InFrame.resume();
+					}
+				};
+			}
+		}, Operations);
+		return true;
+	}
+
+	TTuple<TJWNU_ApiResult<StructTypes>...> await_resume()
+	{
+		return Operations.ApplyAfter([](auto&... InOperations)
+		{
+			return TTuple<TJWNU_ApiResult<StructTypes>...>(InOperations->TakeResult()...);
+		});
+	}
+
+private:
+	TTuple<TSharedPtr<TJWNU_ApiOperation<StructTypes>, ESPMode::ThreadSafe>...> Operations;
+	int32 Remaining = 0;
+};
+
+/**
+ * 같은 응답 타입의 API 호출들을 한꺼번에 보내고, 가장 먼저 끝난 하나(성공 또는 실패)로 게임 스레드에서 재개하는 대기 객체.
+ * 나머지 요청은 그 즉시 취소된다. 결과는 끝난 호출의 인덱스와 결과 쌍이다.
+ */
+template<typename StructType>
+class [[nodiscard]] TJWNU_WhenAnyAwaiter
+{
+public:
+	explicit TJWNU_WhenAnyAwaiter(TArray<TJWNU_ApiAwaiter<StructType>>&& InAwaiters)
+	{
+		check(InAwaiters.Num() > 0);
+		Operations.Reserve(InAwaiters.Num());
+		for (TJWNU_ApiAwaiter<StructType>& Awaiter : InAwaiters)
+		{
+			Operations.Add(MoveTemp(Awaiter.Operation));
+		}
+	}
+
+	TJWNU_WhenAnyAwaiter(TJWNU_WhenAnyAwaiter&&) = default;
+	TJWNU_WhenAnyAwaiter(const TJWNU_WhenAnyAwaiter&) = delete;
+
+	~TJWNU_WhenAnyAwaiter()
+	{
+		CancelOthers(INDEX_NONE);
+	}
+
+	bool await_ready() const { return false; }
+
+	template<CJWNU_TaskPromise PromiseType>
+	bool await_suspend(const std::coroutine_handle<PromiseType> InFrame)
+	{
+		FJWNU_TaskState& TaskState = InFrame.promise().GetTaskState();
+		if (TaskState.IsCancelled())
+		{
+			TaskState.DestroyCancelledFrame();
+			return true;
+		}
+
+		for (int32 Index = 0; Index < Operations.Num(); ++Index)
+		{
+			Operations[Index]->Start();
+			if (Operations[Index]->IsCompleted())
+			{
+				WinnerIndex = Index;
+				CancelOthers(Index);
+				return false;
+			}
+		}
+
+		TaskState.BeginSuspend();
+		for (int32 Index = 0; Index < Operations.Num(); ++Index)
+		{
+			Operations[Index]->OnCompleted = [this, InFrame, &TaskState, Index]()
+			{
+				WinnerIndex = Index;
+				CancelOthers(Index);
+				TaskState.EndSuspend();
+				InFrame.resume();
+			};
+		}
+		return true;
+	}
+
+	TPair<int32, TJWNU_ApiResult<StructType>> await_resume()
+	{
+		return TPair<int32, TJWNU_ApiResult<StructType>>(WinnerIndex, Operations[WinnerIndex]->TakeResult());
+	}
+
+private:
+	void CancelOthers(const int32 InWinnerIndex)
+	{
+		for (int32 Index = 0; Index < Operations.Num(); ++Index)
+		{
+			if (Index != InWinnerIndex && Operations[Index].IsValid())
+			{
+				Operations[Index]->Cancel();
+			}
+		}
+	}
+
+	TArray<TSharedPtr<TJWNU_ApiOperation<StructType>, ESPMode::ThreadSafe>> Operations;
+	int32 WinnerIndex = INDEX_NONE;
+};
+
+/**
+ * 지정한 스레드로 코루틴을 옮기는 대기 객체. 옮기는 도중에는 취소되지 않고, 들어온 취소는 다음 취소 가능한 대기 지점에서 처리된다.
+ */
+struct FJWNU_ResumeOnAwaiter
+{
+	ENamedThreads::Type Thread;
+
+	bool await_ready() const
+	{
+		return Thread == ENamedThreads::GameThread && IsInGameThread();
+	}
+
+	void await_suspend(const std::coroutine_handle<> InFrame) const
+	{
+		AsyncTask(Thread, [InFrame]() { InFrame.resume(); });
+	}
+
+	void await_resume() const {}
+};
+
+// ──────── 진입점 ────────
+
+namespace JWNU
+{
+	/**
+	 * co_await로 기다리는 API 호출. CallApi_Template과 같은 경로(호스트, 인증 토큰, 401 리프레시, 경로 정책)를 거치며,
+	 * 콜백과 핸들 대신 TJWNU_ApiResult를 돌려준다. 바디는 이 시점에 UTF-8 바이트로 옮겨 두고, 요청은 co_await 시점에 보낸다.
+	 * 예: const auto Profile = co_await JWNU::CallApi<FMyProfileResponse>(this, EJWNU_HttpMethod::Get, EJWNU_ServiceType::GameServer, TEXT("/profile"));
+	 * @tparam StructType JSON 리스폰스 바디에서 파싱하길 원하는 언리얼 구조체 타입
+	 * @param WorldContextObject 월드 컨텍스트 오브젝트
+	 * @param InMethod HTTP 메서드
+	 * @param InServiceType 서비스 타입
+	 * @param InEndpoint API 엔드포인트
+	 * @param InContentBody JSON 바디
+	 * @param InQueryParams URL 쿼리 패러미터
+	 * @param bRequiresAuth 인증 토큰 필요 여부
+	 * @param InIdentityContext 요청을 보낼 인증 컨텍스트 (nullptr 시 IdentityProvider의 기본 컨텍스트)
+	 * @param InRequestConfig 호출 단위 HTTP 리퀘스트 설정
+	 * @return co_await할 대기 객체
+	 */
+	template<typename StructType>
+	TJWNU_ApiAwaiter<StructType> CallApi(
+		const UObject* WorldContextObject,
+		const EJWNU_HttpMethod InMethod,
+		const EJWNU_ServiceType InServiceType,
+		const FStringView InEndpoint,
+		FJWNU_RequestBody InContentBody = FJWNU_RequestBody(),
+		const TMap<FString, FString>& InQueryParams = {},
+		const bool bRequiresAuth = true,
+		const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext = nullptr,
+		const TOptional<FJWNU_RequestConfig>& InRequestConfig = NullOpt)
+	{
+		return TJWNU_ApiAwaiter<StructType>(
+			[WeakContext = TWeakObjectPtr<const UObject>(WorldContextObject), InMethod, InServiceType, Endpoint = FString(InEndpoint), BodyBytes = InContentBody.ConsumeUtf8(), InQueryParams, bRequiresAuth, InIdentityContext, InRequestConfig]
+			(TFunction<void(const StructType&)>&& OnResponse, TFunction<void(const FJWNU_ApiError&)>&& OnApiError) mutable
+			{
+				return UJWNU_GIS_ApiClientService::CallApi_Template<StructType>(WeakContext.Get(), InMethod, InServiceType, Endpoint, FJWNU_RequestBody(MoveTemp(BodyBytes)), InQueryParams,
+					MoveTemp(OnResponse), FOnHttpRequestJobRetryDelegate(), bRequiresAuth, InIdentityContext, MoveTemp(OnApiError), InRequestConfig);
+			});
+	}
+
+	/**
+	 * 요청 구조체를 바디로 받는 CallApi. 요청 구조체는 이 시점에 UTF-8 바이트 버퍼로 한 번만 직렬화된다.
+	 * @tparam StructType JSON 리스폰스 바디에서 파싱하길 원하는 언리얼 구조체 타입
+	 * @tparam RequestStructType JSON 리퀘스트 바디로 직렬화할 언리얼 구조체 타입
+	 */
+	template<typename StructType, typename RequestStructType> requires TModels_V<CStaticStructProvider, RequestStructType>
+	TJWNU_ApiAwaiter<StructType> CallApi(
+		const UObject* WorldContextObject,
+		const EJWNU_HttpMethod InMethod,
+		const EJWNU_ServiceType InServiceType,
+		const FStringView InEndpoint,
+		const RequestStructType& InRequestBody,
+		const TMap<FString, FString>& InQueryParams = {},
+		const bool bRequiresAuth = true,
+		const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext = nullptr,
+		const TOptional<FJWNU_RequestConfig>& InRequestConfig = NullOpt)
+	{
+		TArray<uint8> BodyBytes;
+		if (FJWNU_JsonStructWriter::WriteUtf8(InRequestBody, BodyBytes) == false)
+		{
+			PRINT_LOG(LogJWNU_Coroutine, Warning, TEXT("Failed to serialize request body! (%s)"), *FString(InEndpoint));
+			return TJWNU_ApiAwaiter<StructType>(
+				[](TFunction<void(const StructType&)>&&, TFunction<void(const FJWNU_ApiError&)>&& OnApiError) -> FJWNU_RequestHandle
+				{
+					OnApiError(FJWNU_ApiError(TEXT("REQUEST_SERIALIZE_ERROR"), TEXT("Failed to serialize request body")));
+					return FJWNU_RequestHandle();
+				});
+		}
+		return CallApi<StructType>(WorldContextObject, InMethod, InServiceType, InEndpoint, FJWNU_RequestBody(MoveTemp(BodyBytes)), InQueryParams, bRequiresAuth, InIdentityContext, InRequestConfig);
+	}
+
+	/**
+	 * co_await로 기다리는 CallEndpoint. 요청 구조체와 경로 패러미터는 이 시점에 복사해 두고, 요청은 co_await 시점에 보낸다.
+	 * @tparam EndpointType 엔드포인트 선언 타입
+	 */
+	template<CJWNU_Endpoint EndpointType> requires (TJWNU_EndpointTraits<EndpointType>::bHasRequestBody)
+	TJWNU_ApiAwaiter<typename TJWNU_EndpointTraits<EndpointType>::ResponseType> CallEndpoint(
+		const UObject* WorldContextObject,
+		const typename TJWNU_EndpointTraits<EndpointType>::RequestType& InRequestBody,
+		const TJWNU_PathParams<TJWNU_EndpointTraits<EndpointType>::PathParamCount>& InPathParams = {},
+		const TMap<FString, FString>& InQueryParams = {},
+		const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext = nullptr,
+		const TOptional<FJWNU_RequestConfig>& InRequestConfig = NullOpt)
+	{
+		using FTraits = TJWNU_EndpointTraits<EndpointType>;
+		using FResponse = typename FTraits::ResponseType;
+		TArray<FString> PathParams;
+		PathParams.Reserve(FTraits::PathParamCount);
+		for (const FStringView Param : InPathParams.GetView())
+		{
+			PathParams.Emplace(Param);
+		}
+		return TJWNU_ApiAwaiter<FResponse>(
+			[WeakContext = TWeakObjectPtr<const UObject>(WorldContextObject), RequestBody = InRequestBody, PathParams = MoveTemp(PathParams), InQueryParams, InIdentityContext, InRequestConfig]
+			(TFunction<void(const FResponse&)>&& OnResponse, TFunction<void(const FJWNU_ApiError&)>&& OnApiError)
+			{
+				return [&]<int32... Indices>(TIntegerSequence<int32, Indices...>)
+				{
+					return UJWNU_GIS_ApiClientService::CallEndpoint<EndpointType>(WeakContext.Get(), RequestBody, MoveTemp(OnResponse), TJWNU_PathParams<FTraits::PathParamCount>(PathParams[Indices]...),
+						InQueryParams, FOnHttpRequestJobRetryDelegate(), InIdentityContext, MoveTemp(OnApiError), InRequestConfig);
+				}(TMakeIntegerSequence<int32, FTraits::PathParamCount>());
+			});
+	}
+
+	/**
+	 * 바디가 없는 엔드포인트를 co_await로 기다리는 CallEndpoint.
+	 * @tparam EndpointType 엔드포인트 선언 타입
+	 */
+	template<CJWNU_Endpoint EndpointType> requires (TJWNU_EndpointTraits<EndpointType>::bHasRequestBody == false)
+	TJWNU_ApiAwaiter<typename TJWNU_EndpointTraits<EndpointType>::ResponseType> CallEndpoint(
+		const UObject* WorldContextObject,
+		const TJWNU_PathParams<TJWNU_EndpointTraits<EndpointType>::PathParamCount>& InPathParams = {},
+		const TMap<FString, FString>& InQueryParams = {},
+		const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext = nullptr,
+		const TOptional<FJWNU_RequestConfig>& InRequestConfig = NullOpt)
+	{
+		using FTraits = TJWNU_EndpointTraits<EndpointType>;
+		using FResponse = typename FTraits::ResponseType;
+		TArray<FString> PathParams;
+		PathParams.Reserve(FTraits::PathParamCount);
+		for (const FStringView Param : InPathParams.GetView())
+		{
+			PathParams.Emplace(Param);
+		}
+		return TJWNU_ApiAwaiter<FResponse>(
+			[WeakContext = TWeakObjectPtr<const UObject>(WorldContextObject), PathParams = MoveTemp(PathParams), InQueryParams, InIdentityContext, InRequestConfig]
+			(TFunction<void(const FResponse&)>&& OnResponse, TFunction<void(const FJWNU_ApiError&)>&& OnApiError)
+			{
+				return [&]<int32... Indices>(TIntegerSequence<int32, Indices...>)
+				{
+					return UJWNU_GIS_ApiClientService::CallEndpoint<EndpointType>(WeakContext.Get(), MoveTemp(OnResponse), TJWNU_PathParams<FTraits::PathParamCount>(PathParams[Indices]...),
+						InQueryParams, FOnHttpRequestJobRetryDelegate(), InIdentityContext, MoveTemp(OnApiError), InRequestConfig);
+				}(TMakeIntegerSequence<int32, FTraits::PathParamCount>());
+			});
+	}
+
+	/**
+	 * 여러 API 호출을 동시에 보내고 모두 끝날 때까지 기다린다. 응답 타입이 달라도 된다.
+	 * 예: const auto [Profile, Inventory] = co_await JWNU::WhenAll(JWNU::CallApi<FProfile>(...), JWNU::CallApi<FInventory>(...));
+	 */
+	template<typename... StructTypes>
+	TJWNU_WhenAllAwaiter<StructTypes...> WhenAll(TJWNU_ApiAwaiter<StructTypes>&&... InAwaiters)
+	{
+		return TJWNU_WhenAllAwaiter<StructTypes...>(MoveTemp(InAwaiters)...);
+	}
+
+	/**
+	 * 같은 응답 타입의 API 호출들을 동시에 보내고 가장 먼저 끝난 하나를 기다린다. 나머지는 취소된다.
+	 * @return co_await 결과는 (끝난 호출의 인덱스, 결과) 쌍
+	 */
+	template<typename StructType>
+	TJWNU_WhenAnyAwaiter<StructType> WhenAny(TArray<TJWNU_ApiAwaiter<StructType>>&& InAwaiters)
+	{
+		return TJWNU_WhenAnyAwaiter<StructType>(MoveTemp(InAwaiters));
+	}
+
+	/**
+	 * 이후 코드를 지정한 스레드에서 이어서 실행한다. (예: 큰 결과를 백그라운드에서 가공한 뒤 게임 스레드로 복귀)
+	 * API 호출은 게임 스레드에서 보내야 하므로, 다른 스레드로 옮겼다면 co_await JWNU::ResumeOn(ENamedThreads::GameThread)로 돌아온 뒤 호출한다.
+	 */
+	inline FJWNU_ResumeOnAwaiter ResumeOn(const ENamedThreads::Type InThread)
+	{
+		return FJWNU_ResumeOnAwaiter{ InThread };
+	}
+}
@@ -0,0 +1,282 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "JWNetworkUtilityTypes.h"
+#include <concepts>
+#include <type_traits>
+
+// ──────── 컴파일 타임 유틸리티 ────────
+
+/**
+ * 메서드와 경로 템플릿으로 엔드포인트의 안정적인 64비트 식별자를 계산하는 constexpr FNV-1a 해시.
+ * 컴파일 타임에 계산되므로 메트릭과 정책을 URL 문자열 해시 없이 이 값으로 찾는다.
+ * @param InMethod HTTP 메서드
+ * @param InPath 경로 템플릿 (예: "/users/{userId}/items")
+ * @return 엔드포인트 식별자
+ */
+constexpr uint64 JWNU_MakeEndpointId(const EJWNU_HttpMethod InMethod, const TCHAR* InPath)
+{
+	uint64 Hash = 0xcbf29ce484222325ull;
+	Hash = (Hash ^ static_cast<uint64>(InMethod)) * 0x100000001b3ull;
+	for (; *InPath != 0; ++InPath)
+	{
+		Hash = (Hash ^ static_cast<uint64>(*InPath)) * 0x100000001b3ull;
+	}
+	return Hash;
+}
+
+/**
+ * 경로 템플릿의 {패러미터} 수를 세는 constexpr 함수.
+ * @param InPath 경로 템플릿
+ * @return 패러미터 수
+ */
+constexpr int32 JWNU_CountPathParams(const TCHAR* InPath)
+{
+	int32 Count = 0;
+	for (; *InPath != 0; ++InPath)
+	{
+		Count += *InPath == TEXT('{') ? 1 : 0;
+	}
+	return Count;
+}
+
+/**
+ * 경로 템플릿이 '/'로 시작하고, 중괄호가 중첩 없이 짝을 이루며, 빈 패러미터가 없는지 검사하는 constexpr 함수.
+ * @param InPath 경로 템플릿
+ * @return 올바르면 true
+ */
+constexpr bool JWNU_IsValidPathTemplate(const TCHAR* InPath)
+{
+	if (*InPath != TEXT('/'))
+	{
+		return false;
+	}
+	bool bInParam = false;
+	bool bEmptyParam = false;
+	for (; *InPath != 0; ++InPath)
+	{
+		if (*InPath == TEXT('{'))
+		{
+			if (bInParam)
+			{
+				return false;
+			}
+			bInParam = true;
+			bEmptyParam = true;
+		}
+		else if (*InPath == TEXT('}'))
+		{
+			if (bInParam == false || bEmptyParam)
+			{
+				return false;
+			}
+			bInParam = false;
+		}
+		else
+		{
+			bEmptyParam = false;
+		}
+	}
+	return bInParam == false;
+}
+
+// ──────── 엔드포인트 정보 ────────
+
+/**
+ * 엔드포인트 하나의 런타임 정보. 엔드포인트 타입마다 처음 사용될 때 한 번만 만들어지고 이후 바뀌지 않는다.
+ * 경로 템플릿은 이때 리터럴 조각으로 미리 분해되므로, 호출마다 템플릿을 다시 파싱하지 않고 조각과 패러미터를 이어 붙이기만 한다.
+ */
+class JWNETWORKUTILITY_API FJWNU_EndpointInfo
+{
+public:
+	/**
+	 * 기본 동작 설정에 엔드포인트 정책을 덮어쓰는 함수 타입.
+	 */
+	using FApplyPolicyFunc = void (*)(FJWNU_RequestConfig& /*InOutConfig*/);
+
+	/**
+	 * @param InId 엔드포인트 식별자
+	 * @param InPathTemplate 경로 템플릿
+	 * @param InMethod HTTP 메서드
+	 * @param InServiceType 서비스 타입
+	 * @param bInRequiresAuth 인증 토큰 필요 여부
+	 * @param InApplyPolicy 기본 동작 설정에 엔드포인트 정책을 덮어쓰는 함수 (없으면 nullptr)
+	 */
+	FJWNU_EndpointInfo(
+		const uint64 InId,
+		const TCHAR* InPathTemplate,
+		const EJWNU_HttpMethod InMethod,
+		const EJWNU_ServiceType InServiceType,
+		const bool bInRequiresAuth,
+		const FApplyPolicyFunc InApplyPolicy);
+
+	FJWNU_EndpointInfo(const FJWNU_EndpointInfo&) = delete;
+	FJWNU_EndpointInfo& operator=(const FJWNU_EndpointInfo&) = delete;
+
+	FORCEINLINE uint64 GetId() const { return Id; }
+
+	FORCEINLINE const TCHAR* GetPathTemplate() const { return PathTemplate; }
+
+	FORCEINLINE EJWNU_HttpMethod GetMethod() const { return Method; }
+
+	FORCEINLINE EJWNU_ServiceType GetServiceType() const { return ServiceType; }
+
+	FORCEINLINE bool RequiresAuth() const { return bRequiresAuth; }
+
+	FORCEINLINE int32 GetPathParamCount() const { return LiteralFragments.Num() - 1; }
+
+	/**
+	 * 미리 분해해 둔 리터럴 조각 사이에 패러미터를 URL 인코딩해 끼워 넣어 경로를 이어 붙이는 함수.
+	 * @param OutPath 경로를 이어 붙일 문자열 빌더
+	 * @param InPathParams 경로 패러미터 (템플릿 순서대로, 개수는 컴파일 타임에 검사된다)
+	 */
+	void AppendPath(FStringBuilderBase& OutPath, TConstArrayView<FStringView> InPathParams) const;
+
+	/**
+	 * 기본 동작 설정에 이 엔드포인트의 재시도, 타임아웃, 우선순위 정책을 덮어쓰는 함수.
+	 * @param InOutConfig 동작 설정
+	 */
+	void ApplyPolicy(FJWNU_RequestConfig& InOutConfig) const;
+
+private:
+	const uint64 Id;
+	const TCHAR* const PathTemplate;
+	const EJWNU_HttpMethod Method;
+	const EJWNU_ServiceType ServiceType;
+	const bool bRequiresAuth;
+	const FApplyPolicyFunc ApplyPolicyFunc;
+
+	/**
+	 * 패러미터 자리를 기준으로 나눈 리터럴 조각. (패러미터 수 + 1개)
+	 */
+	TArray<FString> LiteralFragments;
+};
+
+// ──────── 엔드포인트 선언 ────────
+
+/**
+ * 엔드포인트 선언 타입이 갖춰야 하는 멤버.
+ * Path, Method, ServiceType, RequestType(바디가 없으면 void), ResponseType은 필수이고,
+ * bRequiresAuth(기본 true)와 static void ApplyPolicy(FJWNU_RequestConfig&)는 선택이다.
+ */
+template <typename EndpointType>
+concept CJWNU_Endpoint = requires
+{
+	{ EndpointType::Path } -> std::convertible_to<const TCHAR*>;
+	{ EndpointType::Method } -> std::convertible_to<EJWNU_HttpMethod>;
+	{ EndpointType::ServiceType } -> std::convertible_to<EJWNU_ServiceType>;
+	typename EndpointType::RequestType;
+	typename EndpointType::ResponseType;
+};
+
+/**
+ * 엔드포인트 선언 타입에서 식별자, 패러미터 수, 런타임 정보를 컴파일 타임에 뽑아내는 트레이트.
+ * 경로 템플릿 형식과 요청/응답 구조체 타입은 여기서 static_assert로 검사되므로, 잘못된 선언은 호출 지점에서 컴파일되지 않는다.
+ */
+template <CJWNU_Endpoint EndpointType>
+struct TJWNU_EndpointTraits
+{
+	using RequestType = typename EndpointType::RequestType;
+	using ResponseType = typename EndpointType::ResponseType;
+
+	static_assert(JWNU_IsValidPathTemplate(EndpointType::Path), "Endpoint path must start with '/' and use non-empty, non-nested {param} placeholders");
+	static_assert(std::is_void_v<RequestType> || TModels_V<CStaticStructProvider, RequestType>, "Endpoint RequestType must be void or a USTRUCT");
+	static_assert(TModels_V<CStaticStructProvider, ResponseType>, "Endpoint ResponseType must be a USTRUCT");
+	static_assert(std::is_base_of_v<FJWNU_RES_Base, ResponseType>, "Endpoint ResponseType must derive from FJWNU_RES_Base");
+
+	static constexpr uint64 Id = JWNU_MakeEndpointId(EndpointType::Method, EndpointType::Path);
+	static constexpr int32 PathParamCount = JWNU_CountPathParams(EndpointType::Path);
+	static constexpr bool bHasRequestBody = std::is_void_v<RequestType> == false;
+
+	static_assert(bHasRequestBody == false || (EndpointType::Method != EJWNU_HttpMethod::Get && EndpointType::Method != EJWNU_HttpMethod::Delete), "GET/DELETE endpoints must declare RequestType as void");
+
+	static constexpr bool bRequiresAuth = []
+	{
+		if constexpr (requires { EndpointType::bRequiresAuth; })
+		{
+			return static_cast<bool>(EndpointType::bRequiresAuth);
+		}
+		else
+		{
+			return true;
+		}
+	}();
+
+	/**
+	 * 엔드포인트의 런타임 정보를 반환한다. 처음 호출될 때 한 번만 만들어진다. (스레드 안전)
+	 */
+	static const FJWNU_EndpointInfo& GetInfo()
+	{
+		static const FJWNU_EndpointInfo Info(Id, EndpointType::Path, EndpointType::Method, EndpointType::ServiceType, bRequiresAuth, GetApplyPolicy());
+		return Info;
+	}
+
+private:
+	static constexpr FJWNU_EndpointInfo::FApplyPolicyFunc GetApplyPolicy()
+	{
+		if constexpr (requires (FJWNU_RequestConfig& Config) { EndpointType::ApplyPolicy(Config); })
+		{
+			return &EndpointType::ApplyPolicy;
+		}
+		else
+		{
+			return nullptr;
+		}
+	}
+};
+
+/**
+ * 경로 패러미터 인자. 엔드포인트의 {패러미터} 수와 인자 수가 다르면 컴파일되지 않는다.
+ * 문자열은 참조만 하므로 함수 인자로만 사용한다.
+ */
+template <int32 NumParams>
+struct TJWNU_PathParams
+{
+	TJWNU_PathParams() requires (NumParams == 0) = default;
+
+	template <typename... ArgTypes> requires (NumParams > 0 && sizeof...(ArgTypes) == NumParams)
+	TJWNU_PathParams(const ArgTypes&... InArgs)
+		: Values{ FStringView(InArgs)... }
+	{
+	}
+
+	FORCEINLINE TConstArrayView<FStringView> GetView() const { return TConstArrayView<FStringView>(Values, NumParams); }
+
+private:
+	FStringView Values[NumParams > 0 ? NumParams : 1];
+};
+
+// ──────── 플러그인 내장 엔드포인트 ────────
+
+/**
+ * 엑세스 토큰 리프레시. 대기열의 모든 요청이 결과를 기다리므로 완료 콜백을 가장 먼저 디스패치한다.
+ */
+struct FJWNU_EP_AuthRefresh
+{
+	static constexpr const TCHAR* Path = TEXT("/auth/refresh");
+	static constexpr EJWNU_HttpMethod Method = EJWNU_HttpMethod::Post;
+	static constexpr EJWNU_ServiceType ServiceType = EJWNU_ServiceType::AuthServer;
+	static constexpr bool bRequiresAuth = false;
+	using RequestType = FJWNU_REQ_AuthRefresh;
+	using ResponseType = FJWNU_RES_AuthRefresh;
+
+	static void ApplyPolicy(FJWNU_RequestConfig& InOutConfig)
+	{
+		InOutConfig.Priority = EJWNU_RequestPriority::Critical;
+	}
+};
+
+/**
+ * 서버 상태 확인.
+ */
+struct FJWNU_EP_Health
+{
+	static constexpr const TCHAR* Path = TEXT("/health");
+	static constexpr EJWNU_HttpMethod Method = EJWNU_HttpMethod::Get;
+	static constexpr EJWNU_ServiceType ServiceType = EJWNU_ServiceType::AuthServer;
+	static constexpr bool bRequiresAuth = false;
+	using RequestType = void;
+	using ResponseType = FJWNU_RES_Base;
+};
@@ -0,0 +1,57 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 엔드포인트 경로 접두사를 가장 긴 일치로 찾는 접두사 트라이.
+ * 설정을 읽을 때 한 번만 구축하고, 자식 간선을 노드별로 정렬된 연속 배열에 모아 두므로 조회는 경로 길이만큼의 이진 탐색으로 끝난다.
+ * 구축 이후에는 읽기 전용이므로 여러 스레드에서 동시에 조회해도 안전하다.
+ */
+class JWNETWORKUTILITY_API FJWNU_EndpointPolicyTrie
+{
+public:
+	/**
+	 * 접두사 목록으로 트라이를 구축하는 함수. 같은 접두사가 여러 번 있다면 뒤의 항목이 이긴다.
+	 * @param InPrefixes 경로 접두사 목록 (값은 목록의 인덱스)
+	 */
+	void Build(TConstArrayView<FString> InPrefixes);
+
+	/**
+	 * 경로와 가장 길게 일치하는 접두사의 인덱스를 찾는 함수.
+	 * @param InPath 요청 경로 (예: "/users/42/items")
+	 * @return 접두사 인덱스 (일치하는 접두사가 없으면 INDEX_NONE)
+	 */
+	int32 FindLongestPrefix(const FStringView InPath) const;
+
+	FORCEINLINE bool IsEmpty() const { return Nodes.Num() <= 1; }
+
+private:
+	struct FNode
+	{
+		/**
+		 * EdgeChars, EdgeTargets에서 이 노드의 자식 간선이 시작하는 위치.
+		 */
+		int32 FirstEdge = 0;
+
+		int32 NumEdges = 0;
+
+		/**
+		 * 이 노드에서 끝나는 접두사의 인덱스. (없으면 INDEX_NONE)
+		 */
+		int32 Value = INDEX_NONE;
+	};
+
+	TArray<FNode> Nodes;
+
+	/**
+	 * 노드별로 정렬해 이어 붙인 자식 간선 문자.
+	 */
+	TArray<TCHAR> EdgeChars;
+
+	/**
+	 * EdgeChars와 같은 순서의 자식 노드 인덱스.
+	 */
+	TArray<int32> EdgeTargets;
+};
@@ -8,14 +8,20 @@
 #include "JWNetworkUtilityDelegates.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "JsonObjectConverter.h"
+#include "JWNU_JsonStructReader.h"
+#include "JWNU_JsonStructWriter.h"
+#include "JWNU_JsonArrayStreamReader.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "JWNU_GIS_HttpClientHelper.h"
 #include "JWNU_GIS_ApiIdentityProvider.h"
+#include "JWNU_IdentityContext.h"
 #include "JWNU_GIS_ApiHostProvider.h"
-#include "JWNU_HttpRequestJobHandle.h"
+#include "JWNU_RequestHandle.h"
 #include "Engine/Engine.h"
+#include "Containers/Ticker.h"
+#include "Async/Async.h"
 #include "JWNU_GIS_ApiClientService.generated.h"
 
 /**
@@ -23,6 +29,175 @@
  */
 JWNETWORKUTILITY_API DECLARE_LOG_CATEGORY_EXTERN(LogJWNU_GIS_ApiClientService, Log, All);
 
+/**
+ * 스트리밍 배열 호출에서 타입에 의존하는 부분(원소 변환과 청크 전달)만 담는 수신기 인터페이스. 전송 시도마다 새로 만들어진다.
+ */
+class IJWNU_StreamElementSink
+{
+public:
+	virtual ~IJWNU_StreamElementSink() = default;
+
+	/**
+	 * 닫힌 원소 하나의 UTF-8 바이트를 구조체로 변환해 청크에 담고, 청크가 차면 게임 스레드로 넘기는 함수. (HTTP 스레드)
+	 * @param InData 원소 JSON 바이트
+	 * @param InNum 바이트 수
+	 * @return 변환에 실패했다면 false (스트림 중단)
+	 */
+	virtual bool AddElement(const UTF8CHAR* InData, const int32 InNum) = 0;
+
+	/**
+	 * 청크를 채우지 못하고 남은 원소를 게임 스레드로 넘기는 함수. 완료 결과보다 먼저 호출된다.
+	 */
+	virtual void Flush() = 0;
+};
+
+/**
+ * HTTP 스레드의 토크나이저와 게임 스레드의 완료 콜백이 공유하는 원소 수신기 참조.
+ */
+using FJWNU_StreamElementSinkRef = TSharedRef<IJWNU_StreamElementSink, ESPMode::ThreadSafe>;
+
+/**
+ * CallApi_Template에서 타입에 의존하는 부분만 담는 썽크. 비템플릿 코어는 구조체 타입을 모른 채 이 썽크로 결과를 전달한다.
+ */
+struct FJWNU_ResponseThunk
+{
+	FJWNU_ResponseThunk(const UScriptStruct* InStruct, TFunction<void(const void*)>&& InDeliver, TFunction<void(const FJWNU_ApiError&)>&& InDeliverError = nullptr)
+		: Struct(InStruct), Deliver(MoveTemp(InDeliver)), DeliverError(MoveTemp(InDeliverError))
+	{
+	}
+
+	/**
+	 * 리스폰스 바디를 파싱할 구조체 타입. 에러 결과는 이 타입의 Code, Message 프로퍼티에 채운다.
+	 */
+	const UScriptStruct* Struct;
+
+	/**
+	 * 파싱이 끝난 구조체 메모리를 타입 콜백에 전달하는 함수.
+	 */
+	TFunction<void(const void* /*StructData*/)> Deliver;
+
+	/**
+	 * 실패를 구조화된 에러로 받는 콜백. (비어 있으면 에러를 구조체 타입의 Code, Message에 채워 Deliver로 전달)
+	 */
+	TFunction<void(const FJWNU_ApiError& /*Error*/)> DeliverError;
+
+	/**
+	 * 스트리밍 배열 호출 전용. (소유 서비스, 요청 핸들)로 전송 시도마다 원소 수신기를 새로 만드는 함수.
+	 * 설정되어 있으면 바디를 모으지 않고 원소 단위로 수신기에 넘기며, Deliver에는 배열을 제외한 봉투가 Struct 타입으로 전달된다.
+	 */
+	TFunction<FJWNU_StreamElementSinkRef(const TWeakObjectPtr<const UObject>& /*Owner*/, const FJWNU_RequestHandle& /*Handle*/)> MakeStreamSink;
+
+	/**
+	 * 스트리밍 배열 호출에서 원소를 꺼낼 루트 오브젝트의 키. (빈 문자열이면 루트 배열)
+	 */
+	FString StreamArrayFieldName;
+};
+
+/**
+ * 여러 람다가 복사 없이 공유하는 불변 썽크 참조.
+ */
+using FJWNU_ResponseThunkRef = TSharedRef<const FJWNU_ResponseThunk, ESPMode::ThreadSafe>;
+
+/**
+ * 배열 원소를 ElementType으로 변환해 청크 단위로 게임 스레드에 넘기는 원소 수신기.
+ * @tparam ElementType 배열 원소 언리얼 구조체 타입
+ */
+template<typename ElementType>
+class TJWNU_StreamArraySink final : public IJWNU_StreamElementSink
+{
+public:
+	TJWNU_StreamArraySink(const TWeakObjectPtr<const UObject>& InOwner, const FJWNU_RequestHandle& InHandle, const int32 InChunkSize, const TFunction<void(TArray<ElementType>&&)>& InOnGetChunk)
+		: Owner(InOwner), Handle(InHandle), ChunkSize(InChunkSize), OnGetChunk(InOnGetChunk)
+	{
+	}
+
+	virtual bool AddElement(const UTF8CHAR* InData, const int32 InNum) override
+	{
+		ElementType Element;
+		if (FJWNU_JsonStructReader::ReadUtf8(InData, InNum, ElementType::StaticStruct(), &Element) == false)
+		{
+			return false;
+		}
+
+		TArray<ElementType> Chunk;
+		{
+			FScopeLock Lock(&PendingLock);
+			PendingElements.Add(MoveTemp(Element));
+			if (PendingElements.Num() < ChunkSize)
+			{
+				return true;
+			}
+			Chunk = MoveTemp(PendingElements);
+		}
+		DeliverChunk(MoveTemp(Chunk));
+		return true;
+	}
+
+	virtual void Flush() override
+	{
+		TArray<ElementType> Remaining;
+		{
+			FScopeLock Lock(&PendingLock);
+			Remaining = MoveTemp(PendingElements);
+		}
+		if (Remaining.Num() > 0)
+		{
+			DeliverChunk(MoveTemp(Remaining));
+		}
+	}
+
+private:
+	/**
+	 * 원소 청크를 게임 스레드로 넘겨 콜백에 전달하는 함수. 서비스가 사라졌거나 요청이 취소됐다면 버린다. (스레드 안전)
+	 */
+	void DeliverChunk(TArray<ElementType>&& InChunk) const
+	{
+		AsyncTask(ENamedThreads::GameThread, [WeakOwner = Owner, InHandle = Handle, Chunk = MoveTemp(InChunk), InOnGetChunk = OnGetChunk]() mutable
+		{
+			if (WeakOwner.IsValid() == false)
+			{
+				return;
+			}
+			if (InHandle.IsRunning() == false)
+			{
+				PRINT_LOG(LogJWNU_GIS_ApiClientService, Verbose, TEXT("Request cancelled while streaming, dropping %d elements"), Chunk.Num());
+				return;
+			}
+			InOnGetChunk(MoveTemp(Chunk));
+		});
+	}
+
+	/**
+	 * 청크를 받을 서비스. (사라졌다면 청크를 버림)
+	 */
+	TWeakObjectPtr<const UObject> Owner;
+
+	/**
+	 * 요청 핸들. (게임 스레드에서만 조회)
+	 */
+	FJWNU_RequestHandle Handle;
+
+	/**
+	 * 한 번에 전달할 원소 수.
+	 */
+	int32 ChunkSize;
+
+	/**
+	 * 원소 청크 콜백.
+	 */
+	TFunction<void(TArray<ElementType>&&)> OnGetChunk;
+
+	/**
+	 * 아직 청크 크기를 채우지 못해 게임 스레드로 넘기지 않은 원소.
+	 */
+	TArray<ElementType> PendingElements;
+
+	/**
+	 * PendingElements 보호용 락.
+	 */
+	FCriticalSection PendingLock;
+};
+
 /**
  * JW 커스텀 리스폰스 스타일을 가진 API 클라이언트 서비스 클래스.
  */
@@ -32,6 +207,16 @@ class JWNETWORKUTILITY_API UJWNU_GIS_ApiClientService : public UGameInstanceSubs
 	GENERATED_BODY()
 	
 public:
+	/**
+	 * Overriding for starting session restore \n 의존 서브시스템을 먼저 초기화하고, 시작 시 세션 복구를 예약하는 로직 오버라이드.
+	 */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/**
+	 * Overriding for cancelling session restore \n 예약된 세션 복구를 정리하는 로직 오버라이드.
+	 */
+	virtual void Deinitialize() override;
+
 	/**
 	 * 외부에서 게임 인스턴스 API 서브시스템을 반환하는 함수. (Native CPP)
 	 * @param WorldContextObject 월드 컨텍스트 오브젝트
@@ -43,28 +228,34 @@ public:
 	 * 간편한 API 호출을 지원해주는 함수. 호스트와 인증 토큰은 Config의 설정값에 따라 자동으로 로드된다. 
 	 * 401 상태 코드, 즉 토큰 만료 시 자동으로 리프레시하고 재요청하는 내부 플로우를 지원한다.
 	 * 템플릿 인자로 전달한 구조체로 리스폰스 바디를 파싱하여 콜백으로 전달한다.
-	 * @tparam StructType JSON 리스폰스 바디에서 파싱하길 원하는 언리얼 구조체 타입
+	 * @tparam StructType JSON 리스폰스 바디에서 파싱하길 원하는 언리얼 구조체 타입 (FJWNU_RES_Base 파생, 에러는 Code, Message 필드에 채워진다)
 	 * @param WorldContextObject 월드 컨텍스트 오브젝트
 	 * @param InMethod HTTP 메서드
 	 * @param InServiceType 서비스 타입
 	 * @param InEndpoint API 엔드포인트
-	 * @param InContentBody JSON 바디
+	 * @param InContentBody JSON 바디 (텍스트는 기술자 생성 시 한 번만 UTF-8로 변환, UTF-8 바이트는 이동)
 	 * @param InQueryParams URL 쿼리 패러미터
 	 * @param OnGetCustomStruct 결과 콜백
 	 * @param OnHttpRequestJobRetry 재시도 콜백
 	 * @param bRequiresAuth 인증 토큰 필요 여부 (false 시 토큰 로직 전체 건너뜀)
+	 * @param InIdentityContext 요청을 보낼 인증 컨텍스트 (nullptr 시 IdentityProvider의 기본 컨텍스트)
+	 * @param OnApiError 실패 콜백 (지정 시 실패는 결과 콜백 대신 구조화된 에러로 전달)
+	 * @param InRequestConfig 호출 단위 HTTP 리퀘스트 설정 (지정 시 경로 정책과 엔드포인트 정책 대신 그대로 사용)
 	 */
 	template<typename StructType>
-	static UJWNU_HttpRequestJobHandle* CallApi_Template(
+	static FJWNU_RequestHandle CallApi_Template(
 		const UObject* WorldContextObject,
 		const EJWNU_HttpMethod InMethod,
 		const EJWNU_ServiceType InServiceType,
-		const FString InEndpoint,
-		const FString& InContentBody,
+		const FStringView InEndpoint,
+		FJWNU_RequestBody InContentBody,
 		const TMap<FString, FString>& InQueryParams,
 		TFunction<void(const StructType&)> OnGetCustomStruct,
 		const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry = FOnHttpRequestJobRetryDelegate(),
-		const bool bRequiresAuth = true);
+		const bool bRequiresAuth = true,
+		const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext = nullptr,
+		TFunction<void(const FJWNU_ApiError&)> OnApiError = nullptr,
+		const TOptional<FJWNU_RequestConfig>& InRequestConfig = NullOpt);
 	
 	/**
 	 * 간편한 API 호출을 지원해주는 함수. 호스트와 인증 토큰은 Config의 설정값에 따라 자동으로 로드된다. 
@@ -74,103 +265,474 @@ public:
 	 * @param InMethod HTTP 메서드
 	 * @param InServiceType 서비스 타입
 	 * @param InEndpoint API 엔드포인트
-	 * @param InContentBody JSON 바디
+	 * @param InContentBody JSON 바디 (텍스트는 기술자 생성 시 한 번만 UTF-8로 변환, UTF-8 바이트는 이동)
 	 * @param InQueryParams URL 쿼리 패러미터
 	 * @param OnHttpResponse 결과 콜백
 	 * @param OnHttpRequestJobRetry 재시도 콜백
 	 * @param bRequiresAuth 인증 토큰 필요 여부 (false 시 토큰 로직 전체 건너뜀)
+	 * @param InIdentityContext 요청을 보낼 인증 컨텍스트 (nullptr 시 IdentityProvider의 기본 컨텍스트)
+	 * @param OnApiError 실패 콜백 (바인딩 시 실패는 가짜 JSON 리스폰스 바디 대신 구조화된 에러로 전달)
+	 * @param InRequestConfig 호출 단위 HTTP 리퀘스트 설정 (지정 시 경로 정책과 엔드포인트 정책 대신 그대로 사용)
 	 */
-	static UJWNU_HttpRequestJobHandle* CallApi_NoTemplate(
+	static FJWNU_RequestHandle CallApi_NoTemplate(
 		const UObject* WorldContextObject,
 		const EJWNU_HttpMethod InMethod,
 		const EJWNU_ServiceType InServiceType,
-		const FString& InEndpoint,
-		const FString& InContentBody,
+		const FStringView InEndpoint,
+		FJWNU_RequestBody InContentBody,
 		const TMap<FString, FString>& InQueryParams,
 		const FOnHttpResponseDelegate& OnHttpResponse,
 		const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry = FOnHttpRequestJobRetryDelegate(),
-		const bool bRequiresAuth = true);
+		const bool bRequiresAuth = true,
+		const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext = nullptr,
+		const FOnApiErrorDelegate& OnApiError = FOnApiErrorDelegate(),
+		const TOptional<FJWNU_RequestConfig>& InRequestConfig = NullOpt);
 	
+	/**
+	 * 요청 구조체를 바디로 받는 CallApi_Template. 요청 구조체는 캐싱된 스키마로 UTF-8 바이트 버퍼에 한 번만 직렬화되고,
+	 * 그 버퍼가 FString 중간 단계나 전송 시점의 TCHAR→UTF-8 변환 없이 그대로 HTTP 바디가 된다.
+	 * @tparam StructType JSON 리스폰스 바디에서 파싱하길 원하는 언리얼 구조체 타입 (FJWNU_RES_Base 파생, 에러는 Code, Message 필드에 채워진다)
+	 * @tparam RequestStructType JSON 리퀘스트 바디로 직렬화할 언리얼 구조체 타입
+	 * @param WorldContextObject 월드 컨텍스트 오브젝트
+	 * @param InMethod HTTP 메서드
+	 * @param InServiceType 서비스 타입
+	 * @param InEndpoint API 엔드포인트
+	 * @param InRequestBody 요청 구조체
+	 * @param InQueryParams URL 쿼리 패러미터
+	 * @param OnGetCustomStruct 결과 콜백
+	 * @param OnHttpRequestJobRetry 재시도 콜백
+	 * @param bRequiresAuth 인증 토큰 필요 여부 (false 시 토큰 로직 전체 건너뜀)
+	 * @param InIdentityContext 요청을 보낼 인증 컨텍스트 (nullptr 시 IdentityProvider의 기본 컨텍스트)
+	 * @param OnApiError 실패 콜백 (지정 시 실패는 결과 콜백 대신 구조화된 에러로 전달)
+	 * @param InRequestConfig 호출 단위 HTTP 리퀘스트 설정 (지정 시 경로 정책과 엔드포인트 정책 대신 그대로 사용)
+	 */
+	template<typename StructType, typename RequestStructType> requires TModels_V<CStaticStructProvider, RequestStructType>
+	static FJWNU_RequestHandle CallApi_Template(
+		const UObject* WorldContextObject,
+		const EJWNU_HttpMethod InMethod,
+		const EJWNU_ServiceType InServiceType,
+		const FStringView InEndpoint,
+		const RequestStructType& InRequestBody,
+		const TMap<FString, FString>& InQueryParams,
+		TFunction<void(const StructType&)> OnGetCustomStruct,
+		const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry = FOnHttpRequestJobRetryDelegate(),
+		const bool bRequiresAuth = true,
+		const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext = nullptr,
+		TFunction<void(const FJWNU_ApiError&)> OnApiError = nullptr,
+		const TOptional<FJWNU_RequestConfig>& InRequestConfig = NullOpt);
+
+	/**
+	 * 요청 구조체를 바디로 받는 CallApi_NoTemplate. 요청 구조체는 UTF-8 바이트 버퍼에 곧바로 직렬화된다.
+	 * @tparam RequestStructType JSON 리퀘스트 바디로 직렬화할 언리얼 구조체 타입
+	 * @param WorldContextObject 월드 컨텍스트 오브젝트
+	 * @param InMethod HTTP 메서드
+	 * @param InServiceType 서비스 타입
+	 * @param InEndpoint API 엔드포인트
+	 * @param InRequestBody 요청 구조체
+	 * @param InQueryParams URL 쿼리 패러미터
+	 * @param OnHttpResponse 결과 콜백
+	 * @param OnHttpRequestJobRetry 재시도 콜백
+	 * @param bRequiresAuth 인증 토큰 필요 여부 (false 시 토큰 로직 전체 건너뜀)
+	 * @param InIdentityContext 요청을 보낼 인증 컨텍스트 (nullptr 시 IdentityProvider의 기본 컨텍스트)
+	 * @param OnApiError 실패 콜백 (바인딩 시 실패는 가짜 JSON 리스폰스 바디 대신 구조화된 에러로 전달)
+	 * @param InRequestConfig 호출 단위 HTTP 리퀘스트 설정 (지정 시 경로 정책과 엔드포인트 정책 대신 그대로 사용)
+	 */
+	template<typename RequestStructType> requires TModels_V<CStaticStructProvider, RequestStructType>
+	static FJWNU_RequestHandle CallApi_NoTemplate(
+		const UObject* WorldContextObject,
+		const EJWNU_HttpMethod InMethod,
+		const EJWNU_ServiceType InServiceType,
+		const FStringView InEndpoint,
+		const RequestStructType& InRequestBody,
+		const TMap<FString, FString>& InQueryParams,
+		const FOnHttpResponseDelegate& OnHttpResponse,
+		const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry = FOnHttpRequestJobRetryDelegate(),
+		const bool bRequiresAuth = true,
+		const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext = nullptr,
+		const FOnApiErrorDelegate& OnApiError = FOnApiErrorDelegate(),
+		const TOptional<FJWNU_RequestConfig>& InRequestConfig = NullOpt);
+
+	/**
+	 * 엔드포인트 선언으로 API를 호출하는 함수. 메서드, 서비스 타입, 인증 여부, 요청/응답 구조체, 동작 정책을 선언 한 곳에서 가져온다.
+	 * 요청 구조체 타입, 응답 콜백 타입, 경로 패러미터 수가 선언과 다르면 컴파일되지 않는다.
+	 * 경로는 미리 분해해 둔 조각에 패러미터만 끼워 넣어 만들고, 기술자에는 엔드포인트 식별자가 기록된다.
+	 * @tparam EndpointType 엔드포인트 선언 타입 (예: FJWNU_EP_AuthRefresh)
+	 * @param WorldContextObject 월드 컨텍스트 오브젝트
+	 * @param InRequestBody 요청 구조체
+	 * @param OnResponse 결과 콜백
+	 * @param InPathParams 경로 패러미터 (템플릿 순서대로, 예: { UserId, ItemId })
+	 * @param InQueryParams URL 쿼리 패러미터
+	 * @param OnHttpRequestJobRetry 재시도 콜백
+	 * @param InIdentityContext 요청을 보낼 인증 컨텍스트 (nullptr 시 IdentityProvider의 기본 컨텍스트)
+	 * @param OnApiError 실패 콜백 (지정 시 실패는 결과 콜백 대신 구조화된 에러로 전달)
+	 * @param InRequestConfig 호출 단위 HTTP 리퀘스트 설정 (지정 시 경로 정책과 엔드포인트 정책 대신 그대로 사용)
+	 */
+	template<CJWNU_Endpoint EndpointType> requires (TJWNU_EndpointTraits<EndpointType>::bHasRequestBody)
+	static FJWNU_RequestHandle CallEndpoint(
+		const UObject* WorldContextObject,
+		const typename TJWNU_EndpointTraits<EndpointType>::RequestType& InRequestBody,
+		TFunction<void(const typename TJWNU_EndpointTraits<EndpointType>::ResponseType&)> OnResponse,
+		const TJWNU_PathParams<TJWNU_EndpointTraits<EndpointType>::PathParamCount>& InPathParams = {},
+		const TMap<FString, FString>& InQueryParams = {},
+		const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry = FOnHttpRequestJobRetryDelegate(),
+		const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext = nullptr,
+		TFunction<void(const FJWNU_ApiError&)> OnApiError = nullptr,
+		const TOptional<FJWNU_RequestConfig>& InRequestConfig = NullOpt);
+
+	/**
+	 * 바디가 없는 엔드포인트(RequestType이 void)를 호출하는 CallEndpoint.
+	 * @tparam EndpointType 엔드포인트 선언 타입 (예: FJWNU_EP_Health)
+	 * @param WorldContextObject 월드 컨텍스트 오브젝트
+	 * @param OnResponse 결과 콜백
+	 * @param InPathParams 경로 패러미터 (템플릿 순서대로)
+	 * @param InQueryParams URL 쿼리 패러미터
+	 * @param OnHttpRequestJobRetry 재시도 콜백
+	 * @param InIdentityContext 요청을 보낼 인증 컨텍스트 (nullptr 시 IdentityProvider의 기본 컨텍스트)
+	 * @param OnApiError 실패 콜백 (지정 시 실패는 결과 콜백 대신 구조화된 에러로 전달)
+	 * @param InRequestConfig 호출 단위 HTTP 리퀘스트 설정 (지정 시 경로 정책과 엔드포인트 정책 대신 그대로 사용)
+	 */
+	template<CJWNU_Endpoint EndpointType> requires (TJWNU_EndpointTraits<EndpointType>::bHasRequestBody == false)
+	static FJWNU_RequestHandle CallEndpoint(
+		const UObject* WorldContextObject,
+		TFunction<void(const typename TJWNU_EndpointTraits<EndpointType>::ResponseType&)> OnResponse,
+		const TJWNU_PathParams<TJWNU_EndpointTraits<EndpointType>::PathParamCount>& InPathParams = {},
+		const TMap<FString, FString>& InQueryParams = {},
+		const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry = FOnHttpRequestJobRetryDelegate(),
+		const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext = nullptr,
+		TFunction<void(const FJWNU_ApiError&)> OnApiError = nullptr,
+		const TOptional<FJWNU_RequestConfig>& InRequestConfig = NullOpt);
+	
+	/**
+	 * 큰 JSON 배열 리스폰스를 스트리밍으로 받는 API 호출 함수. 호스트와 인증 토큰, 401 리프레시 플로우는 CallApi_Template과 동일하다.
+	 * 바디 전체를 기다리지 않고 도착하는 바이트에서 배열 원소를 하나씩 잘라 HTTP 스레드에서 구조체로 변환하고, 청크 단위로 게임 스레드에 전달한다.
+	 * 메모리에는 진행 중인 원소 하나와 전달 대기 중인 청크만 유지한다. 이미 전달한 원소는 되돌릴 수 없으므로 재시도하지 않는다.
+	 * @tparam ElementType 배열 원소를 파싱할 언리얼 구조체 타입
+	 * @param WorldContextObject 월드 컨텍스트 오브젝트
+	 * @param InMethod HTTP 메서드
+	 * @param InServiceType 서비스 타입
+	 * @param InEndpoint API 엔드포인트
+	 * @param InContentBody JSON 바디 (텍스트는 기술자 생성 시 한 번만 UTF-8로 변환, UTF-8 바이트는 이동)
+	 * @param InQueryParams URL 쿼리 패러미터
+	 * @param InArrayFieldName 원소를 스트리밍할 루트 오브젝트의 키 (빈 문자열이면 루트 배열)
+	 * @param InChunkSize 한 번에 전달할 원소 수 (1이면 원소마다 전달)
+	 * @param OnGetChunk 원소 청크 콜백 (게임 스레드, 도착 순서대로)
+	 * @param OnComplete 완료 콜백 (게임 스레드, 모든 청크 이후). 배열을 제외한 공통 응답 필드, 또는 실패 사유를 담는다.
+	 * @param bRequiresAuth 인증 토큰 필요 여부 (false 시 토큰 로직 전체 건너뜀)
+	 * @param InIdentityContext 요청을 보낼 인증 컨텍스트 (nullptr 시 IdentityProvider의 기본 컨텍스트)
+	 * @param OnApiError 실패 콜백 (지정 시 실패는 완료 콜백 대신 상태 코드와 전송 원인이 담긴 구조화된 에러로 전달, 남은 청크 이후)
+	 * @param InRequestConfig 호출 단위 HTTP 리퀘스트 설정 (지정 시 경로 정책과 엔드포인트 정책 대신 그대로 사용)
+	 */
+	template<typename ElementType>
+	static FJWNU_RequestHandle CallApi_StreamArray(
+		const UObject* WorldContextObject,
+		const EJWNU_HttpMethod InMethod,
+		const EJWNU_ServiceType InServiceType,
+		const FStringView InEndpoint,
+		FJWNU_RequestBody InContentBody,
+		const TMap<FString, FString>& InQueryParams,
+		const FString& InArrayFieldName,
+		const int32 InChunkSize,
+		TFunction<void(TArray<ElementType>&&)> OnGetChunk,
+		TFunction<void(const FJWNU_RES_Base&)> OnComplete,
+		const bool bRequiresAuth = true,
+		const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext = nullptr,
+		TFunction<void(const FJWNU_ApiError&)> OnApiError = nullptr,
+		const TOptional<FJWNU_RequestConfig>& InRequestConfig = NullOpt);
+	
+	// ──────── 세션 복구 ────────
+
+	/**
+	 * 시작 시 세션 복구가 끝났는지 여부를 반환한다. 복구할 세션이 없거나 복구가 비활성화되어 있다면 곧바로 true가 된다.
+	 * @return 세션 준비 여부
+	 */
+	UFUNCTION(BlueprintPure, Category="JWNetworkUtility|Authorization")
+	bool IsSessionReady() const;
+
+	/**
+	 * 시작 시 세션 복구가 끝났을 때 호출되는 델리게이트를 반환한다. (Native CPP)
+	 * @return 세션 준비 완료 델리게이트
+	 */
+	FOnSessionReadyDelegate& GetOnSessionReady();
+
+	/**
+	 * 시작 시 세션 복구가 끝났을 때 호출되는 BP 이벤트. 로딩 화면 종료 시점 판단에 활용한다.
+	 */
+	UPROPERTY(BlueprintAssignable, Category="JWNetworkUtility|Authorization")
+	FOnSessionReadyBPEvent OnSessionReadyBPEvent;
+
 private:
+
+	/**
+	 * 저장된 리프레시 토큰이 있는 모든 서비스의 엑세스 토큰 리프레시를 동시에 시작하는 함수.
+	 * 월드가 아직 없다면 다음 틱으로 미룬다.
+	 */
+	void RestoreSession();
+
+	/**
+	 * 서비스 하나의 리프레시가 끝났을 때 세션 복구 대기 목록에서 제거하고, 모두 끝났다면 세션 준비 이벤트를 호출하는 함수.
+	 * @param InServiceType 리프레시가 끝난 서비스 타입
+	 */
+	void CompleteSessionRestoreStep(EJWNU_ServiceType InServiceType);
+
+	/**
+	 * 세션 준비 상태로 전환하고 네이티브 델리게이트와 BP 이벤트를 호출하는 함수.
+	 */
+	void MarkSessionReady();
 	
 	/**
 	 * 동일한 이름의 정적 함수에 의해 호출되어, 실제로 처리하는 비정적 함수.
-	 * @param InMethod REST API HTTP 메서드
-	 * @param InServiceType 서비스 타입 (호스트 및 인증 토큰 자동 획득용)
-	 * @param InURL REST API를 호출하는 URL
+	 * @param InRequest 요청 기술자 (메서드, 서비스 타입, URL, 바디, 동작 설정)
+	 * @param InIdentityContext 인증 컨텍스트 (401 발생 시 리프레시 대상, 인증이 필요 없다면 nullptr)
 	 * @param InAccessToken 엑세스 인증 토큰
-	 * @param InContentBody JSON 바디
-	 * @param InQueryParams URL 쿼리 패러미터
 	 * @param OnHttpResponse 리스폰스 바디를 전달받는 콜백
-	 * @param InHandle 
+	 * @param OnApiError 구조화된 에러를 전달받는 콜백 (바인딩되지 않았다면 가짜 JSON 리스폰스 바디를 OnHttpResponse로 전달)
+	 * @param InHandle 요청 핸들
 	 * @param OnHttpRequestJobRetry 재시도 콜백
 	 * @param bTryTokenRefreshing 토큰 리프레시 시도 여부
 	 */
 	void CallApi_NoTemplate_Execution(
-		const EJWNU_HttpMethod InMethod,
-		const EJWNU_ServiceType InServiceType,
-		const FString& InURL,
+		const FJWNU_RequestDescriptorRef& InRequest,
+		const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext,
 		const FString& InAccessToken,
-		const FString& InContentBody,
-		const TMap<FString, FString>& InQueryParams,
 		const FOnHttpResponseDelegate& OnHttpResponse,
-		UJWNU_HttpRequestJobHandle* InHandle,
+		const FOnApiErrorDelegate& OnApiError,
+		const FJWNU_RequestHandle& InHandle,
 		const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry = FOnHttpRequestJobRetryDelegate(),
 		const bool bTryTokenRefreshing = true);
 
 	/**
-	 * 동일한 이름의 정적 템플릿 함수에 의해 호출되어, 실제로 처리하는 비정적 템플릿 함수.
-	 * @tparam StructType JSON 리스폰스 바디에서 파싱하길 원하는 언리얼 구조체 타입
-	 * @param InMethod REST API HTTP 메서드
-	 * @param InServiceType 서비스 타입 (호스트 및 인증 토큰 자동 획득용)
-	 * @param InURL REST API를 호출하는 URL
-	 * @param InAccessToken 엑세스 인증 토큰
-	 * @param InContentBody JSON 바디
+	 * CallApi_Template의 비템플릿 코어. 호스트 조회, 토큰 확인, 리프레시 대기열 적재를 구조체 타입과 무관하게 처리한다.
+	 * @param WorldContextObject 월드 컨텍스트 오브젝트
+	 * @param InMethod HTTP 메서드
+	 * @param InServiceType 서비스 타입
+	 * @param InEndpoint API 엔드포인트
+	 * @param InContentBody JSON 바디 (텍스트는 기술자 생성 시 한 번만 UTF-8로 변환, UTF-8 바이트는 이동)
 	 * @param InQueryParams URL 쿼리 패러미터
-	 * @param OnGetCustomStruct 리스폰스 바디를 파싱한 언리얼 구조체를 전달받는 콜백
+	 * @param InThunk 결과 구조체 타입과 타입 콜백을 담은 썽크
 	 * @param OnHttpRequestJobRetry 재시도 콜백
-	 * @param bTryTokenRefreshing 토큰 리프레시 시도 여부
+	 * @param bRequiresAuth 인증 토큰 필요 여부
+	 * @param InIdentityContext 요청을 보낼 인증 컨텍스트 (nullptr 시 IdentityProvider의 기본 컨텍스트)
+	 * @param InEndpointInfo 엔드포인트 정보 (CallEndpoint에서만 지정, 동작 정책과 식별자를 기술자에 반영)
+	 * @param InConfigOverride 호출 단위 HTTP 리퀘스트 설정 (nullptr이면 정책에 따라 결정)
 	 */
-	template<typename StructType>
-	void CallApi_Template_Execution(
+	static FJWNU_RequestHandle CallApi_Typed(
+		const UObject* WorldContextObject,
 		const EJWNU_HttpMethod InMethod,
 		const EJWNU_ServiceType InServiceType,
-		const FString& InURL,
-		const FString& InAccessToken,
-		const FString& InContentBody,
+		const FStringView InEndpoint,
+		FJWNU_RequestBody InContentBody,
 		const TMap<FString, FString>& InQueryParams,
-		TFunction<void(const StructType&)> OnGetCustomStruct,
-		UJWNU_HttpRequestJobHandle* InHandle,
+		const FJWNU_ResponseThunkRef& InThunk,
+		const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry,
+		const bool bRequiresAuth,
+		const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext,
+		const FJWNU_EndpointInfo* InEndpointInfo = nullptr,
+		const FJWNU_RequestConfig* InConfigOverride = nullptr);
+
+	/**
+	 * CallEndpoint의 비템플릿 코어. 엔드포인트 정보로 경로를 조합한 뒤 CallApi_Typed로 넘긴다.
+	 * @param WorldContextObject 월드 컨텍스트 오브젝트
+	 * @param InEndpointInfo 엔드포인트 정보
+	 * @param InPathParams 경로 패러미터
+	 * @param InContentBody JSON 바디
+	 * @param InQueryParams URL 쿼리 패러미터
+	 * @param InThunk 결과 구조체 타입과 타입 콜백을 담은 썽크
+	 * @param OnHttpRequestJobRetry 재시도 콜백
+	 * @param InIdentityContext 요청을 보낼 인증 컨텍스트 (nullptr 시 IdentityProvider의 기본 컨텍스트)
+	 * @param InConfigOverride 호출 단위 HTTP 리퀘스트 설정 (nullptr이면 정책에 따라 결정)
+	 */
+	static FJWNU_RequestHandle CallEndpoint_Typed(
+		const UObject* WorldContextObject,
+		const FJWNU_EndpointInfo& InEndpointInfo,
+		TConstArrayView<FStringView> InPathParams,
+		FJWNU_RequestBody InContentBody,
+		const TMap<FString, FString>& InQueryParams,
+		const FJWNU_ResponseThunkRef& InThunk,
+		const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry,
+		const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext,
+		const FJWNU_RequestConfig* InConfigOverride);
+
+	/**
+	 * 타입 콜백과 에러 콜백을 썽크로 감싸는 함수.
+	 * @tparam StructType 리스폰스 바디를 파싱할 언리얼 구조체 타입
+	 * @param OnGetCustomStruct 결과 콜백
+	 * @param OnApiError 실패 콜백
+	 * @return 썽크 참조
+	 */
+	template<typename StructType>
+	static FJWNU_ResponseThunkRef MakeResponseThunk(TFunction<void(const StructType&)>&& OnGetCustomStruct, TFunction<void(const FJWNU_ApiError&)>&& OnApiError);
+
+	/**
+	 * CallApi_Typed에 의해 호출되어, 실제로 요청을 보내고 401을 처리하는 비템플릿 함수.
+	 * @param InRequest 요청 기술자 (메서드, 서비스 타입, URL, 바디, 동작 설정)
+	 * @param InIdentityContext 인증 컨텍스트 (401 발생 시 리프레시 대상, 인증이 필요 없다면 nullptr)
+	 * @param InAccessToken 엑세스 인증 토큰
+	 * @param InThunk 결과 구조체 타입과 타입 콜백을 담은 썽크
+	 * @param InHandle 요청 핸들
+	 * @param OnHttpRequestJobRetry 재시도 콜백
+	 * @param bTryTokenRefreshing 토큰 리프레시 시도 여부
+	 */
+	void CallApi_Typed_Execution(
+		const FJWNU_RequestDescriptorRef& InRequest,
+		const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext,
+		const FString& InAccessToken,
+		const FJWNU_ResponseThunkRef& InThunk,
+		const FJWNU_RequestHandle& InHandle,
 		const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry = FOnHttpRequestJobRetryDelegate(),
 		const bool bTryTokenRefreshing = true);
 
 	/**
-	 * 잡을 ServiceType별 대기열에 적재하고, 리프레시가 아직 진행 중이 아니라면 ExecuteTokenRefresh를 시작한다.
+	 * 리스폰스 바디를 썽크의 구조체 타입으로 파싱해 콜백에 전달하는 함수.
+	 * bParseResponsesOffGameThread가 켜져 있고 바디가 임계값 이상이면 워커 스레드에서 파싱하고, 완성된 구조체만 게임 스레드로 전달한다.
+	 * @param ResponseBytes 리스폰스 바디 (UTF-8 바이트, 워커 파싱 시 태스크로 이동된다)
+	 * @param InThunk 결과 구조체 타입과 타입 콜백을 담은 썽크
+	 * @param InHandle 요청 핸들 (워커 파싱 중 취소되면 콜백을 생략)
+	 */
+	void ParseAndDeliverTypedResponse(TArray<uint8>&& ResponseBytes, const FJWNU_ResponseThunkRef& InThunk, const FJWNU_RequestHandle& InHandle);
+
+	/**
+	 * 요청 핸들 테이블에서 슬롯을 할당하는 함수. 슬롯은 결과 콜백 직전이나 취소 시 반납된다.
+	 * @return 요청 핸들 (서비스 종료 중이라면 빈 핸들이며, 호출자는 요청을 보내지 않고 SERVICE_SHUTTING_DOWN 에러를 전달한다)
+	 */
+	FJWNU_RequestHandle AllocateRequestHandle() const;
+
+	/**
+	 * 에러를 썽크로 전달하는 함수. 에러 콜백이 없다면 구조체의 Code, Message만 채워 결과 콜백으로 전달한다. (JSON을 거치지 않음)
+	 * @param InThunk 결과 구조체 타입과 타입 콜백을 담은 썽크
+	 * @param InError 에러
+	 */
+	static void DeliverTypedError(const FJWNU_ResponseThunk& InThunk, const FJWNU_ApiError& InError);
+
+	/**
+	 * 비템플릿 호출의 에러를 전달하는 함수. 에러 콜백이 바인딩되어 있을 때만 JSON 직렬화를 건너뛴다.
+	 * @param OnHttpResponse 리스폰스 바디를 전달받는 콜백
+	 * @param OnApiError 구조화된 에러를 전달받는 콜백
+	 * @param InError 에러
+	 */
+	static void DeliverNoTemplateError(const FOnHttpResponseDelegate& OnHttpResponse, const FOnApiErrorDelegate& OnApiError, const FJWNU_ApiError& InError);
+
+	/**
+	 * UTF-8 리스폰스 바이트를 FString으로 변환하지 않고 구조체 메모리로 파싱하는 함수. 실패 시 JSON_PARSE_ERROR 코드를 채운다. (스레드 안전)
+	 * @param ResponseBytes 리스폰스 바디 (UTF-8 바이트)
+	 * @param InStruct 구조체 타입
+	 * @param OutStructData 구조체 메모리
+	 */
+	static void ParseTypedResponseBody(const TArray<uint8>& ResponseBytes, const UScriptStruct* InStruct, void* OutStructData);
+
+	/**
+	 * 구조체의 Code, Message 문자열 프로퍼티를 채우는 함수. 해당 프로퍼티가 없다면 에러가 버려지므로 경고를 남긴다.
+	 * @param InStruct 구조체 타입
+	 * @param OutStructData 구조체 메모리
+	 * @param InCode 에러 코드
+	 * @param InMessage 에러 메시지
+	 */
+	static void SetErrorFields(const UScriptStruct* InStruct, void* OutStructData, const FString& InCode, const FString& InMessage);
+
+	/**
+	 * 배열 원소 수신기를 만드는 스트림 썽크를 구성하는 함수. 완료 결과는 FJWNU_RES_Base 타입으로 OnComplete에, 에러는 OnApiError(없으면 OnComplete)에 전달된다.
+	 * @tparam ElementType 배열 원소를 파싱할 언리얼 구조체 타입
+	 * @param InArrayFieldName 원소를 스트리밍할 루트 오브젝트의 키 (빈 문자열이면 루트 배열)
+	 * @param InChunkSize 한 번에 전달할 원소 수
+	 * @param OnGetChunk 원소 청크 콜백
+	 * @param OnComplete 완료 콜백
+	 * @param OnApiError 실패 콜백
+	 * @return 썽크 참조
+	 */
+	template<typename ElementType>
+	static FJWNU_ResponseThunkRef MakeStreamArrayThunk(const FString& InArrayFieldName, const int32 InChunkSize, TFunction<void(TArray<ElementType>&&)>&& OnGetChunk, TFunction<void(const FJWNU_RES_Base&)>&& OnComplete, TFunction<void(const FJWNU_ApiError&)>&& OnApiError);
+
+	/**
+	 * CallApi_Typed_Execution에 의해 호출되어, 스트림 썽크의 요청을 바디를 모으지 않고 보내는 비템플릿 함수.
+	 * 원소는 HTTP 스레드에서 수신기로 넘기고, 완료 시 배열을 제외한 봉투를 썽크로 전달한다. 401 처리는 CallApi_Typed_Execution과 같다.
+	 * @param InRequest 요청 기술자 (메서드, 서비스 타입, URL, 바디, 동작 설정)
+	 * @param InIdentityContext 인증 컨텍스트 (401 발생 시 리프레시 대상, 인증이 필요 없다면 nullptr)
+	 * @param InAccessToken 엑세스 인증 토큰
+	 * @param InThunk 봉투 구조체 타입과 원소 수신기 팩토리를 담은 썽크
+	 * @param InHandle 요청 핸들 (취소되면 남은 콜백을 생략)
+	 * @param OnHttpRequestJobRetry 재시도 콜백 (스트림 요청은 재시도하지 않으므로 401 재전송에만 전달)
+	 * @param bTryTokenRefreshing 토큰 리프레시 시도 여부
+	 */
+	void CallApi_Stream_Execution(
+		const FJWNU_RequestDescriptorRef& InRequest,
+		const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext,
+		const FString& InAccessToken,
+		const FJWNU_ResponseThunkRef& InThunk,
+		const FJWNU_RequestHandle& InHandle,
+		const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry,
+		const bool bTryTokenRefreshing);
+
+	/**
+	 * 타입 호출과 스트림 호출이 공유하는 실패 콜백을 만드는 함수. 401이라면 잡을 리프레시 대기열에 적재하고, 그 외에는 에러를 썽크로 전달한다.
+	 * @param InRequest 요청 기술자
+	 * @param InIdentityContext 인증 컨텍스트 (401 발생 시 리프레시 대상)
+	 * @param InThunk 결과 구조체 타입과 타입 콜백을 담은 썽크
+	 * @param InHandle 요청 핸들
+	 * @param OnHttpRequestJobRetry 재시도 콜백
+	 * @param bTryTokenRefreshing 토큰 리프레시 시도 여부
+	 * @param InStreamSink 스트림 호출의 원소 수신기 (지정 시 남은 원소를 먼저 넘긴 뒤 에러를 전달)
+	 * @return 실패 콜백
+	 */
+	FOnHttpRequestFailedDelegate MakeTypedFailureCallback(
+		const FJWNU_RequestDescriptorRef& InRequest,
+		const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext,
+		const FJWNU_ResponseThunkRef& InThunk,
+		const FJWNU_RequestHandle& InHandle,
+		const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry,
+		const bool bTryTokenRefreshing,
+		const TSharedPtr<IJWNU_StreamElementSink, ESPMode::ThreadSafe>& InStreamSink = nullptr);
+
+	/**
+	 * 남은 원소와 완료 결과를 앞서 보낸 청크 뒤에 이어서 게임 스레드 큐에 넣어 순서를 보장하는 함수.
+	 * @param InSink 원소 수신기
+	 * @param InHandle 요청 핸들 (취소됐다면 결과를 생략)
+	 * @param InDeliverResult 슬롯 반납 후 결과를 전달하는 함수
+	 */
+	void FinishStream(const FJWNU_StreamElementSinkRef& InSink, const FJWNU_RequestHandle& InHandle, TUniqueFunction<void()>&& InDeliverResult);
+
+	/**
+	 * 스트림이 끝난 뒤 배열을 제외한 봉투 JSON을 공통 응답 구조체로 파싱하는 함수. 루트 배열이라면 성공 응답을 채운다.
+	 * @param InReader 스트림 토크나이저
+	 * @param OutResult 파싱 결과
+	 */
+	static void ParseStreamEnvelope(FJWNU_JsonArrayStreamReader& InReader, FJWNU_RES_Base& OutResult);
+
+	/**
+	 * 잡을 인증 컨텍스트의 ServiceType별 대기열에 적재하고, 리프레시가 아직 진행 중이 아니라면 ExecuteTokenRefresh를 시작한다.
+	 * @param InIdentityContext 대상 인증 컨텍스트
 	 * @param InServiceType 대상 서비스 타입
 	 * @param InJob 대기열에 적재할 잡
 	 */
-	void RequestTokenRefresh(EJWNU_ServiceType InServiceType, FJWNU_PendingJob&& InJob);
+	void RequestTokenRefresh(const TSharedRef<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext, EJWNU_ServiceType InServiceType, FJWNU_PendingJob&& InJob);
+
+	/**
+	 * 리프레시를 기다리는 잡 중 요청이 취소된 잡을 제거하는 함수. (콜백과 캡처한 객체를 리프레시 완료까지 붙잡지 않도록)
+	 * @param InOutJobs 대기 중인 잡 배열
+	 */
+	static void RemoveCancelledPendingJobs(TArray<FJWNU_PendingJob>& InOutJobs);
 
 	/**
 	 * 리프레시 토큰 API를 실제로 1회 호출하는 함수. 완료 시 Drain 함수가 대기열의 잡을 일괄 처리한다.
+	 * 영속 컨텍스트의 키스토어가 아직 로드 중이라면 로드 반영 후로 호출을 미룬다.
+	 * @param InIdentityContext 대상 인증 컨텍스트
 	 * @param InServiceType 대상 서비스 타입
 	 */
-	void ExecuteTokenRefresh(EJWNU_ServiceType InServiceType);
+	void ExecuteTokenRefresh(const TSharedRef<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext, EJWNU_ServiceType InServiceType);
 
 	/**
 	 * 토큰 리프레시 성공 시, 대기열의 모든 잡에 새 토큰을 전달하고 큐를 비우는 함수.
+	 * @param InIdentityContext 대상 인증 컨텍스트
 	 * @param InServiceType 대상 서비스 타입
 	 * @param NewAccessToken 새로 발급된 엑세스 토큰
 	 */
-	void DrainPendingJobs_Success(EJWNU_ServiceType InServiceType, const FString& NewAccessToken);
+	void DrainPendingJobs_Success(const TSharedRef<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext, EJWNU_ServiceType InServiceType, const FString& NewAccessToken);
 
 	/**
 	 * 토큰 리프레시 실패 시, 대기열의 모든 잡에 에러를 전달하고 큐를 비우는 함수.
+	 * @param InIdentityContext 대상 인증 컨텍스트
 	 * @param InServiceType 대상 서비스 타입
-	 * @param ErrorCode 에러 코드
-	 * @param ErrorMessage 에러 메시지
+	 * @param InError 대기 중인 잡에 전달할 에러
 	 */
-	void DrainPendingJobs_Failure(EJWNU_ServiceType InServiceType, const FString& ErrorCode, const FString& ErrorMessage);
+	void DrainPendingJobs_Failure(const TSharedRef<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext, EJWNU_ServiceType InServiceType, const FJWNU_ApiError& InError);
 
 	/**
 	 * 리프레시 토큰 API URL을 구축하는 함수.
@@ -179,216 +741,218 @@ private:
 	FString BuildRefreshTokenURL() const;
 
 	/**
-	 * ServiceType별 토큰 리프레시 진행 중 여부를 나타내는 플래그 맵.
+	 * 시작 시 저장된 리프레시 토큰으로 세션을 복구할지 여부.
+	 */
+	UPROPERTY(Config)
+	bool bRestoreSessionOnStartup = true;
+
+	/**
+	 * 큰 리스폰스를 워커 스레드에서 파싱할지 여부.
+	 */
+	UPROPERTY(Config)
+	bool bParseResponsesOffGameThread = true;
+
+	/**
+	 * 워커 스레드 파싱을 적용할 최소 리스폰스 바디 길이. (UTF-8 바이트 수) 이보다 작은 리스폰스는 스레드 전환 비용이 더 크므로 게임 스레드에서 바로 파싱한다.
+	 */
+	UPROPERTY(Config)
+	int32 OffGameThreadParseMinLength = 32768;
+
+	/**
+	 * 프로세서가 소유한 진행 중 요청의 슬롯 테이블.
+	 */
+	TSharedPtr<FJWNU_RequestHandleTable, ESPMode::ThreadSafe> RequestTable;
+
+	/**
+	 * 세션 복구 중 아직 리프레시가 끝나지 않은 서비스 타입 집합.
+	 */
+	TSet<EJWNU_ServiceType> SessionRestorePendingServices;
+
+	/**
+	 * 세션 준비 여부.
 	 */
-	TMap<EJWNU_ServiceType, bool> RefreshInProgressFlags;
+	bool bSessionReady = false;
 
 	/**
-	 * ServiceType별 토큰 리프레시 대기열 맵. 리프레시 완료 시 일괄 처리된다.
+	 * 세션 준비 완료 델리게이트.
 	 */
-	TMap<EJWNU_ServiceType, TArray<FJWNU_PendingJob>> PendingJobQueues;
+	FOnSessionReadyDelegate OnSessionReady;
+
+	/**
+	 * 월드 생성 전에 세션 복구가 요청된 경우 다음 틱에 재시도하기 위한 티커 핸들.
+	 */
+	FTSTicker::FDelegateHandle SessionRestoreTickerHandle;
 };
 
 template <typename StructType>
-UJWNU_HttpRequestJobHandle* UJWNU_GIS_ApiClientService::CallApi_Template(
+FJWNU_RequestHandle UJWNU_GIS_ApiClientService::CallApi_Template(
 	const UObject* WorldContextObject,
 	const EJWNU_HttpMethod InMethod,
 	const EJWNU_ServiceType InServiceType,
-	const FString InEndpoint,
-	const FString& InContentBody,
+	const FStringView InEndpoint,
+	FJWNU_RequestBody InContentBody,
 	const TMap<FString, FString>& InQueryParams,
 	TFunction<void(const StructType&)> OnGetCustomStruct,
 	const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry,
-	const bool bRequiresAuth)
+	const bool bRequiresAuth,
+	const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext,
+	TFunction<void(const FJWNU_ApiError&)> OnApiError,
+	const TOptional<FJWNU_RequestConfig>& InRequestConfig)
 {
-	// 객체 획득
-	UJWNU_GIS_ApiClientService* Self = Get(WorldContextObject);
-	if (Self == nullptr)
-	{
-		return nullptr;
-	}
+	static_assert(std::is_base_of_v<FJWNU_RES_Base, StructType>, "CallApi_Template StructType must derive from FJWNU_RES_Base");
 
-	// Handle 생성
-	UJWNU_HttpRequestJobHandle* Handle = NewObject<UJWNU_HttpRequestJobHandle>(Self);
+	// 타입에 의존하는 부분은 구조체 타입과 콜백을 잇는 썽크뿐이고, 나머지 플로우는 비템플릿 코어가 처리한다
+	const FJWNU_ResponseThunkRef Thunk = MakeResponseThunk<StructType>(MoveTemp(OnGetCustomStruct), MoveTemp(OnApiError));
+	return CallApi_Typed(WorldContextObject, InMethod, InServiceType, InEndpoint, MoveTemp(InContentBody), InQueryParams, Thunk, OnHttpRequestJobRetry, bRequiresAuth, InIdentityContext, nullptr, InRequestConfig.GetPtrOrNull());
+}
 
-	// 호스트 프로바이더에서 호스트 획득
-	FString ProvidedHost;
-	if (const auto HostProvider = UJWNU_GIS_ApiHostProvider::Get(WorldContextObject))
-	{
-		if (HostProvider->GetHost(InServiceType, ProvidedHost) == false)
-		{
-			PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Failed to get host!"));
-			StructType ErrorResult;
-			ErrorResult.Code = TEXT("HOST_NOT_FOUND");
-			ErrorResult.Message = TEXT("Failed to get host from provider");
-			OnGetCustomStruct(ErrorResult);
-			return nullptr;
-		}
-	}
+template <typename StructType, typename RequestStructType> requires TModels_V<CStaticStructProvider, RequestStructType>
+FJWNU_RequestHandle UJWNU_GIS_ApiClientService::CallApi_Template(
+	const UObject* WorldContextObject,
+	const EJWNU_HttpMethod InMethod,
+	const EJWNU_ServiceType InServiceType,
+	const FStringView InEndpoint,
+	const RequestStructType& InRequestBody,
+	const TMap<FString, FString>& InQueryParams,
+	TFunction<void(const StructType&)> OnGetCustomStruct,
+	const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry,
+	const bool bRequiresAuth,
+	const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext,
+	TFunction<void(const FJWNU_ApiError&)> OnApiError,
+	const TOptional<FJWNU_RequestConfig>& InRequestConfig)
+{
+	static_assert(std::is_base_of_v<FJWNU_RES_Base, StructType>, "CallApi_Template StructType must derive from FJWNU_RES_Base");
 
-	// API URL 구축
-	FString ConstructedURL = ProvidedHost + InEndpoint;
+	const FJWNU_ResponseThunkRef Thunk = MakeResponseThunk<StructType>(MoveTemp(OnGetCustomStruct), MoveTemp(OnApiError));
 
-	// 인증이 필요하지 않은 경우, 토큰 로직을 건너뛰고 바로 실행
-	if (bRequiresAuth == false)
+	// 요청 구조체를 UTF-8 바이트로 한 번만 직렬화하고, 그 버퍼를 기술자로 이동
+	TArray<uint8> BodyBytes;
+	if (FJWNU_JsonStructWriter::WriteUtf8(InRequestBody, BodyBytes) == false)
 	{
-		Self->CallApi_Template_Execution(InMethod, InServiceType, ConstructedURL, TEXT(""), InContentBody, InQueryParams, OnGetCustomStruct, Handle, OnHttpRequestJobRetry, false);
-		return Handle;
+		PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Failed to serialize request body! (%s)"), *RequestStructType::StaticStruct()->GetName());
+		DeliverTypedError(*Thunk, FJWNU_ApiError(TEXT("REQUEST_SERIALIZE_ERROR"), TEXT("Failed to serialize request body")));
+		return FJWNU_RequestHandle();
 	}
+	return CallApi_Typed(WorldContextObject, InMethod, InServiceType, InEndpoint, FJWNU_RequestBody(MoveTemp(BodyBytes)), InQueryParams, Thunk, OnHttpRequestJobRetry, bRequiresAuth, InIdentityContext, nullptr, InRequestConfig.GetPtrOrNull());
+}
 
-	// 토큰 프로바이더에서 엑세스 토큰 획득
-	FJWNU_AccessTokenContainer ProvidedAccessTokenContainer;
-	if (const auto TokenProvider = UJWNU_GIS_ApiIdentityProvider::Get(WorldContextObject))
-	{
-		if (TokenProvider->GetAccessTokenContainer(InServiceType, ProvidedAccessTokenContainer) == false)
-		{
-			PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Failed to get access token!"));
-			StructType ErrorResult;
-			ErrorResult.Code = TEXT("TOKEN_NOT_FOUND");
-			ErrorResult.Message = TEXT("Failed to get access token from provider");
-			OnGetCustomStruct(ErrorResult);
-			return nullptr;
-		}
-	}
-	else
+template <typename RequestStructType> requires TModels_V<CStaticStructProvider, RequestStructType>
+FJWNU_RequestHandle UJWNU_GIS_ApiClientService::CallApi_NoTemplate(
+	const UObject* WorldContextObject,
+	const EJWNU_HttpMethod InMethod,
+	const EJWNU_ServiceType InServiceType,
+	const FStringView InEndpoint,
+	const RequestStructType& InRequestBody,
+	const TMap<FString, FString>& InQueryParams,
+	const FOnHttpResponseDelegate& OnHttpResponse,
+	const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry,
+	const bool bRequiresAuth,
+	const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext,
+	const FOnApiErrorDelegate& OnApiError,
+	const TOptional<FJWNU_RequestConfig>& InRequestConfig)
+{
+	// 요청 구조체를 UTF-8 바이트로 한 번만 직렬화하고, 그 버퍼를 기술자로 이동
+	TArray<uint8> BodyBytes;
+	if (FJWNU_JsonStructWriter::WriteUtf8(InRequestBody, BodyBytes) == false)
 	{
-		PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Failed to get token provider!"));
-		StructType ErrorResult;
-		ErrorResult.Code = TEXT("PROVIDER_NOT_FOUND");
-		ErrorResult.Message = TEXT("Failed to get token provider");
-		OnGetCustomStruct(ErrorResult);
-		return nullptr;
+		PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Failed to serialize request body! (%s)"), *RequestStructType::StaticStruct()->GetName());
+		DeliverNoTemplateError(OnHttpResponse, OnApiError, FJWNU_ApiError(TEXT("REQUEST_SERIALIZE_ERROR"), TEXT("Failed to serialize request body")));
+		return FJWNU_RequestHandle();
 	}
+	return CallApi_NoTemplate(WorldContextObject, InMethod, InServiceType, InEndpoint, FJWNU_RequestBody(MoveTemp(BodyBytes)), InQueryParams, OnHttpResponse, OnHttpRequestJobRetry, bRequiresAuth, InIdentityContext, OnApiError, InRequestConfig);
+}
+
+template <CJWNU_Endpoint EndpointType> requires (TJWNU_EndpointTraits<EndpointType>::bHasRequestBody)
+FJWNU_RequestHandle UJWNU_GIS_ApiClientService::CallEndpoint(
+	const UObject* WorldContextObject,
+	const typename TJWNU_EndpointTraits<EndpointType>::RequestType& InRequestBody,
+	TFunction<void(const typename TJWNU_EndpointTraits<EndpointType>::ResponseType&)> OnResponse,
+	const TJWNU_PathParams<TJWNU_EndpointTraits<EndpointType>::PathParamCount>& InPathParams,
+	const TMap<FString, FString>& InQueryParams,
+	const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry,
+	const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext,
+	TFunction<void(const FJWNU_ApiError&)> OnApiError,
+	const TOptional<FJWNU_RequestConfig>& InRequestConfig)
+{
+	using FTraits = TJWNU_EndpointTraits<EndpointType>;
+	const FJWNU_ResponseThunkRef Thunk = MakeResponseThunk<typename FTraits::ResponseType>(MoveTemp(OnResponse), MoveTemp(OnApiError));
 
-	// 토큰 만료 또는 리프레시 진행 중인 경우 잡 큐에 적재
-	const int64 CurrentUnixTime = FDateTime::UtcNow().ToUnixTimestamp();
-	const bool bTokenExpired = ProvidedAccessTokenContainer.ExpiresAt > 0 && CurrentUnixTime >= (ProvidedAccessTokenContainer.ExpiresAt - 30);
-	if (bTokenExpired || Self->RefreshInProgressFlags.FindOrAdd(InServiceType))
+	// 요청 구조체를 UTF-8 바이트로 한 번만 직렬화하고, 그 버퍼를 기술자로 이동
+	TArray<uint8> BodyBytes;
+	if (FJWNU_JsonStructWriter::WriteUtf8(InRequestBody, BodyBytes) == false)
 	{
-		PRINT_LOG(LogJWNU_GIS_ApiClientService, Display, TEXT("Access token expired or refresh in progress, queuing job..."));
-		JWNU_SCREEN_DEBUG(-1, 5.0f, FColor::Yellow, TEXT("[JWNU] Access Token Expired — Queuing refresh for %s"), *UEnum::GetValueAsString(InServiceType));
-		Handle->MarkWaitingForRefresh();
-		FJWNU_PendingJob Job;
-		Job.RequestInfo.ServiceType = InServiceType;
-		Job.RequestInfo.Method = InMethod;
-		Job.RequestInfo.URL = ConstructedURL;
-		Job.RequestInfo.ContentBody = InContentBody;
-		Job.RequestInfo.QueryParams = InQueryParams;
-		Job.OnTokenReady = [Self, InMethod, InServiceType, ConstructedURL, InContentBody, InQueryParams, OnGetCustomStruct, OnHttpRequestJobRetry, Handle](const FString& NewAccessToken)
-		{
-			if (Handle->IsCancelled()) { Handle->ClearWaitingForRefresh(); return; }
-			Handle->ClearWaitingForRefresh();
-			Self->CallApi_Template_Execution<StructType>(InMethod, InServiceType, ConstructedURL, NewAccessToken, InContentBody, InQueryParams, OnGetCustomStruct, Handle, OnHttpRequestJobRetry, false);
-		};
-		Job.OnTokenFailed = [OnGetCustomStruct, Handle](const FString& ErrorCode, const FString& ErrorMessage)
-		{
-			Handle->ClearWaitingForRefresh();
-			StructType ErrorResult;
-			ErrorResult.Code = ErrorCode;
-			ErrorResult.Message = ErrorMessage;
-			OnGetCustomStruct(ErrorResult);
-		};
-		Self->RequestTokenRefresh(InServiceType, MoveTemp(Job));
-		return Handle;
+		PRINT_LOG(LogJWNU_GIS_ApiClientService, Warning, TEXT("Failed to serialize request body! (%s)"), EndpointType::Path);
+		DeliverTypedError(*Thunk, FJWNU_ApiError(TEXT("REQUEST_SERIALIZE_ERROR"), TEXT("Failed to serialize request body")));
+		return FJWNU_RequestHandle();
 	}
+	return CallEndpoint_Typed(WorldContextObject, FTraits::GetInfo(), InPathParams.GetView(), FJWNU_RequestBody(MoveTemp(BodyBytes)), InQueryParams, Thunk, OnHttpRequestJobRetry, InIdentityContext, InRequestConfig.GetPtrOrNull());
+}
 
-	// 실제 처리
-	Self->CallApi_Template_Execution(InMethod, InServiceType, ConstructedURL, ProvidedAccessTokenContainer.AccessToken, InContentBody, InQueryParams, OnGetCustomStruct, Handle, OnHttpRequestJobRetry, true);
-	return Handle;
+template <CJWNU_Endpoint EndpointType> requires (TJWNU_EndpointTraits<EndpointType>::bHasRequestBody == false)
+FJWNU_RequestHandle UJWNU_GIS_ApiClientService::CallEndpoint(
+	const UObject* WorldContextObject,
+	TFunction<void(const typename TJWNU_EndpointTraits<EndpointType>::ResponseType&)> OnResponse,
+	const TJWNU_PathParams<TJWNU_EndpointTraits<EndpointType>::PathParamCount>& InPathParams,
+	const TMap<FString, FString>& InQueryParams,
+	const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry,
+	const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext,
+	TFunction<void(const FJWNU_ApiError&)> OnApiError,
+	const TOptional<FJWNU_RequestConfig>& InRequestConfig)
+{
+	using FTraits = TJWNU_EndpointTraits<EndpointType>;
+	const FJWNU_ResponseThunkRef Thunk = MakeResponseThunk<typename FTraits::ResponseType>(MoveTemp(OnResponse), MoveTemp(OnApiError));
+	return CallEndpoint_Typed(WorldContextObject, FTraits::GetInfo(), InPathParams.GetView(), FJWNU_RequestBody(), InQueryParams, Thunk, OnHttpRequestJobRetry, InIdentityContext, InRequestConfig.GetPtrOrNull());
 }
 
 template <typename StructType>
-void UJWNU_GIS_ApiClientService::CallApi_Template_Execution(
+FJWNU_ResponseThunkRef UJWNU_GIS_ApiClientService::MakeResponseThunk(TFunction<void(const StructType&)>&& OnGetCustomStruct, TFunction<void(const FJWNU_ApiError&)>&& OnApiError)
+{
+	return MakeShared<FJWNU_ResponseThunk, ESPMode::ThreadSafe>(StructType::StaticStruct(),
+		[OnGetCustomStruct = MoveTemp(OnGetCustomStruct)](const void* InStructData)
+		{
+			OnGetCustomStruct(*static_cast<const StructType*>(InStructData));
+		},
+		MoveTemp(OnApiError));
+}
+
+template <typename ElementType>
+FJWNU_RequestHandle UJWNU_GIS_ApiClientService::CallApi_StreamArray(
+	const UObject* WorldContextObject,
 	const EJWNU_HttpMethod InMethod,
 	const EJWNU_ServiceType InServiceType,
-	const FString& InURL,
-	const FString& InAccessToken,
-	const FString& InContentBody,
+	const FStringView InEndpoint,
+	FJWNU_RequestBody InContentBody,
 	const TMap<FString, FString>& InQueryParams,
-	TFunction<void(const StructType&)> OnGetCustomStruct,
-	UJWNU_HttpRequestJobHandle* InHandle,
-	const FOnHttpRequestJobRetryDelegate& OnHttpRequestJobRetry,
-	const bool bTryTokenRefreshing)
+	const FString& InArrayFieldName,
+	const int32 InChunkSize,
+	TFunction<void(TArray<ElementType>&&)> OnGetChunk,
+	TFunction<void(const FJWNU_RES_Base&)> OnComplete,
+	const bool bRequiresAuth,
+	const TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe>& InIdentityContext,
+	TFunction<void(const FJWNU_ApiError&)> OnApiError,
+	const TOptional<FJWNU_RequestConfig>& InRequestConfig)
 {
-	if (bTryTokenRefreshing)
-	{
-		// 원래 요청 정보 저장 (401 발생 시 재시도용)
-		FJWNU_PendingApiRequest PendingRequest;
-		PendingRequest.ServiceType = InServiceType;
-		PendingRequest.Method = InMethod;
-		PendingRequest.URL = InURL;
-		PendingRequest.ContentBody = InContentBody;
-		PendingRequest.QueryParams = InQueryParams;
-
-		// 401 상태 코드를 처리할 수 있는 콜백
-		const auto CallbackManage401 = FOnHttpRequestCompletedDelegate::CreateWeakLambda(this,
-			[this, PendingRequest, OnGetCustomStruct, OnHttpRequestJobRetry, InHandle](const int32 StatusCode, const FString& ResponseBody)
-			{
-				if (StatusCode == 401)
-				{
-					PRINT_LOG(LogJWNU_GIS_ApiClientService, Display, TEXT("401 detected, queuing job and triggering token refresh..."));
-					JWNU_SCREEN_DEBUG(-1, 5.0f, FColor::Orange, TEXT("[JWNU] 401 Unauthorized — Triggering token refresh for %s"), *UEnum::GetValueAsString(PendingRequest.ServiceType));
-					InHandle->MarkWaitingForRefresh();
-					FJWNU_PendingJob Job;
-					Job.RequestInfo = PendingRequest;
-					Job.OnTokenReady = [this, PendingRequest, OnGetCustomStruct, OnHttpRequestJobRetry, InHandle](const FString& NewAccessToken)
-					{
-						if (InHandle->IsCancelled()) { InHandle->ClearWaitingForRefresh(); return; }
-						InHandle->ClearWaitingForRefresh();
-						CallApi_Template_Execution<StructType>(PendingRequest.Method, PendingRequest.ServiceType, PendingRequest.URL, NewAccessToken, PendingRequest.ContentBody, PendingRequest.QueryParams, OnGetCustomStruct, InHandle, OnHttpRequestJobRetry, false);
-					};
-					Job.OnTokenFailed = [OnGetCustomStruct, InHandle](const FString& ErrorCode, const FString& ErrorMessage)
-					{
-						InHandle->ClearWaitingForRefresh();
-						StructType ErrorResult;
-						ErrorResult.Code = ErrorCode;
-						ErrorResult.Message = ErrorMessage;
-						OnGetCustomStruct(ErrorResult);
-					};
-					RequestTokenRefresh(PendingRequest.ServiceType, MoveTemp(Job));
-					return;
-				}
-
-				// 언리얼 구조체 파싱 시도
-				StructType ResultData;
-				if (FJsonObjectConverter::JsonObjectStringToUStruct(ResponseBody, &ResultData, 0, 0))
-				{
-					OnGetCustomStruct(ResultData);
-				}
-				else
-				{
-					ResultData.Code = TEXT("JSON_PARSE_ERROR");
-					ResultData.Message = TEXT("Failed to Parse JSON Response Body");
-					OnGetCustomStruct(ResultData);
-				}
-			});
-
-		// Http 리퀘스트
-		UJWNU_HttpRequestJob* Job = UJWNU_GIS_HttpClientHelper::SendRequest_CustomResponse(GetWorld(), InMethod, InURL, InAccessToken, InContentBody, InQueryParams, CallbackManage401, OnHttpRequestJobRetry);
-		if (Job) { InHandle->BindJob(Job); }
-	}
-	else
+	// 타입에 의존하는 부분은 원소 수신기를 만드는 썽크뿐이고, 호스트 조회와 토큰 확인, 401 플로우는 비템플릿 코어가 처리한다
+	// (실패는 다른 타입 호출과 같이 구조화된 에러로 전달되므로 상태 코드와 전송 원인이 보존된다)
+	const FJWNU_ResponseThunkRef Thunk = MakeStreamArrayThunk<ElementType>(InArrayFieldName, InChunkSize, MoveTemp(OnGetChunk), MoveTemp(OnComplete), MoveTemp(OnApiError));
+	return CallApi_Typed(WorldContextObject, InMethod, InServiceType, InEndpoint, MoveTemp(InContentBody), InQueryParams, Thunk, FOnHttpRequestJobRetryDelegate(), bRequiresAuth, InIdentityContext, nullptr, InRequestConfig.GetPtrOrNull());
+}
+
+template <typename ElementType>
+FJWNU_ResponseThunkRef UJWNU_GIS_ApiClientService::MakeStreamArrayThunk(const FString& InArrayFieldName, const int32 InChunkSize, TFunction<void(TArray<ElementType>&&)>&& OnGetChunk, TFunction<void(const FJWNU_RES_Base&)>&& OnComplete, TFunction<void(const FJWNU_ApiError&)>&& OnApiError)
+{
+	const TSharedRef<FJWNU_ResponseThunk, ESPMode::ThreadSafe> Thunk = MakeShared<FJWNU_ResponseThunk, ESPMode::ThreadSafe>(FJWNU_RES_Base::StaticStruct(),
+		[OnComplete = MoveTemp(OnComplete)](const void* InStructData)
+		{
+			OnComplete(*static_cast<const FJWNU_RES_Base*>(InStructData));
+		},
+		MoveTemp(OnApiError));
+
+	const int32 ChunkSize = FMath::Max(1, InChunkSize);
+	Thunk->StreamArrayFieldName = InArrayFieldName;
+	Thunk->MakeStreamSink = [ChunkSize, OnGetChunk = MoveTemp(OnGetChunk)](const TWeakObjectPtr<const UObject>& InOwner, const FJWNU_RequestHandle& InHandle) -> FJWNU_StreamElementSinkRef
 	{
-		// 401 상태 코드를 처리하지 않는 콜백
-		const auto CallbackNoManage401 = FOnHttpRequestCompletedDelegate::CreateWeakLambda(this,
-			[this, OnGetCustomStruct](const int32 StatusCode, const FString& ResponseBody)
-			{
-				// 언리얼 구조체 파싱 시도
-				StructType ResultData;
-				if (FJsonObjectConverter::JsonObjectStringToUStruct(ResponseBody, &ResultData, 0, 0))
-				{
-					OnGetCustomStruct(ResultData);
-				}
-				else
-				{
-					ResultData.Code = TEXT("JSON_PARSE_ERROR");
-					ResultData.Message = TEXT("Failed to Parse JSON Response Body");
-					OnGetCustomStruct(ResultData);
-				}
-			});
-
-		// Http 리퀘스트
-		UJWNU_HttpRequestJob* Job = UJWNU_GIS_HttpClientHelper::SendRequest_CustomResponse(GetWorld(), InMethod, InURL, InAccessToken, InContentBody, InQueryParams, CallbackNoManage401, OnHttpRequestJobRetry);
-		if (Job) { InHandle->BindJob(Job); }
-	}
+		return MakeShared<TJWNU_StreamArraySink<ElementType>, ESPMode::ThreadSafe>(InOwner, InHandle, ChunkSize, OnGetChunk);
+	};
+	return Thunk;
 }
@@ -4,6 +4,10 @@
 
 #include "CoreMinimal.h"
 #include "JWNetworkUtilityTypes.h"
+#include "JWNU_TokenCipher.h"
+#include "JWNU_IdentityContext.h"
+#include "JWNetworkUtilityDelegates.h"
+#include "Tasks/Task.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Engine/Engine.h"
 #include "JWNU_GIS_ApiIdentityProvider.generated.h"
@@ -13,10 +17,24 @@
  */
 JWNETWORKUTILITY_API DECLARE_LOG_CATEGORY_EXTERN(LogJWNU_GIS_ApiIdentityProvider, Log, All);
 
+/**
+ * 백그라운드 키스토어 저장 대기열. (구현은 cpp 내부에 은닉)
+ */
+struct FJWNU_RefreshTokenWriteQueue;
+
+/**
+ * 백그라운드 키스토어 로드 결과. (구현은 cpp 내부에 은닉)
+ */
+struct FJWNU_KeystoreLoadResult;
+
+/**
+ * 키스토어 파일 로드 결과 열거형. (정의는 cpp 내부에 은닉)
+ */
+enum class EJWNU_KeystoreLoadStatus : uint8;
+
 /**
  * 인증 JWT 엑세스 토큰, 리프레시 토큰, UserId를 관리하는 게임인스턴스 서브시스템.
- * 서비스 타입별로 다른 엑세스 토큰을 TMap으로 관리하며, 리프레시 토큰을 암호화-복호화한다.
- * UserId는 단일 FString(메모리 전용, 로그인/리프레시 응답에서 수신)으로 관리한다.
+ * 엑세스 토큰과 UserId(메모리 전용, 로그인/리프레시 응답에서 수신)는 기본 인증 컨텍스트에 보관하며, 리프레시 토큰은 단일 암호화 키스토어 파일에 보관한다.
  */
 UCLASS()
 class JWNETWORKUTILITY_API UJWNU_GIS_ApiIdentityProvider : public UGameInstanceSubsystem
@@ -28,10 +46,15 @@ public:
 	// 프로그래밍 팁 : meta=(BlueprintOutRef="OutRef1, OutRef2, ...")를 사용하면 블루프린트 활용도를 높일 수 있다
 
 	/**
-	 * Overriding for initializing token container map \n 토큰 컨테이너 맵을 초기화하는 로직 오버라이드.
+	 * Overriding for initializing token container map and keystore \n 토큰 컨테이너 맵과 키스토어를 초기화하는 로직 오버라이드.
 	 */
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 
+	/**
+	 * Overriding for flushing pending token writes \n 대기 중인 리프레시 토큰 저장 작업을 모두 마무리하는 로직 오버라이드.
+	 */
+	virtual void Deinitialize() override;
+
 	/**
 	 * 외부에서 HTTP 클라이언트 헬퍼 서브시스템을 획득하기 위해 호출하는 함수.
 	 * @param WorldContextObject 월드 컨텍스트 오브젝트
@@ -87,11 +110,13 @@ public:
 
 	/**
 	 * [ For CPP ] \n Load Refresh Token Container from WINDOWS \n 윈도우를 통해 JWT 인증 리프레시 토큰 컨테이너를 로드하는 함수.
+	 * 부팅 시 키스토어에서 복호화해 둔 메모리 사본을 반환하므로 디스크 I/O가 발생하지 않는다.
+	 * 백그라운드 로드가 아직 끝나지 않았다면 대기하지 않고 실패를 반환하므로, IsKeystoreLoaded 또는 CallWhenKeystoreLoaded로 완료 시점을 확인한다.
 	 * @param InServiceType Targeting Service Type \n 특정 서비스 타입
 	 * @param OutRefreshTokenContainer Loaded Refresh Token Container \n 특정 서비스 타입과 매핑되는 JWT 인증 리프레시 토큰 컨테이너
 	 * @return Success or Fail \n 성공 여부
 	 */
-	static bool GetRefreshTokenContainer(const EJWNU_ServiceType InServiceType, FJWNU_RefreshTokenContainer& OutRefreshTokenContainer);
+	bool GetRefreshTokenContainer(const EJWNU_ServiceType InServiceType, FJWNU_RefreshTokenContainer& OutRefreshTokenContainer) const;
 
 	/**
 	 * Save Refresh Token Container to WINDOWS \n 윈도우를 통해 JWT 인증 리프레시 토큰 컨테이너를 저장하는 함수.
@@ -105,11 +130,42 @@ public:
 
 	/**
 	 * [ For CPP ] \n Save Refresh Token Container to WINDOWS \n 윈도우를 통해 JWT 인증 리프레시 토큰 컨테이너를 저장하는 함수.
+	 * 메모리 사본을 즉시 갱신하고, 키스토어 전체의 직렬화-암호화-파일 저장은 백그라운드 작업으로 넘긴다.
+	 * 저장이 밀려 있는 동안 요청이 반복되면 가장 최신 스냅샷만 기록된다.
 	 * @param InServiceType Targeting Service Type \n 특정 서비스 타입
 	 * @param InRefreshTokenContainer Targeting Refresh Token Container \n 특정 서비스 타입과 매핑되는 JWT 인증 리프레시 토큰 컨테이너
-	 * @return Success or Fail \n 성공 여부
+	 * @return Success or Fail \n 성공 여부 (유효하지 않은 서비스 타입, 저장 예약 실패, 직전 백그라운드 저장 실패 시 false)
 	 */
-	static bool SetRefreshTokenContainer(const EJWNU_ServiceType InServiceType, const FJWNU_RefreshTokenContainer& InRefreshTokenContainer);
+	bool SetRefreshTokenContainer(const EJWNU_ServiceType InServiceType, const FJWNU_RefreshTokenContainer& InRefreshTokenContainer);
+
+	// ──────── Keystore ────────
+
+	/**
+	 * 시작 시 백그라운드에서 진행한 키스토어 로드가 게임 스레드에 반영되었는지 여부를 반환한다.
+	 * @return 로드 완료 여부
+	 */
+	bool IsKeystoreLoaded() const;
+
+	/**
+	 * 키스토어 로드가 게임 스레드에 반영된 뒤 콜백을 실행한다. 이미 반영되었다면 즉시 실행한다. (게임 스레드 전용, 대기하지 않음)
+	 * @param InCallback 로드 반영 후 1회 실행할 콜백
+	 */
+	void CallWhenKeystoreLoaded(TUniqueFunction<void()>&& InCallback);
+
+	/**
+	 * 키스토어 로드가 게임 스레드에 반영되었을 때 호출되는 델리게이트를 반환한다.
+	 * @return 키스토어 로드 완료 델리게이트
+	 */
+	FOnKeystoreLoadedDelegate& GetOnKeystoreLoaded();
+
+	// ──────── Identity Context ────────
+
+	/**
+	 * 이 서브시스템이 소유하는 기본 인증 컨텍스트를 반환한다.
+	 * 컨텍스트를 지정하지 않은 API 호출과 이 서브시스템의 토큰/UserId 함수는 모두 기본 컨텍스트를 대상으로 하며, 리프레시 토큰은 키스토어에 영속화된다.
+	 * @return 기본 인증 컨텍스트
+	 */
+	TSharedRef<FJWNU_IdentityContext, ESPMode::ThreadSafe> GetDefaultIdentityContext() const;
 
 	// ──────── UserId ────────
 
@@ -128,7 +184,7 @@ public:
 	// ──────── 세션 정리 ────────
 
 	/**
-	 * 특정 서비스 타입의 인증 정보를 정리한다. (AccessToken 초기화, UserId 유지)
+	 * 특정 서비스 타입의 인증 정보를 정리한다. (AccessToken 초기화, 키스토어의 리프레시 토큰 및 UserId 유지)
 	 * @param InServiceType 정리할 서비스 타입
 	 */
 	void ClearSession(EJWNU_ServiceType InServiceType);
@@ -136,46 +192,124 @@ public:
 private:
 
 	/**
-	 * 특정 서비스 타입의 리프레시 토큰 컨테이너를 암호화하여 저장하는 함수.
-	 * @param InServiceType Targeting Service Type \n 특정 서비스 타입
-	 * @param InRefreshTokenContainer Targeting Refresh Token Container \n 저장할 리프레시 토큰 컨테이너
-	 * @return Success or Fail \n 성공 여부
+	 * 백그라운드 로드가 끝난 뒤 게임 스레드에서 결과를 메모리 사본에 반영하고, 대기 중인 콜백과 델리게이트를 실행하는 함수.
 	 */
-	static bool SaveRefreshTokenContainer(const EJWNU_ServiceType InServiceType, const FJWNU_RefreshTokenContainer& InRefreshTokenContainer);
+	void ApplyKeystoreLoadResult();
 
 	/**
-	 * 특정 서비스 타입의 리프레시 토큰 컨테이너를 복호화하여 반환하는 함수.
+	 * 백그라운드 스레드에서 기본 암호화 백엔드를 만들고, 키스토어 파일을 한 번에 로드-복호화하고, 구버전 서비스별 파일이 남아있다면 이관하는 함수.
+	 * UEnum, FText에 접근하지 않도록 레코드 키와 구버전 파일명은 게임 스레드에서 미리 조회해 넘긴다.
+	 * @param OutLoadResult 로드 결과 (생성한 암호화 백엔드 포함)
+	 * @param InLegacyRecordFiles 레코드 키와 구버전 파일명 쌍 목록
+	 */
+	static void LoadKeystoreInBackground(FJWNU_KeystoreLoadResult& OutLoadResult, const TArray<TPair<FString, FString>>& InLegacyRecordFiles);
+
+	/**
+	 * 현재 레코드 맵의 스냅샷을 저장 대기열에 적재하고, 저장 작업이 없다면 백그라운드 작업을 시작하는 함수.
+	 * @return 저장 예약 성공 여부 (직전 백그라운드 저장이 실패했다면 false)
+	 */
+	bool EnqueueKeystoreWrite();
+
+	/**
+	 * 백그라운드 스레드에서 대기열이 빌 때까지 가장 최신 키스토어 스냅샷을 저장하는 함수.
+	 * @param InWriteQueue 저장 대기열
+	 */
+	static void DrainKeystoreWrites(const TSharedRef<FJWNU_RefreshTokenWriteQueue, ESPMode::ThreadSafe>& InWriteQueue);
+
+	/**
+	 * 서비스 타입에 대응하는 키스토어 레코드 키를 반환하는 함수. 열거형 이름은 최초 1회만 조회된다.
 	 * @param InServiceType Targeting Service Type \n 특정 서비스 타입
-	 * @param OutRefreshTokenContainer Targeting Refresh Token Container \n 로드할 리프레시 토큰 컨테이너
-	 * @return Success or Fail \n 성공 여부
+	 * @return 키스토어 레코드 키
 	 */
-	static bool LoadRefreshTokenContainer(const EJWNU_ServiceType InServiceType, FJWNU_RefreshTokenContainer& OutRefreshTokenContainer);
+	static const FString& GetKeystoreRecordKey(const EJWNU_ServiceType InServiceType);
 
 	/**
-	 * 입력 토큰을 암호화하여 반환하는 함수.
-	 * @param InToken Targeting Token \n 암호화할 토큰
-	 * @param OutEncryptedData Data After Encryption \n 암호화된 토큰 데이터
-	 * @return Success or Fail \n 성공 여부
+	 * 키스토어 파일 경로를 반환하는 함수.
+	 * @return 암호화된 키스토어 파일의 전체 경로
 	 */
-	static bool EncryptToken(const FString& InToken, TArray<uint8>& OutEncryptedData);
+	static FString GetKeystoreFilePath();
 
 	/**
-	 * 암호화된 토큰 데이터를 복호화하여 반환하는 함수.
-	 * @param InEncryptedData Targeting Encrypted Token Data \n 암호화되어 있는 토큰 데이터
-	 * @param OutToken Token After Decryption \n 복호화된 토큰 데이터
+	 * 레코드 맵 전체를 직렬화-암호화하여 키스토어 파일에 저장하는 함수.
+	 * 임시 파일에 먼저 기록한 뒤 교체하므로, 저장 도중 중단되어도 기존 파일이 깨지지 않는다.
+	 * @param InRecords 저장할 레코드 맵
+	 * @param InCipher 암호화 백엔드
 	 * @return Success or Fail \n 성공 여부
 	 */
-	static bool DecryptToken(const TArray<uint8>& InEncryptedData, FString& OutToken);
+	static bool SaveKeystore(const TMap<FString, FJWNU_RefreshTokenContainer>& InRecords, const IJWNU_TokenCipher& InCipher);
+
+	/**
+	 * 키스토어 파일을 복호화-역직렬화하여 레코드 맵으로 반환하는 함수.
+	 * 깨진 파일과 이 빌드에서 읽을 수 없는 파일(최신 버전, 사용할 수 없는 백엔드)을 구분해서 반환한다.
+	 * @param OutRecords 로드한 레코드 맵
+	 * @param OutCipherId 파일 헤더에 기록된 암호화 백엔드 식별자
+	 * @param OutFilePath 실제로 읽은 파일 경로 (최종 파일 또는 복구용 임시 파일)
+	 * @return 로드 결과
+	 */
+	static EJWNU_KeystoreLoadStatus LoadKeystore(TMap<FString, FJWNU_RefreshTokenContainer>& OutRecords, EJWNU_TokenCipherId& OutCipherId, FString& OutFilePath);
+
+	/**
+	 * 구버전의 서비스별 리프레시 토큰 파일(auth_<Service>.bin)을 레코드 맵으로 이관하는 함수.
+	 * @param InOutRecords 이관 대상 레코드 맵 (이미 존재하는 레코드는 덮어쓰지 않는다)
+	 * @param InLegacyRecordFiles 레코드 키와 구버전 파일명 쌍 목록
+	 * @param OutMigratedFilePaths 이관에 성공한 파일 경로 목록
+	 */
+	static void MigrateLegacyRefreshTokenFiles(TMap<FString, FJWNU_RefreshTokenContainer>& InOutRecords, const TArray<TPair<FString, FString>>& InLegacyRecordFiles, TArray<FString>& OutMigratedFilePaths);
+
+	/**
+	 * 기본 인증 컨텍스트. 엑세스 토큰, UserId, 리프레시 상태를 보관한다.
+	 */
+	TSharedPtr<FJWNU_IdentityContext, ESPMode::ThreadSafe> DefaultIdentityContext;
+
+	/**
+	 * 키스토어 레코드 키와 복호화된 리프레시 토큰 컨테이너를 매핑하는 메모리 사본.
+	 * 부팅 시 1회 복호화로 채워지며, 알 수 없는 키의 레코드도 저장 시 그대로 보존한다.
+	 */
+	TMap<FString, FJWNU_RefreshTokenContainer> KeystoreRecords;
+
+	/**
+	 * 시작 시 키스토어를 로드하는 백그라운드 작업.
+	 */
+	UE::Tasks::FTask KeystoreLoadTask;
+
+	/**
+	 * 백그라운드 작업과 공유하는 키스토어 로드 결과. 게임 스레드에 반영된 뒤에는 해제된다.
+	 */
+	TSharedPtr<FJWNU_KeystoreLoadResult, ESPMode::ThreadSafe> KeystoreLoadResult;
+
+	/**
+	 * 키스토어 로드 결과가 메모리 사본에 반영되었는지 여부.
+	 */
+	bool bKeystoreLoaded = false;
+
+	/**
+	 * 로드 반영 전에 레코드가 변경되어, 반영 직후 저장이 필요한지 여부. (로드 전 저장은 디스크의 다른 레코드를 덮어쓰므로 미룬다)
+	 */
+	bool bKeystoreWriteDeferred = false;
+
+	/**
+	 * 이 빌드에서 읽을 수 없는 키스토어를 보존하거나 암호화 백엔드가 안전한 키를 만들지 못해 이번 세션의 저장을 막았는지 여부.
+	 */
+	bool bKeystoreWriteLocked = false;
+
+	/**
+	 * 키스토어 로드 완료 델리게이트.
+	 */
+	FOnKeystoreLoadedDelegate OnKeystoreLoaded;
+
+	/**
+	 * 키스토어 로드 반영을 기다리는 1회성 콜백 목록.
+	 */
+	TArray<TUniqueFunction<void()>> KeystoreLoadedCallbacks;
 
 	/**
-	 * 특정 서비스 타입과 JWT 인증 토큰 컨테이너를 매핑하는 맵.
+	 * 키스토어 암호화 백엔드. 로드 작업에서 만들어 반영 시점에 설정되며, 백그라운드 저장 작업과 공유한다.
 	 */
-	UPROPERTY()
-	TMap<EJWNU_ServiceType, FJWNU_AccessTokenContainer> ServiceTypeToTokenContainerMap;
+	TSharedPtr<IJWNU_TokenCipher, ESPMode::ThreadSafe> TokenCipher;
 
 	/**
-	 * 현재 로그인된 사용자 ID. (메모리 전용)
+	 * 백그라운드 작업과 공유하는 리프레시 토큰 저장 대기열.
 	 */
-	FString UserId;
+	TSharedPtr<FJWNU_RefreshTokenWriteQueue, ESPMode::ThreadSafe> RefreshTokenWriteQueue;
 
 };
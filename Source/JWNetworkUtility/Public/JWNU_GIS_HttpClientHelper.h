@@ -7,6 +7,8 @@
 #include "JWNetworkUtilityDelegates.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "JWNU_HttpRequestJob.h"
+#include "JWNU_Endpoint.h"
+#include "JWNU_EndpointPolicyTrie.h"
 #include "Engine/Engine.h"
 #include "JWNU_GIS_HttpClientHelper.generated.h"
 
@@ -37,11 +39,12 @@ public:
 	
 	/**
 	 * HTTP 리퀘스트를 보내는 함수. 전처리하지 않은 Raw Response Body를 콜백으로 반환한다.
+	 * 블루프린트와 UObject 콜백이 쓰는 경로이므로, 경로 정책과 무관하게 응답 처리 스레드는 게임 스레드로 고정된다.
 	 * @param WorldContextObject 월드 컨텍스트 오브젝트
 	 * @param InMethod HTTP 메서드
 	 * @param InURL 리퀘스트를 보낼 URL
 	 * @param InAuthToken 헤더에 탑재할 JWT 인증 토큰
-	 * @param InContentBody JSON 등으로 이루어진 콘텐츠 바디
+	 * @param InContentBody JSON 등으로 이루어진 콘텐츠 바디 (텍스트는 한 번만 UTF-8로 변환, UTF-8 바이트는 이동)
 	 * @param InQueryParams  URL에 부착하는 쿼리 패리미터
 	 * @param InOnHttpResponse 서버 로직 도달 여부와 리스폰스 바디를 전달하는 콜백 델리게이트
 	 * @param InOnHttpRequestJobRetry 재시도 콜백
@@ -49,89 +52,271 @@ public:
 	static UJWNU_HttpRequestJob* SendRequest_RawResponse(
 		const UObject* WorldContextObject,
 		const EJWNU_HttpMethod InMethod,
-		const FString& InURL,
+		FString InURL,
 		const FString& InAuthToken,
-		const FString& InContentBody,
+		FJWNU_RequestBody InContentBody,
 		const TMap<FString, FString>& InQueryParams,
 		const FOnHttpRequestCompletedDelegate& InOnHttpResponse,
 		const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry = FOnHttpRequestJobRetryDelegate());
 
 	/**
 	 * HTTP 리퀘스트를 보내는 함수. 전처리된 Custom Response Body를 콜백으로 반환한다.
+	 * 블루프린트와 UObject 콜백이 쓰는 경로이므로, 경로 정책과 무관하게 응답 처리 스레드는 게임 스레드로 고정된다.
 	 * @param WorldContextObject 월드 컨텍스트 오브젝트
 	 * @param InMethod HTTP 메서드
 	 * @param InURL 리퀘스트를 보낼 URL
 	 * @param InAuthToken 헤더에 탑재할 JWT 인증 토큰
-	 * @param InContentBody JSON 등으로 이루어진 콘텐츠 바디
+	 * @param InContentBody JSON 등으로 이루어진 콘텐츠 바디 (텍스트는 한 번만 UTF-8로 변환, UTF-8 바이트는 이동)
 	 * @param InQueryParams  URL에 부착하는 쿼리 패리미터
 	 * @param InOnHttpResponse 서버 로직 도달 여부와 리스폰스 바디를 전달하는 콜백 델리게이트
 	 * @param InOnHttpRequestJobRetry 재시도 콜백
+	 * @param InOnHttpRequestFailed 실패 콜백 (바인딩 시 가짜 JSON 리스폰스 바디 대신 구조화된 에러를 전달)
 	 */
 	static UJWNU_HttpRequestJob* SendRequest_CustomResponse(
 		const UObject* WorldContextObject,
 		const EJWNU_HttpMethod InMethod,
-		const FString& InURL,
+		FString InURL,
 		const FString& InAuthToken,
-		const FString& InContentBody,
+		FJWNU_RequestBody InContentBody,
 		const TMap<FString, FString>& InQueryParams,
 		const FOnHttpRequestCompletedDelegate& InOnHttpResponse,
+		const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry = FOnHttpRequestJobRetryDelegate(),
+		const FOnHttpRequestFailedDelegate& InOnHttpRequestFailed = FOnHttpRequestFailedDelegate());
+
+	/**
+	 * HTTP 리퀘스트를 보내는 함수. 리스폰스 바디를 메모리에 모으지 않고 도착하는 대로 스트림 콜백에 넘긴다.
+	 * 이미 넘긴 바디는 되돌릴 수 없으므로 재시도하지 않는다. 응답 처리 스레드는 게임 스레드로 고정된다.
+	 * @param WorldContextObject 월드 컨텍스트 오브젝트
+	 * @param InMethod HTTP 메서드
+	 * @param InURL 리퀘스트를 보낼 URL
+	 * @param InAuthToken 헤더에 탑재할 JWT 인증 토큰
+	 * @param InContentBody JSON 등으로 이루어진 콘텐츠 바디 (텍스트는 한 번만 UTF-8로 변환, UTF-8 바이트는 이동)
+	 * @param InQueryParams  URL에 부착하는 쿼리 패리미터
+	 * @param InOnHttpResponseStream 리스폰스 바디 조각을 도착하는 대로 전달받는 콜백 (HTTP 스레드에서 호출될 수 있음)
+	 * @param InOnHttpResponse 상태 코드를 전달하는 완료 콜백 (2XX라면 바디는 비어 있고, 그 외에는 전처리된 Custom Response Body)
+	 * @param InOnHttpRequestFailed 실패 콜백 (바인딩 시 가짜 JSON 리스폰스 바디 대신 구조화된 에러를 전달)
+	 */
+	static UJWNU_HttpRequestJob* SendRequest_StreamResponse(
+		const UObject* WorldContextObject,
+		const EJWNU_HttpMethod InMethod,
+		FString InURL,
+		const FString& InAuthToken,
+		FJWNU_RequestBody InContentBody,
+		const TMap<FString, FString>& InQueryParams,
+		const FOnHttpResponseStreamDelegate& InOnHttpResponseStream,
+		const FOnHttpRequestCompletedDelegate& InOnHttpResponse,
+		const FOnHttpRequestFailedDelegate& InOnHttpRequestFailed = FOnHttpRequestFailedDelegate());
+
+	/**
+	 * 이 헬퍼의 기본 동작 설정으로 요청 기술자를 만드는 함수. 서비스 계층은 호출당 한 번만 만들어 재시도와 재전송에 그대로 재사용한다.
+	 * 서비스 계층용이므로 응답 처리 스레드 정책은 항상 게임 스레드로 고정된다.
+	 * @param WorldContextObject 월드 컨텍스트 오브젝트
+	 * @param InMethod HTTP 메서드
+	 * @param InServiceType 토큰 리프레시 대상 서비스 타입
+	 * @param InURL 리퀘스트를 보낼 URL
+	 * @param InContentBody JSON 등으로 이루어진 콘텐츠 바디 (텍스트는 한 번만 UTF-8로 변환, UTF-8 바이트는 이동)
+	 * @param InQueryParams  URL에 부착하는 쿼리 패리미터
+	 * @param InEndpoint 엔드포인트 정보 (지정 시 경로 정책 위에 엔드포인트 정책을 덮어쓰고 식별자를 기록)
+	 * @param InConfigOverride 호출 단위 설정 (지정 시 경로 정책과 엔드포인트 정책 대신 그대로 사용)
+	 * @return 요청 기술자 (헬퍼를 얻지 못하면 기본 생성된 동작 설정 사용)
+	 */
+	static FJWNU_RequestDescriptorRef MakeRequestDescriptor(
+		const UObject* WorldContextObject,
+		const EJWNU_HttpMethod InMethod,
+		const EJWNU_ServiceType InServiceType,
+		FString InURL,
+		FJWNU_RequestBody InContentBody,
+		const TMap<FString, FString>& InQueryParams,
+		const FJWNU_EndpointInfo* InEndpoint = nullptr,
+		const FJWNU_RequestConfig* InConfigOverride = nullptr);
+
+	/**
+	 * URL의 경로와 가장 길게 일치하는 엔드포인트 정책의 설정을 반환하는 함수. 일치하는 정책이 없다면 기본 설정을 반환한다.
+	 * 호출 단위로 설정을 덮어쓸 때 이 값을 시작점으로 일부 필드만 바꿔 넘기면 된다.
+	 * @param InURL 호스트를 포함한 URL 또는 경로
+	 * @return 적용할 HTTP 리퀘스트 설정
+	 */
+	const FJWNU_RequestConfig& ResolveRequestConfig(const FStringView InURL) const;
+
+	/**
+	 * 미리 만든 요청 기술자로 HTTP 리퀘스트를 보내는 함수. 전처리하지 않은 Raw Response Body를 콜백으로 반환한다.
+	 * 기술자의 응답 처리 스레드를 그대로 따르므로, 게임 스레드 밖을 고른 네이티브 호출자는 UObject에 묶이지 않은 콜백을 넘겨야 한다.
+	 * @param WorldContextObject 월드 컨텍스트 오브젝트
+	 * @param InRequest 요청 기술자
+	 * @param InAuthToken 헤더에 탑재할 JWT 인증 토큰
+	 * @param InOnHttpResponse 서버 로직 도달 여부와 리스폰스 바디를 전달하는 콜백 델리게이트
+	 * @param InOnHttpRequestJobRetry 재시도 콜백
+	 */
+	static UJWNU_HttpRequestJob* SendRequest_RawResponse(
+		const UObject* WorldContextObject,
+		const FJWNU_RequestDescriptorRef& InRequest,
+		const FString& InAuthToken,
+		const FOnHttpRequestCompletedDelegate& InOnHttpResponse,
 		const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry = FOnHttpRequestJobRetryDelegate());
+
+	/**
+	 * 미리 만든 요청 기술자로 HTTP 리퀘스트를 보내는 함수. 전처리된 Custom Response Body를 콜백으로 반환한다.
+	 * 기술자의 응답 처리 스레드를 그대로 따르므로, 게임 스레드 밖을 고른 네이티브 호출자는 UObject에 묶이지 않은 콜백을 넘겨야 한다.
+	 * @param WorldContextObject 월드 컨텍스트 오브젝트
+	 * @param InRequest 요청 기술자
+	 * @param InAuthToken 헤더에 탑재할 JWT 인증 토큰
+	 * @param InOnHttpResponse 서버 로직 도달 여부와 리스폰스 바디를 전달하는 콜백 델리게이트
+	 * @param InOnHttpRequestJobRetry 재시도 콜백
+	 * @param InOnHttpRequestFailed 실패 콜백 (바인딩 시 가짜 JSON 리스폰스 바디 대신 구조화된 에러를 전달)
+	 */
+	static UJWNU_HttpRequestJob* SendRequest_CustomResponse(
+		const UObject* WorldContextObject,
+		const FJWNU_RequestDescriptorRef& InRequest,
+		const FString& InAuthToken,
+		const FOnHttpRequestCompletedDelegate& InOnHttpResponse,
+		const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry = FOnHttpRequestJobRetryDelegate(),
+		const FOnHttpRequestFailedDelegate& InOnHttpRequestFailed = FOnHttpRequestFailedDelegate());
+
+	/**
+	 * 미리 만든 요청 기술자로 HTTP 리퀘스트를 보내는 함수. CustomResponse와 같지만 리스폰스 바디를 FString으로 변환하지 않고 UTF-8 바이트 그대로 콜백에 넘긴다.
+	 * 기술자의 응답 처리 스레드를 그대로 따르므로, 게임 스레드 밖을 고른 네이티브 호출자는 UObject에 묶이지 않은 콜백을 넘겨야 한다.
+	 * @param WorldContextObject 월드 컨텍스트 오브젝트
+	 * @param InRequest 요청 기술자
+	 * @param InAuthToken 헤더에 탑재할 JWT 인증 토큰
+	 * @param InOnHttpResponse 상태 코드와 UTF-8 리스폰스 바이트를 전달하는 콜백 델리게이트
+	 * @param InOnHttpRequestJobRetry 재시도 콜백
+	 * @param InOnHttpRequestFailed 실패 콜백 (바인딩 시 가짜 JSON 리스폰스 바디 대신 구조화된 에러를 전달)
+	 */
+	static UJWNU_HttpRequestJob* SendRequest_Utf8Response(
+		const UObject* WorldContextObject,
+		const FJWNU_RequestDescriptorRef& InRequest,
+		const FString& InAuthToken,
+		const FOnHttpRequestCompletedUtf8Delegate& InOnHttpResponse,
+		const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry = FOnHttpRequestJobRetryDelegate(),
+		const FOnHttpRequestFailedDelegate& InOnHttpRequestFailed = FOnHttpRequestFailedDelegate());
+
+	/**
+	 * 미리 만든 요청 기술자로 HTTP 리퀘스트를 보내는 함수. 리스폰스 바디를 메모리에 모으지 않고 도착하는 대로 스트림 콜백에 넘긴다.
+	 * 기술자의 응답 처리 스레드를 그대로 따르므로, 게임 스레드 밖을 고른 네이티브 호출자는 UObject에 묶이지 않은 콜백을 넘겨야 한다.
+	 * @param WorldContextObject 월드 컨텍스트 오브젝트
+	 * @param InRequest 요청 기술자
+	 * @param InAuthToken 헤더에 탑재할 JWT 인증 토큰
+	 * @param InOnHttpResponseStream 리스폰스 바디 조각을 도착하는 대로 전달받는 콜백 (HTTP 스레드에서 호출될 수 있음)
+	 * @param InOnHttpResponse 상태 코드를 전달하는 완료 콜백 (2XX라면 바디는 비어 있고, 그 외에는 전처리된 Custom Response Body)
+	 * @param InOnHttpRequestFailed 실패 콜백 (바인딩 시 가짜 JSON 리스폰스 바디 대신 구조화된 에러를 전달)
+	 */
+	static UJWNU_HttpRequestJob* SendRequest_StreamResponse(
+		const UObject* WorldContextObject,
+		const FJWNU_RequestDescriptorRef& InRequest,
+		const FString& InAuthToken,
+		const FOnHttpResponseStreamDelegate& InOnHttpResponseStream,
+		const FOnHttpRequestCompletedDelegate& InOnHttpResponse,
+		const FOnHttpRequestFailedDelegate& InOnHttpRequestFailed = FOnHttpRequestFailedDelegate());
 	
 private:
 	
 	/**
 	 * 동일한 이름의 정적 함수에 의해 호출되어, 실제로 처리하는 비정적 함수.
-	 * @param InMethod HTTP 메서드
-	 * @param InURL 리퀘스트를 보낼 URL
+	 * @param InRequest 요청 기술자
 	 * @param InAuthToken 헤더에 탑재할 JWT 인증 토큰
-	 * @param InContentBody JSON 등으로 이루어진 콘텐츠 바디
-	 * @param InQueryParams  URL에 부착하는 쿼리 패리미터
 	 * @param InOnHttpResponse 서버 로직 도달 여부와 리스폰스 바디를 전달하는 콜백 델리게이트
 	 * @param InOnHttpRequestJobRetry 재시도 콜백
 	 */
 	UJWNU_HttpRequestJob* SendRequest_RawResponse(
-		const EJWNU_HttpMethod InMethod,
-		const FString& InURL,
+		const FJWNU_RequestDescriptorRef& InRequest,
 		const FString& InAuthToken,
-		const FString& InContentBody,
-		const TMap<FString, FString>& InQueryParams,
 		const FOnHttpRequestCompletedDelegate& InOnHttpResponse,
-		const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry = FOnHttpRequestJobRetryDelegate());
+		const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry);
 
 	/**
 	 * 동일한 이름의 정적 함수에 의해 호출되어, 실제로 처리하는 비정적 함수.
-	 * @param InMethod HTTP 메서드
-	 * @param InURL 리퀘스트를 보낼 URL
+	 * @param InRequest 요청 기술자
 	 * @param InAuthToken 헤더에 탑재할 JWT 인증 토큰
-	 * @param InContentBody JSON 등으로 이루어진 콘텐츠 바디
-	 * @param InQueryParams  URL에 부착하는 쿼리 패리미터
 	 * @param InOnHttpResponse 서버 로직 도달 여부와 리스폰스 바디를 전달하는 콜백 델리게이트
 	 * @param InOnHttpRequestJobRetry 재시도 콜백
+	 * @param InOnHttpRequestFailed 실패 콜백 (바인딩 시 가짜 JSON 리스폰스 바디 대신 구조화된 에러를 전달)
 	 */
 	UJWNU_HttpRequestJob* SendRequest_CustomResponse(
-		const EJWNU_HttpMethod InMethod,
-		const FString& InURL,
+		const FJWNU_RequestDescriptorRef& InRequest,
 		const FString& InAuthToken,
-		const FString& InContentBody,
-		const TMap<FString, FString>& InQueryParams,
 		const FOnHttpRequestCompletedDelegate& InOnHttpResponse,
-		const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry = FOnHttpRequestJobRetryDelegate());
+		const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry,
+		const FOnHttpRequestFailedDelegate& InOnHttpRequestFailed);
+
+	/**
+	 * 동일한 이름의 정적 함수에 의해 호출되어, 실제로 처리하는 비정적 함수.
+	 * @param InRequest 요청 기술자
+	 * @param InAuthToken 헤더에 탑재할 JWT 인증 토큰
+	 * @param InOnHttpResponse 상태 코드와 UTF-8 리스폰스 바이트를 전달하는 콜백 델리게이트
+	 * @param InOnHttpRequestJobRetry 재시도 콜백
+	 * @param InOnHttpRequestFailed 실패 콜백 (바인딩 시 가짜 JSON 리스폰스 바디 대신 구조화된 에러를 전달)
+	 */
+	UJWNU_HttpRequestJob* SendRequest_Utf8Response(
+		const FJWNU_RequestDescriptorRef& InRequest,
+		const FString& InAuthToken,
+		const FOnHttpRequestCompletedUtf8Delegate& InOnHttpResponse,
+		const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry,
+		const FOnHttpRequestFailedDelegate& InOnHttpRequestFailed);
 	
 	/**
-	 * 300번대 이상의 상태 코드를 커스텀 코드로 매핑하는 맵.
+	 * 동일한 이름의 정적 함수에 의해 호출되어, 실제로 처리하는 비정적 함수.
+	 * @param InRequest 요청 기술자
+	 * @param InAuthToken 헤더에 탑재할 JWT 인증 토큰
+	 * @param InOnHttpResponseStream 리스폰스 바디 조각을 도착하는 대로 전달받는 콜백 (HTTP 스레드에서 호출될 수 있음)
+	 * @param InOnHttpResponse 상태 코드를 전달하는 완료 콜백 (2XX라면 바디는 비어 있고, 그 외에는 전처리된 Custom Response Body)
+	 * @param InOnHttpRequestFailed 실패 콜백 (바인딩 시 가짜 JSON 리스폰스 바디 대신 구조화된 에러를 전달)
+	 */
+	UJWNU_HttpRequestJob* SendRequest_StreamResponse(
+		const FJWNU_RequestDescriptorRef& InRequest,
+		const FString& InAuthToken,
+		const FOnHttpResponseStreamDelegate& InOnHttpResponseStream,
+		const FOnHttpRequestCompletedDelegate& InOnHttpResponse,
+		const FOnHttpRequestFailedDelegate& InOnHttpRequestFailed);
+
+	/**
+	 * 네트워크 실패와 300번대 이상의 상태 코드를 { success, code, message } 구조의 가짜 JSON 리스폰스 바디로 바꿔 전달하는 Job 완료 콜백을 만드는 함수.
+	 * 실패 콜백을 바인딩하지 않은 호출자(블루프린트 등)를 위한 호환 경로다.
+	 * @param InOnHttpResponse 전처리된 리스폰스를 전달받는 콜백 델리게이트
+	 * @return Job 완료 콜백
+	 */
+	FOnHttpRequestJobCompletedDelegate MakeCustomResponseCallback(const FOnHttpRequestCompletedDelegate& InOnHttpResponse);
+
+	/**
+	 * MakeCustomResponseCallback과 같은 전처리를 하되, 리스폰스 바디를 UTF-8 바이트 그대로 전달하는 Job 완료 콜백을 만드는 함수.
+	 * @param InOnHttpResponse 전처리된 UTF-8 리스폰스를 전달받는 콜백 델리게이트
+	 * @return Job UTF-8 완료 콜백
 	 */
-	UPROPERTY()
-	TMap<int32, FString> StatusCodeToCustomCodeMap;
+	FOnHttpRequestJobCompletedUtf8Delegate MakeUtf8ResponseCallback(const FOnHttpRequestCompletedUtf8Delegate& InOnHttpResponse);
 
 	/**
-	 *  300번대 이상의 상태 코드를 토대로 커스텀 메시지로 매핑하는 맵.
+	 * Job의 실패 결과에 커스텀 코드와 메시지를 채워 실패 콜백에 전달하는 Job 실패 콜백을 만드는 함수.
+	 * @param InOnHttpRequestFailed 구조화된 에러를 전달받는 콜백 델리게이트
+	 * @return Job 실패 콜백 (InOnHttpRequestFailed가 바인딩되지 않았다면 바인딩되지 않은 델리게이트)
 	 */
-	UPROPERTY()
-	TMap<int32, FString> StatusCodeToCustomMessageMap;
+	FOnHttpRequestJobFailedDelegate MakeFailureCallback(const FOnHttpRequestFailedDelegate& InOnHttpRequestFailed);
+
+	/**
+	 * 상태 코드와 전송 원인에 맞는 커스텀 코드와 메시지를 채우는 함수. 불변 정적 표만 읽으므로 어느 스레드에서든 호출할 수 있다.
+	 * @param InOutError 상태 코드와 전송 원인이 채워진 에러
+	 */
+	static void FillErrorFields(FJWNU_ApiError& InOutError);
+
+	/**
+	 * 동작 설정의 응답 처리 스레드를 게임 스레드로 고정하는 함수. 블루프린트와 UObject 콜백, 서비스 계층 경로가 사용한다.
+	 * @param InOutConfig 고정할 동작 설정
+	 * @param InURL 로그용 요청 URL
+	 */
+	static void PinGameThreadCompletion(FJWNU_RequestConfig& InOutConfig, const FString& InURL);
 	
 	/**
 	 * 기본 HTTP 리퀘스트 설정값을 담은 구조체 필드.
 	 */
 	UPROPERTY(Config)
 	FJWNU_RequestConfig DefaultRequestConfig;
+
+	/**
+	 * 엔드포인트 경로 접두사별 설정 목록. INI에서 +EndpointPolicies=(PathPrefix="/health",Config=(...)) 형식으로 추가한다.
+	 */
+	UPROPERTY(Config)
+	TArray<FJWNU_EndpointPolicy> EndpointPolicies;
+
+	/**
+	 * EndpointPolicies의 경로 접두사로 초기화 시 한 번 구축하는 트라이. (값은 EndpointPolicies의 인덱스)
+	 */
+	FJWNU_EndpointPolicyTrie EndpointPolicyTrie;
 };
@@ -5,8 +5,12 @@
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
 #include "JWNU_HttpRequestJob.h"
+#include "JWNU_RequestHandle.h"
 #include "Engine/Engine.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Containers/Ticker.h"
+#include "Containers/Queue.h"
+#include <atomic>
 #include "JWNU_GIS_HttpRequestJobProcessor.generated.h"
 
 /**
@@ -14,47 +18,270 @@
  */
 JWNETWORKUTILITY_API DECLARE_LOG_CATEGORY_EXTERN(LogJWNU_GIS_HttpRequestJobProcessor, Log, All);
 
+/**
+ * 디스패치를 기다리는 Job 완료 결과 구조체.
+ */
+struct FJWNU_PendingJobCompletion
+{
+	/**
+	 * 완료된 Job.
+	 */
+	TWeakObjectPtr<UJWNU_HttpRequestJob> Job;
+
+	/**
+	 * 네트워크 성공 여부.
+	 */
+	bool bNetworkAvailable = false;
+
+	/**
+	 * 상태 코드.
+	 */
+	int32 StatusCode = 0;
+
+	/**
+	 * 최종 응답 바디. (UTF-8 바이트, 문자열 소비자에게 전달할 때만 변환)
+	 */
+	TArray<uint8> ResponseBytes;
+};
+
+/**
+ * 엔드포인트별 완료 콜백 처리 통계 구조체. URL 대신 엔드포인트 식별자로 집계한다.
+ */
+struct FJWNU_EndpointCompletionStats
+{
+	/**
+	 * 디스패치한 완료 콜백 수.
+	 */
+	int32 CompletionCount = 0;
+
+	/**
+	 * 처리 시간이 임계값을 넘은 완료 콜백 수.
+	 */
+	int32 SlowCompletionCount = 0;
+
+	/**
+	 * 가장 긴 완료 콜백 처리 시간. (밀리초)
+	 */
+	double MaxCompletionMilliseconds = 0.0;
+};
+
+/**
+ * 게임 스레드 밖에서 요청을 제출하기 위한 다중 생산자 단일 소비자 큐.
+ * 어느 스레드에서든 락 없이 적재할 수 있고, 적재된 항목은 다음 코어 티커 틱에 게임 스레드에서 한꺼번에 실행된다.
+ * 큐가 닫힌 뒤에 적재되었거나 닫힐 때 남아 있던 항목은 실행 대신 중단 함수가 호출된다.
+ */
+class JWNETWORKUTILITY_API FJWNU_RequestSubmissionQueue : public TSharedFromThis<FJWNU_RequestSubmissionQueue, ESPMode::ThreadSafe>
+{
+public:
+	using FSubmitFunction = TUniqueFunction<void()>;
+
+	~FJWNU_RequestSubmissionQueue();
+
+	/**
+	 * 항목을 적재하는 함수. 어느 스레드에서든 호출할 수 있다.
+	 * @param InExecute 게임 스레드에서 실행할 함수
+	 * @param InAbort 큐가 닫혀 실행하지 못할 때 대신 호출할 함수 (호출 스레드는 정해져 있지 않다)
+	 */
+	void Submit(FSubmitFunction&& InExecute, FSubmitFunction&& InAbort);
+
+	/**
+	 * 큐를 닫고 남은 항목의 중단 함수를 호출하는 함수. 게임 스레드에서만 호출한다.
+	 */
+	void Close();
+
+	bool IsClosed() const { return bClosed.load(std::memory_order_acquire); }
+
+	/**
+	 * 아직 게임 스레드에서 처리되지 않은 항목 수를 반환한다. (근사값)
+	 */
+	int32 GetPendingCount() const { return PendingCount.load(std::memory_order_relaxed); }
+
+private:
+	struct FSubmission
+	{
+		FSubmitFunction Execute;
+		FSubmitFunction Abort;
+	};
+
+	/**
+	 * 적재된 항목을 모두 꺼내 처리하는 틱 함수. (게임 스레드)
+	 * @param DeltaTime 프레임 시간
+	 * @return 항상 false (다음 적재 때 다시 예약된다)
+	 */
+	bool Drain(float DeltaTime);
+
+	TQueue<FSubmission, EQueueMode::Mpsc> Submissions;
+	std::atomic<int32> PendingCount = 0;
+
+	/**
+	 * 드레인 틱이 이미 예약되어 있는지 여부. 적재가 몰려도 틱은 한 번만 예약한다.
+	 */
+	std::atomic<bool> bDrainScheduled = false;
+	std::atomic<bool> bClosed = false;
+};
+
 /**
  * HTTP 요청 Job을 관리하는 서브시스템.
  * 네트워크 레벨 재시도 (5xx, 타임아웃)를 담당한다.
  * 401 토큰 만료 처리는 상위 레이어인 ApiClientService에서 담당.
+ * 한 프레임에 많은 응답이 몰려도 프레임 시간이 튀지 않도록, Job 완료 콜백을 큐에 모아 프레임당 시간 예산 안에서 디스패치한다.
+ * 워커 스레드의 요청 제출은 제출 큐로 받아 게임 스레드에서 실행한다.
+ * 진행 중인 요청은 요청 핸들 테이블의 슬롯으로 추적한다.
  */
-UCLASS()
+UCLASS(Config=JWNetworkUtility)
 class JWNETWORKUTILITY_API UJWNU_GIS_HttpRequestJobProcessor : public UGameInstanceSubsystem
 {
 	GENERATED_BODY()
 
 public:
+	/**
+	 * Overriding for creating submission queue \n 워커 스레드 제출 큐와 요청 핸들 테이블을 생성하는 로직 오버라이드.
+	 */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/**
+	 * Overriding for dropping queued completions \n 디스패치 틱을 해제하고 남은 완료 큐를 정리하는 로직 오버라이드.
+	 */
+	virtual void Deinitialize() override;
+
+	/**
+	 * 워커 스레드에서 요청을 제출할 때 쓰는 큐를 반환한다. 반환값은 어느 스레드에서든 사용할 수 있다.
+	 * @return 제출 큐
+	 */
+	TSharedRef<FJWNU_RequestSubmissionQueue, ESPMode::ThreadSafe> GetSubmissionQueue() const { return SubmissionQueue.ToSharedRef(); }
+
+	/**
+	 * 진행 중인 요청의 슬롯 테이블을 반환한다. (게임 스레드 전용)
+	 * @return 요청 핸들 테이블
+	 */
+	TSharedRef<FJWNU_RequestHandleTable, ESPMode::ThreadSafe> GetRequestTable() const { return RequestTable.ToSharedRef(); }
 	
 	/**
 	 * HTTP 요청 Job을 생성하고 실행하는 함수.
-	 * @param InMethod HTTP 메서드
-	 * @param InURL 요청 URL
+	 * @param InRequest 요청 기술자 (URL, 바디, 동작 설정)
 	 * @param InAuthToken JWT 인증 토큰
-	 * @param InContentBody JSON 바디
-	 * @param InQueryParams URL 쿼리 패러미터
-	 * @param InConfig 요청 설정 (재시도, 타임아웃 등)
 	 * @param InOnHttpRequestJobCompleted 완료 콜백
 	 * @param InOnHttpRequestJobRetry 재시도 콜백
+	 * @param InOnHttpResponseStream 리스폰스 바디 스트림 콜백 (바인딩 시 바디를 모으지 않고 도착하는 대로 전달)
+	 * @param InOnHttpRequestJobFailed 실패 콜백 (바인딩 시 실패 결과는 완료 콜백 대신 구조화된 에러로 전달)
+	 * @param InOnHttpRequestJobCompletedUtf8 UTF-8 완료 콜백 (바인딩 시 바디를 문자열로 변환하지 않고 완료 콜백 대신 호출)
 	 */
 	UJWNU_HttpRequestJob* ProcessHttpRequestJob(
-		const EJWNU_HttpMethod InMethod,
-		const FString& InURL,
+		const FJWNU_RequestDescriptorRef& InRequest,
 		const FString& InAuthToken,
-		const FString& InContentBody,
-		const TMap<FString, FString>& InQueryParams,
-		const FJWNU_RequestConfig& InConfig,
 		const FOnHttpRequestJobCompletedDelegate& InOnHttpRequestJobCompleted,
-		const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry = FOnHttpRequestJobRetryDelegate());
+		const FOnHttpRequestJobRetryDelegate& InOnHttpRequestJobRetry = FOnHttpRequestJobRetryDelegate(),
+		const FOnHttpResponseStreamDelegate& InOnHttpResponseStream = FOnHttpResponseStreamDelegate(),
+		const FOnHttpRequestJobFailedDelegate& InOnHttpRequestJobFailed = FOnHttpRequestJobFailedDelegate(),
+		const FOnHttpRequestJobCompletedUtf8Delegate& InOnHttpRequestJobCompletedUtf8 = FOnHttpRequestJobCompletedUtf8Delegate());
+
+	/**
+	 * 완료된 Job의 결과를 디스패치 큐에 적재하는 함수. 프레임 예산이 0 이하라면 즉시 디스패치한다.
+	 * @param InJob 완료된 Job
+	 * @param bNetworkAvailable 네트워크 성공 여부
+	 * @param StatusCode 상태 코드
+	 * @param ResponseBytes 최종 응답 바디 (UTF-8 바이트, 큐로 이동된다)
+	 */
+	void EnqueueCompletion(UJWNU_HttpRequestJob* InJob, const bool bNetworkAvailable, const int32 StatusCode, TArray<uint8>&& ResponseBytes);
+
+	/**
+	 * Job이 끝나거나 취소됐을 때 유지하던 참조를 놓는 함수. 어느 스레드에서든 호출할 수 있다.
+	 * @param InJob 끝난 Job
+	 */
+	void ReleaseJob(UJWNU_HttpRequestJob* InJob);
+
+	/**
+	 * 처리 시간이 임계값을 넘은 완료 콜백의 누적 횟수를 반환한다.
+	 * @return 느린 콜백 횟수
+	 */
+	int32 GetSlowCompletionCount() const { return SlowCompletionCount; }
+
+	/**
+	 * 지금까지 관측된 가장 긴 완료 콜백 처리 시간을 반환한다.
+	 * @return 처리 시간 (밀리초)
+	 */
+	double GetMaxCompletionMilliseconds() const { return MaxCompletionMilliseconds; }
+
+	/**
+	 * 엔드포인트 하나의 완료 콜백 처리 통계를 반환한다.
+	 * @param InEndpointId 엔드포인트 식별자 (예: TJWNU_EndpointTraits<FJWNU_EP_AuthRefresh>::Id)
+	 * @return 통계 (해당 엔드포인트의 완료가 아직 없다면 nullptr)
+	 */
+	const FJWNU_EndpointCompletionStats* FindEndpointCompletionStats(const uint64 InEndpointId) const { return EndpointCompletionStats.Find(InEndpointId); }
 
 private:
-	
+
 	/**
-	 * 기본 URL에 쿼리 패리미터를 조합해서 최종 URL을 구축하는 함수.
-	 * @param BaseURL 리퀘스트를 보낼 기본 URL
-	 * @param QueryParams URL 쿼리 패러미터
-	 * @return 쿼리 패러미터까지 조합된 최종 URL.
+	 * 프레임마다 완료 큐를 예산 안에서 디스패치하는 틱 함수. 큐가 비면 틱을 해제한다.
+	 * @param DeltaTime 프레임 시간
+	 * @return 틱 유지 여부
 	 */
-	static FString BuildURL(const FString& BaseURL, const TMap<FString, FString>& QueryParams);
-	
+	bool TickCompletionQueue(float DeltaTime);
+
+	/**
+	 * 완료 결과 하나를 Job에 전달하고 처리 시간을 기록하는 함수.
+	 * @param InCompletion 완료 결과
+	 */
+	void DispatchCompletion(FJWNU_PendingJobCompletion& InCompletion);
+
+	/**
+	 * 프레임당 일반 우선순위 완료 콜백에 허용하는 시간 예산. (밀리초, 0 이하면 큐를 쓰지 않고 즉시 디스패치)
+	 * 예산을 넘더라도 프레임당 최소 1개는 디스패치하며, 남은 콜백은 다음 프레임으로 이월된다.
+	 */
+	UPROPERTY(Config)
+	float CompletionBudgetMilliseconds = 2.0f;
+
+	/**
+	 * 이 시간을 넘긴 완료 콜백을 경고 로그로 기록한다. (밀리초)
+	 */
+	UPROPERTY(Config)
+	float SlowCompletionThresholdMilliseconds = 4.0f;
+
+	/**
+	 * 프레임 예산과 무관하게 먼저 디스패치하는 Critical 우선순위 완료 큐.
+	 */
+	TArray<FJWNU_PendingJobCompletion> CriticalCompletionQueue;
+
+	/**
+	 * 프레임 예산 안에서 디스패치하는 일반 우선순위 완료 큐.
+	 */
+	TArray<FJWNU_PendingJobCompletion> NormalCompletionQueue;
+
+	/**
+	 * 완료 큐 디스패치 틱 핸들.
+	 */
+	FTSTicker::FDelegateHandle CompletionTickerHandle;
+
+	/**
+	 * 느린 완료 콜백 누적 횟수.
+	 */
+	int32 SlowCompletionCount = 0;
+
+	/**
+	 * 가장 긴 완료 콜백 처리 시간. (밀리초)
+	 */
+	double MaxCompletionMilliseconds = 0.0;
+
+	/**
+	 * 엔드포인트 선언으로 보낸 요청의 엔드포인트별 완료 콜백 통계.
+	 */
+	TMap<uint64, FJWNU_EndpointCompletionStats> EndpointCompletionStats;
+
+	/**
+	 * 워커 스레드 요청 제출 큐.
+	 */
+	TSharedPtr<FJWNU_RequestSubmissionQueue, ESPMode::ThreadSafe> SubmissionQueue;
+
+	/**
+	 * 진행 중인 요청의 슬롯 테이블.
+	 */
+	TSharedPtr<FJWNU_RequestHandleTable, ESPMode::ThreadSafe> RequestTable;
+
+	/**
+	 * 진행 중인 Job. HTTP 델리게이트, 타이머, 완료 큐, 요청 핸들은 모두 약한 참조이므로, 결과를 디스패치하거나 취소될 때까지 GC되지 않도록 유지한다.
+	 * 게임 스레드 밖 Job은 마지막 응답 콜백이 끝난 뒤에 놓는다. (게임 스레드에서만 수정)
+	 */
+	UPROPERTY()
+	TSet<TObjectPtr<UJWNU_HttpRequestJob>> InFlightJobs;
+
 };
@@ -5,8 +5,11 @@
 #include "CoreMinimal.h"
 #include "JWNetworkUtilityTypes.h"
 #include "JWNetworkUtilityDelegates.h"
+#include "JWNU_RequestDescriptor.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Engine/EngineTypes.h"
+#include "Containers/Ticker.h"
+#include <atomic>
 #include "JWNU_HttpRequestJob.generated.h"
 
 /** 
@@ -16,6 +19,8 @@ JWNETWORKUTILITY_API DECLARE_LOG_CATEGORY_EXTERN(LogJWNU_HttpRequestJob, Log, Al
 
 /**
  * 하나의 HTTP 요청을 Job 단위로 관리하는 클래스. 타임아웃, 재시도, 취소 등의 기능을 제공한다.
+ * 동작 설정의 응답 처리 스레드가 게임 스레드가 아니라면 응답 처리와 완료 콜백을 그 스레드에서 실행하며,
+ * 이때 타임아웃은 월드 타이머 대신 HTTP 모듈의 요청 타임아웃을, 재시도 딜레이는 코어 티커를 사용한다. (전송과 취소는 항상 게임 스레드)
  */
 UCLASS()
 class JWNETWORKUTILITY_API UJWNU_HttpRequestJob : public UObject
@@ -32,7 +37,7 @@ public:
 	FJWNU_RequestConfig Config;
 
 	/**
-	 * (시도 횟수)를 외부에 전달해주기 위한 델리게이트 필드.
+	 * (시도 횟수)를 외부에 전달해주기 위한 델리게이트 필드. 응답 처리 스레드에서 호출된다.
 	 */
 	FOnHttpRequestJobRetryDelegate OnHttpRequestJobRetry;
 	
@@ -41,20 +46,33 @@ public:
 	 */
 	FOnHttpRequestJobCompletedDelegate OnHttpRequestJobComplete;
 
+	/**
+	 * (상태 코드, 네트워크 상태, UTF-8 리스폰스 바이트)를 외부에 전달해주기 위한 델리게이트 필드.
+	 * 바인딩되어 있으면 바디를 FString으로 변환하지 않고, 완료 델리게이트 대신 이 델리게이트를 호출한다.
+	 */
+	FOnHttpRequestJobCompletedUtf8Delegate OnHttpRequestJobCompleteUtf8;
+
+	/**
+	 * 실패한 최종 결과를 (상태 코드, 시도 횟수, 전송 원인)이 채워진 에러로 외부에 전달해주기 위한 델리게이트 필드.
+	 * 바인딩되어 있으면 실패 시 리스폰스 바디를 읽지 않고, 완료 델리게이트 대신 이 델리게이트를 호출한다.
+	 */
+	FOnHttpRequestJobFailedDelegate OnHttpRequestJobFailed;
+
+	/**
+	 * 리스폰스 바디를 도착하는 대로 전달받는 델리게이트 필드. 바인딩되어 있으면 바디를 메모리에 모으지 않으므로 완료 델리게이트의 리스폰스 바디는 비어 있다, 이미 넘긴 바디는 되돌릴 수 없으므로 재시도하지 않는다.
+	 */
+	FOnHttpResponseStreamDelegate OnHttpResponseStream;
+
 #pragma endregion
 
 #pragma region Interface Methods for Initialize, Execute, Cancel Job Requests
 	
 	/**
-	 * Job을 초기화하는 함수.
-	 * @param InMethod HTTP 메서드
-	 * @param InURL 요청 URL
+	 * Job을 초기화하는 함수. 기술자는 복사하지 않고 참조만 보관하므로, 재시도마다 URL과 바디를 다시 만들지 않는다.
+	 * @param InRequest 요청 기술자 (동작 설정은 Config 필드로 복사되어 이후 개별 조정 가능)
 	 * @param InAuthToken JWT 인증 토큰 (없으면 빈 문자열)
-	 * @param InContentBody JSON 바디 (GET/DELETE는 빈 문자열)
-	 * @param InConfig Job 설정
 	 */
-	UFUNCTION(Category="Job")
-	void Initialize(EJWNU_HttpMethod InMethod, const FString& InURL, const FString& InAuthToken, const FString& InContentBody, const FJWNU_RequestConfig& InConfig);
+	void Initialize(const FJWNU_RequestDescriptorRef& InRequest, const FString& InAuthToken);
 
 	/**
 	 * Job을 실행하는 함수.
@@ -73,14 +91,47 @@ public:
 	 * @return 실행 중이면 true
 	 */
 	UFUNCTION(Category="Job|State")
-	FORCEINLINE bool IsRunning() const { return bIsRunning; }
+	FORCEINLINE bool IsRunning() const { return bIsRunning.load(std::memory_order_acquire); }
 
 	/**
 	 * Job이 취소됐는지 반환하는 함수.
 	 * @return 취소됐다면 true
 	 */
 	UFUNCTION(Category="Job|State")
-	FORCEINLINE bool IsCancelled() const {return bIsCancelled; }
+	FORCEINLINE bool IsCancelled() const {return bIsCancelled.load(std::memory_order_acquire); }
+
+	/**
+	 * 지금까지 시도한 횟수를 반환하는 함수.
+	 * @return 시도 횟수
+	 */
+	FORCEINLINE int32 GetAttemptCount() const { return CurrentAttempt; }
+
+	/**
+	 * 요청 URL을 반환하는 함수. (로그용)
+	 * @return 쿼리 패러미터까지 조합된 요청 URL
+	 */
+	FORCEINLINE const FString& GetURL() const { return Request->GetURL(); }
+
+	/**
+	 * 엔드포인트 식별자를 반환하는 함수. (엔드포인트 선언 없이 보낸 요청이라면 0)
+	 * @return 엔드포인트 식별자
+	 */
+	FORCEINLINE uint64 GetEndpointId() const { return Request->GetEndpointId(); }
+
+	/**
+	 * 응답 처리와 완료 콜백을 게임 스레드 밖에서 실행하는 Job인지 반환하는 함수.
+	 * @return 게임 스레드 밖이라면 true
+	 */
+	FORCEINLINE bool IsOffGameThread() const { return Config.CompletionThread != EJWNU_CompletionThread::GameThread; }
+
+	/**
+	 * 최종 결과를 완료 델리게이트로 전달하는 함수. JobProcessor가 완료 큐에서 꺼낼 때 호출한다.
+	 * 디스패치 대기 중에 취소됐다면 아무것도 전달하지 않는다.
+	 * @param bNetworkAvailable 네트워크 성공 여부
+	 * @param StatusCode 상태 코드
+	 * @param ResponseBytes 최종 응답 바디 (UTF-8 바이트, UTF-8 완료 델리게이트로 이동된다)
+	 */
+	void DispatchCompletion(const bool bNetworkAvailable, const int32 StatusCode, TArray<uint8>&& ResponseBytes);
 	
 #pragma endregion
 
@@ -88,25 +139,15 @@ private:
 	
 #pragma region Request Info Fields for Retry
 	
-	/** 
-	 * HTTP 메서드 
-	 */
-	EJWNU_HttpMethod Method;
-
-	/** 
-	 * 요청 URL 
-	 */
-	FString URL;
-
-	/** 
-	 * JWT 인증 토큰 
+	/**
+	 * 요청 기술자. 서비스 계층과 공유하는 불변 인스턴스.
 	 */
-	FString AuthToken;
+	TSharedPtr<const FJWNU_RequestDescriptor, ESPMode::ThreadSafe> Request;
 
 	/** 
-	 * JSON 바디 
+	 * "Bearer <토큰>" 형태로 미리 조합한 Authorization 헤더 값 (토큰이 없으면 빈 문자열)
 	 */
-	FString JsonBody;
+	FString AuthorizationHeader;
 	
 #pragma endregion
 
@@ -117,15 +158,30 @@ private:
 	 */
 	int32 CurrentAttempt = 0;
 
+	/**
+	 * 마지막 시도의 전송 계층 결과를 나타내는 필드.
+	 */
+	EJWNU_TransportReason TransportReason = EJWNU_TransportReason::None;
+
 	/** 
 	 * Job 실행 중 여부를 나타내는 필드.
 	 */
-	bool bIsRunning = false;
+	std::atomic<bool> bIsRunning = false;
 
 	/**
 	 * Job 취소 여부를 나타내는 필드.
 	 */
-	bool bIsCancelled = false;
+	std::atomic<bool> bIsCancelled = false;
+
+	/**
+	 * 게임 스레드 밖 응답 처리와 게임 스레드 취소가 겹칠 때, 취소 확인과 상태 전이, CurrentRequest 교체를 묶는 잠금.
+	 */
+	FCriticalSection StateLock;
+
+	/**
+	 * 최종 결과가 JobProcessor의 완료 큐에서 디스패치를 기다리는 중인지 나타내는 필드.
+	 */
+	bool bIsCompletionQueued = false;
 	
 	/** 
 	 * 현재 진행 중인 HTTP 요청, 중도 취소를 위한 포인터.
@@ -141,6 +197,11 @@ private:
 	 * 타임아웃 타이머 핸들 필드.
 	 */
 	FTimerHandle TimeoutTimerHandle;
+
+	/**
+	 * 게임 스레드 밖 Job의 재시도 딜레이 티커 핸들 필드.
+	 */
+	FTSTicker::FDelegateHandle RetryTickerHandle;
 	
 #pragma endregion 
 	
@@ -152,9 +213,9 @@ private:
 	void SendRequest();
 
 	/**
-	 * HTTP 응답 수신 시 호출되는 콜백 함수.
+	 * HTTP 응답 수신 시 호출되는 콜백 함수. 응답 처리 스레드 정책에 따라 게임 스레드, HTTP 스레드, 태스크 그래프 워커 중 하나에서 호출된다.
 	 */
-	void OnResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bNetworkAvailable);
+	void OnResponseReceived(FHttpRequestPtr InHttpRequest, FHttpResponsePtr Response, bool bNetworkAvailable);
 
 	/**
 	 * 타임아웃 발생 시 호출되는 함수.
@@ -167,12 +228,12 @@ private:
 	void ScheduleRetry();
 
 	/**
-	 * Job을 완료 처리하는 함수. 델리게이트를 호출하여 최종 결과를 외부에 전달하는 역할을 맡는다.
+	 * Job을 완료 처리하는 함수. 최종 결과를 JobProcessor의 완료 큐로 넘겨, 프레임 예산 안에서 델리게이트가 호출되도록 한다.
 	 * @param StatusCode 상태 코드
 	 * @param bNetworkAvailable 네트워크 성공 여부
-	 * @param ResponseBody 최종 응답 바디
+	 * @param ResponseBytes 최종 응답 바디 (UTF-8 바이트, 완료 큐로 이동된다)
 	 */
-	void CompleteJob(const bool bNetworkAvailable, const int32 StatusCode, const FString& ResponseBody);
+	void CompleteJob(const bool bNetworkAvailable, const int32 StatusCode, TArray<uint8>&& ResponseBytes);
 
 	/**
 	 * 재시도 필요 여부를 판단하는 함수. 네트워크 실패와 서비스 실패 시 재시도 결정을 내린다.
@@ -182,10 +243,29 @@ private:
 	 */
 	bool ShouldRetry(const int32 StatusCode, const bool bNetworkAvailable) const;
 
+	/**
+	 * 최종 결과가 실패 델리게이트로 전달될지 판단하는 함수.
+	 * @param StatusCode HTTP 상태 코드
+	 * @param bNetworkAvailable 네트워크 성공 여부
+	 * @return 실패 델리게이트가 바인딩되어 있고 결과가 네트워크 실패 또는 2XX가 아니라면 true
+	 */
+	bool IsRoutedToFailure(const int32 StatusCode, const bool bNetworkAvailable) const;
+
 	/**
 	 * 타임아웃, 재시도 타이머를 정리하는 함수. 최종 성공, 실패, 취소 시 호출한다.
 	 */
 	void ClearAllTimers();
+
+	/**
+	 * Job이 끝나거나 취소됐을 때 JobProcessor가 쥐고 있던 참조를 놓게 하는 함수.
+	 * 게임 스레드 밖 Job은 다른 스레드의 응답 콜백이 Job 포인터를 그대로 쓰므로, 더 올 콜백이 없을 때만 호출한다.
+	 */
+	void ReleaseFromProcessor();
+
+	/**
+	 * 취소된 게임 스레드 밖 Job의 응답 콜백이 취소를 확인한 뒤, 미뤄 둔 참조 해제를 마무리하는 함수.
+	 */
+	void ReleaseIfCancelledOffGameThread();
 	
 #pragma endregion
 
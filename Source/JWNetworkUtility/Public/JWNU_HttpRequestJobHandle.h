@@ -3,12 +3,12 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "JWNU_HttpRequestJob.h"
+#include "JWNU_RequestHandle.h"
 #include "Engine/Engine.h"
 #include "JWNU_HttpRequestJobHandle.generated.h"
 
 /**
- * HTTP 요청의 논리적 수명을 추적하는 핸들 클래스.
+ * 블루프린트에서 요청을 제어하기 위한 핸들 클래스. 네이티브 요청 핸들(FJWNU_RequestHandle)을 감싼 얇은 래퍼다.
  * 401 토큰 리프레시 시 내부 Job이 교체되더라도 동일한 Handle을 통해 요청을 제어할 수 있다.
  */
 UCLASS(BlueprintType)
@@ -18,6 +18,13 @@ class JWNETWORKUTILITY_API UJWNU_HttpRequestJobHandle : public UObject
 
 public:
 
+	/**
+	 * 네이티브 요청 핸들을 감싸는 함수.
+	 * @param InHandle 네이티브 요청 핸들
+	 * @return 블루프린트 핸들 (보내기 전에 실패해 빈 핸들이라면 nullptr)
+	 */
+	static UJWNU_HttpRequestJobHandle* Wrap(const FJWNU_RequestHandle& InHandle);
+
 	/**
 	 * 진행 중인 요청을 취소하는 함수.
 	 */
@@ -26,7 +33,7 @@ public:
 
 	/**
 	 * 요청이 현재 실행 중인지 반환하는 함수.
-	 * Job이 실행 중이거나 401 리프레시 대기 중이면 true를 반환한다.
+	 * 결과 콜백이 호출되기 전까지, 401 리프레시 대기 중에도 true를 반환한다.
 	 * @return 실행 중이면 true
 	 */
 	UFUNCTION(BlueprintPure, Category="JWNU|Job Control")
@@ -40,36 +47,14 @@ public:
 	bool IsCancelled() const;
 
 	/**
-	 * 새 Job을 바인딩하는 내부 함수. 초기 생성 또는 401 리프레시 후 새 Job 바인딩에 사용한다.
-	 * @param InJob 바인딩할 Job
-	 */
-	void BindJob(UJWNU_HttpRequestJob* InJob);
-
-	/**
-	 * 401 리프레시 대기 상태로 전환하는 내부 함수. IsRunning()이 true를 유지하도록 한다.
+	 * 감싸고 있는 네이티브 요청 핸들을 반환한다.
 	 */
-	void MarkWaitingForRefresh();
-
-	/**
-	 * 401 리프레시 대기 상태를 해제하는 내부 함수.
-	 */
-	void ClearWaitingForRefresh();
+	const FJWNU_RequestHandle& GetNativeHandle() const { return NativeHandle; }
 
 private:
 
 	/**
-	 * 현재 바인딩된 HTTP 요청 Job.
-	 */
-	UPROPERTY()
-	TObjectPtr<UJWNU_HttpRequestJob> CurrentJob;
-
-	/**
-	 * 취소 여부를 나타내는 플래그.
-	 */
-	bool bIsCancelled = false;
-
-	/**
-	 * 401 리프레시 대기 중 여부를 나타내는 플래그. IsRunning()이 true를 유지하도록 한다.
+	 * 네이티브 요청 핸들.
 	 */
-	bool bIsWaitingForRefresh = false;
+	FJWNU_RequestHandle NativeHandle;
 };
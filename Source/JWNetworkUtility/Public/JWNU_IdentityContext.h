@@ -0,0 +1,163 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "JWNetworkUtilityTypes.h"
+#include "JWNU_RequestHandle.h"
+
+class UJWNU_GIS_ApiIdentityProvider;
+class FJWNU_RequestDescriptor;
+
+/**
+ * 클래스 전용 로그 카테고리 선언
+ */
+JWNETWORKUTILITY_API DECLARE_LOG_CATEGORY_EXTERN(LogJWNU_IdentityContext, Log, All);
+
+/**
+ * 토큰 리프레시 대기열에 적재되는 잡 구조체.
+ * 리프레시 완료 시 OnTokenReady, 실패 시 OnTokenFailed가 호출된다.
+ */
+struct JWNETWORKUTILITY_API FJWNU_PendingJob
+{
+	/**
+	 * 토큰 리프레시 후 다시 보낼 요청 기술자. 재전송 시 문자열을 복사하지 않고 참조만 넘긴다.
+	 */
+	TSharedPtr<const FJWNU_RequestDescriptor, ESPMode::ThreadSafe> Request;
+
+	/**
+	 * 대기 중인 요청의 핸들. 리프레시가 끝나기 전에 취소되면 대기열에서 빠진다. (요청 핸들이 없는 내부 잡은 빈 핸들)
+	 */
+	FJWNU_RequestHandle Handle;
+
+	TFunction<void(const FString& /*NewAccessToken*/)> OnTokenReady;
+	TFunction<void(const FJWNU_ApiError& /*Error*/)> OnTokenFailed;
+};
+
+/**
+ * 한 명의 사용자를 나타내는 인증 컨텍스트. 서비스 타입별 엑세스 토큰, 리프레시 토큰, UserId와 토큰 리프레시 상태를 묶는다.
+ * API 호출과 401 리프레시 대기열이 컨텍스트 단위로 분리되므로, 하나의 프로세스에서 여러 사용자를 동시에 구동할 수 있다. (부하 테스트용 가상 플레이어 등)
+ * 기본 컨텍스트는 UJWNU_GIS_ApiIdentityProvider가 소유하며 리프레시 토큰을 키스토어에 영속화하고, 직접 생성한 컨텍스트는 메모리 전용이다.
+ * 게임 스레드 전용.
+ */
+class JWNETWORKUTILITY_API FJWNU_IdentityContext
+{
+public:
+	/**
+	 * 메모리 전용 인증 컨텍스트를 생성하는 함수.
+	 * @param InContextName 로그 식별용 컨텍스트 이름
+	 * @return 인증 컨텍스트
+	 */
+	static TSharedRef<FJWNU_IdentityContext, ESPMode::ThreadSafe> Create(const FString& InContextName);
+
+	/**
+	 * 컨텍스트 이름으로 생성하는 생성자. 모든 서비스 타입의 엑세스 토큰 컨테이너를 기본값으로 채운다.
+	 * @param InContextName 로그 식별용 컨텍스트 이름
+	 */
+	explicit FJWNU_IdentityContext(const FString& InContextName);
+
+	/**
+	 * 로그 식별용 컨텍스트 이름을 반환한다.
+	 * @return 컨텍스트 이름
+	 */
+	const FString& GetContextName() const;
+
+	/**
+	 * 리프레시 토큰을 키스토어에 영속화하는 컨텍스트인지 여부를 반환한다.
+	 * @return 영속화 여부
+	 */
+	bool IsPersistent() const;
+
+	/**
+	 * 특정 서비스 타입의 엑세스 토큰 컨테이너를 획득한다.
+	 * @param InServiceType 특정 서비스 타입
+	 * @param OutAccessTokenContainer 엑세스 토큰 컨테이너
+	 * @return 성공 여부
+	 */
+	bool GetAccessTokenContainer(const EJWNU_ServiceType InServiceType, FJWNU_AccessTokenContainer& OutAccessTokenContainer) const;
+
+	/**
+	 * 특정 서비스 타입의 엑세스 토큰 컨테이너를 설정한다.
+	 * @param InServiceType 특정 서비스 타입
+	 * @param InAccessTokenContainer 새 엑세스 토큰 컨테이너
+	 */
+	void SetAccessTokenContainer(const EJWNU_ServiceType InServiceType, const FJWNU_AccessTokenContainer& InAccessTokenContainer);
+
+	/**
+	 * 특정 서비스 타입의 리프레시 토큰 컨테이너를 획득한다. 영속 컨텍스트라면 키스토어 메모리 사본에서 조회한다.
+	 * @param InServiceType 특정 서비스 타입
+	 * @param OutRefreshTokenContainer 리프레시 토큰 컨테이너
+	 * @return 성공 여부
+	 */
+	bool GetRefreshTokenContainer(const EJWNU_ServiceType InServiceType, FJWNU_RefreshTokenContainer& OutRefreshTokenContainer) const;
+
+	/**
+	 * 특정 서비스 타입의 리프레시 토큰 컨테이너를 설정한다. 영속 컨텍스트라면 키스토어 저장도 예약된다.
+	 * @param InServiceType 특정 서비스 타입
+	 * @param InRefreshTokenContainer 새 리프레시 토큰 컨테이너
+	 */
+	void SetRefreshTokenContainer(const EJWNU_ServiceType InServiceType, const FJWNU_RefreshTokenContainer& InRefreshTokenContainer);
+
+	/**
+	 * 현재 로그인된 사용자 ID를 반환한다.
+	 * @return UserId 문자열
+	 */
+	const FString& GetUserId() const;
+
+	/**
+	 * 사용자 ID를 설정한다.
+	 * @param InUserId 설정할 UserId
+	 */
+	void SetUserId(const FString& InUserId);
+
+	/**
+	 * 특정 서비스 타입의 엑세스 토큰을 정리한다. (리프레시 토큰과 UserId 유지)
+	 * @param InServiceType 정리할 서비스 타입
+	 */
+	void ClearSession(const EJWNU_ServiceType InServiceType);
+
+private:
+	friend class UJWNU_GIS_ApiIdentityProvider;
+	friend class UJWNU_GIS_ApiClientService;
+
+	/**
+	 * 리프레시 토큰 영속화를 담당할 IdentityProvider를 연결한다. (기본 컨텍스트 전용)
+	 * @param InPersistentStore 키스토어를 소유한 IdentityProvider
+	 */
+	void BindPersistentStore(UJWNU_GIS_ApiIdentityProvider* InPersistentStore);
+
+	/**
+	 * 로그 식별용 컨텍스트 이름.
+	 */
+	FString ContextName;
+
+	/**
+	 * 현재 로그인된 사용자 ID. (메모리 전용)
+	 */
+	FString UserId;
+
+	/**
+	 * 서비스 타입별 엑세스 토큰 컨테이너 맵.
+	 */
+	TMap<EJWNU_ServiceType, FJWNU_AccessTokenContainer> AccessTokenContainers;
+
+	/**
+	 * 서비스 타입별 리프레시 토큰 컨테이너 맵. (영속 컨텍스트에서는 사용하지 않음)
+	 */
+	TMap<EJWNU_ServiceType, FJWNU_RefreshTokenContainer> RefreshTokenContainers;
+
+	/**
+	 * 리프레시 토큰을 영속화하는 IdentityProvider. (기본 컨텍스트 전용)
+	 */
+	TWeakObjectPtr<UJWNU_GIS_ApiIdentityProvider> PersistentStore;
+
+	/**
+	 * 서비스 타입별 토큰 리프레시 진행 중 여부를 나타내는 플래그 맵.
+	 */
+	TMap<EJWNU_ServiceType, bool> RefreshInProgressFlags;
+
+	/**
+	 * 서비스 타입별 토큰 리프레시 대기열 맵. 리프레시 완료 시 일괄 처리된다.
+	 */
+	TMap<EJWNU_ServiceType, TArray<FJWNU_PendingJob>> PendingJobQueues;
+};
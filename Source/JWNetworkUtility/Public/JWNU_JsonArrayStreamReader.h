@@ -0,0 +1,172 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 클래스 전용 로그 카테고리 선언
+ */
+JWNETWORKUTILITY_API DECLARE_LOG_CATEGORY_EXTERN(LogJWNU_JsonArrayStreamReader, Log, All);
+
+/**
+ * 도착하는 UTF-8 바이트 조각을 순서대로 받아, 큰 JSON 배열의 원소를 하나씩 잘라내는 증분 토크나이저.
+ * 루트 배열(ArrayFieldName이 비어 있음) 또는 루트 오브젝트의 특정 키 아래 배열을 대상으로 하며,
+ * 원소 하나가 닫히는 즉시 해당 원소의 UTF-8 범위를 콜백으로 넘긴다. 버퍼에는 진행 중인 원소 하나만 유지한다.
+ * 배열을 제외한 나머지 바이트(success, code, message 등)는 배열을 "[]"로 비운 봉투 JSON으로 모아 두므로, 완료 후 공통 응답 구조체로 파싱할 수 있다.
+ * 스레드 안전하지 않다. 한 번에 하나의 스레드(HTTP 스트림 스레드)에서만 Feed해야 한다.
+ */
+class JWNETWORKUTILITY_API FJWNU_JsonArrayStreamReader
+{
+public:
+	/**
+	 * 원소 하나의 UTF-8 범위를 받는 콜백. false를 반환하면 스트림을 실패 처리하고 이후 바이트를 무시한다.
+	 */
+	using FOnElement = TFunction<bool(const UTF8CHAR* /*InData*/, const int32 /*InNum*/)>;
+
+	/**
+	 * @param InArrayFieldName 원소를 스트리밍할 루트 오브젝트의 키 (빈 문자열이면 루트 배열)
+	 * @param InOnElement 원소 콜백
+	 */
+	FJWNU_JsonArrayStreamReader(const FString& InArrayFieldName, FOnElement&& InOnElement);
+
+	/**
+	 * 새로 도착한 바이트 조각을 처리하는 함수.
+	 * @param InData 바이트 조각
+	 * @param InNum 바이트 수
+	 * @return 스트림이 아직 유효하면 true
+	 */
+	bool Feed(const uint8* InData, const int64 InNum);
+
+	/**
+	 * 모든 바이트를 받은 뒤 호출해 스트림이 올바르게 끝났는지 확인하는 함수.
+	 * @return 실패 없이 루트 값이 닫혔다면 true
+	 */
+	bool Finish();
+
+	/**
+	 * 배열 원소를 제외하고 모아 둔 봉투 JSON 바이트를 반환한다. 루트 배열 모드에서는 "[]"만 남는다.
+	 */
+	const TArray<uint8>& GetEnvelope() const { return Envelope; }
+
+	/**
+	 * 지금까지 콜백으로 넘긴 원소 수를 반환한다.
+	 */
+	int32 GetElementCount() const { return ElementCount; }
+
+	/**
+	 * 대상 배열을 찾았는지 여부를 반환한다. (에러 응답처럼 배열이 없는 바디라면 false)
+	 */
+	bool HasFoundArray() const { return bFoundArray; }
+
+	/**
+	 * 실패 여부를 반환한다.
+	 */
+	bool HasFailed() const { return State == EState::Failed; }
+
+	/**
+	 * 실패 사유를 반환한다.
+	 */
+	const FString& GetErrorMessage() const { return ErrorMessage; }
+
+private:
+	enum class EState : uint8
+	{
+		Envelope,
+		BetweenElements,
+		InElement,
+		Failed
+	};
+
+	/**
+	 * 봉투 영역의 바이트 하나를 처리한다.
+	 */
+	void ConsumeEnvelopeByte(const uint8 InByte);
+
+	/**
+	 * 배열 안, 원소 사이 영역의 바이트 하나를 처리한다.
+	 */
+	void ConsumeBetweenElementsByte(const uint8 InByte);
+
+	/**
+	 * 원소 내부의 바이트 하나를 처리한다.
+	 */
+	void ConsumeElementByte(const uint8 InByte);
+
+	/**
+	 * 완성된 원소를 콜백으로 넘긴다.
+	 */
+	void EmitElement();
+
+	/**
+	 * 실패 상태로 전환한다.
+	 */
+	void Fail(const FString& InMessage);
+
+	static bool IsWhitespace(const uint8 InByte)
+	{
+		return InByte == ' ' || InByte == '\t' || InByte == '\n' || InByte == '\r';
+	}
+
+	/**
+	 * 대상 키의 UTF-8 바이트. (비어 있으면 루트 배열 모드)
+	 */
+	TArray<uint8> ArrayFieldName;
+
+	/**
+	 * 원소 콜백.
+	 */
+	FOnElement OnElement;
+
+	/**
+	 * 봉투 JSON 바이트.
+	 */
+	TArray<uint8> Envelope;
+
+	/**
+	 * 진행 중인 원소 바이트. 원소를 넘길 때마다 재사용한다.
+	 */
+	TArray<uint8> ElementBuffer;
+
+	/**
+	 * 봉투 영역에서 마지막으로 읽은 루트 오브젝트 키.
+	 */
+	TArray<uint8> KeyBuffer;
+
+	FString ErrorMessage;
+
+	EState State = EState::Envelope;
+
+	/**
+	 * 봉투 영역의 중첩 깊이.
+	 */
+	int32 Depth = 0;
+
+	/**
+	 * 원소 내부의 중첩 깊이. (0이면 원시 값 원소)
+	 */
+	int32 ElementDepth = 0;
+
+	int32 ElementCount = 0;
+
+	bool bInString = false;
+	bool bEscape = false;
+
+	/**
+	 * 루트 오브젝트에서 키 문자열을 기다리는 중인지 여부.
+	 */
+	bool bExpectKey = false;
+
+	/**
+	 * 현재 문자열이 루트 오브젝트 키인지 여부.
+	 */
+	bool bCapturingKey = false;
+
+	/**
+	 * 다음 값이 대상 배열이어야 하는지 여부.
+	 */
+	bool bAwaitArrayValue = false;
+
+	bool bFoundArray = false;
+	bool bSawRootValue = false;
+};
@@ -0,0 +1,59 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * JSON 리더가 큰 바디를 훑을 때 쓰는 SIMD 스캔 커널 모음.
+ * 문자열 내부의 특수 문자('"', '\\', 제어 문자) 탐색, 공백 구간 건너뛰기, UTF-8 유효성 검사를 레지스터 폭 단위로 처리한다.
+ * x86은 SSE2(AVX2로 빌드된 경우 UTF-8 커널은 AVX2), ARM64는 NEON을 사용하며 그 외 플랫폼과 남은 꼬리 구간은 스칼라로 처리한다.
+ * 모든 함수는 상태가 없으므로 여러 스레드에서 동시에 호출해도 안전하다.
+ */
+class JWNETWORKUTILITY_API FJWNU_JsonSimdScanner
+{
+public:
+	/**
+	 * 문자열 내부에서 '"', '\\', 제어 문자(0x1F 이하) 중 처음 나타나는 위치를 찾는 함수.
+	 * @param InCur 탐색 시작 위치
+	 * @param InEnd 탐색 끝 위치
+	 * @return 찾은 위치 (없으면 InEnd)
+	 */
+	static const UTF8CHAR* FindStringSpecial(const UTF8CHAR* InCur, const UTF8CHAR* InEnd);
+	static const TCHAR* FindStringSpecial(const TCHAR* InCur, const TCHAR* InEnd);
+
+	/**
+	 * 공백(' ', '\t', '\n', '\r')이 아닌 첫 위치를 찾는 함수. (Pretty Print된 바디의 들여쓰기 구간용)
+	 * @param InCur 탐색 시작 위치
+	 * @param InEnd 탐색 끝 위치
+	 * @return 찾은 위치 (없으면 InEnd)
+	 */
+	static const UTF8CHAR* SkipWhitespace(const UTF8CHAR* InCur, const UTF8CHAR* InEnd);
+	static const TCHAR* SkipWhitespace(const TCHAR* InCur, const TCHAR* InEnd);
+
+	/**
+	 * UTF-8 바이트열이 올바른지 검사하는 함수. ASCII 구간은 레지스터 폭 단위로 건너뛰고, 멀티바이트 시퀀스만 스칼라로 검사한다.
+	 * 오버롱 인코딩, 서로게이트, U+10FFFF 초과 코드 포인트를 거부한다.
+	 * @param InData UTF-8 바이트
+	 * @param InNum 바이트 수
+	 * @param OutErrorOffset 실패한 바이트 오프셋 (선택)
+	 * @return 유효하면 true
+	 */
+	static bool ValidateUtf8(const UTF8CHAR* InData, const int32 InNum, int32* OutErrorOffset = nullptr);
+
+	/**
+	 * SIMD 경로 사용 여부를 설정하는 함수. (벤치마크에서 스칼라 경로와 비교하는 용도)
+	 * @param bInEnabled false면 모든 커널이 스칼라 경로만 사용한다
+	 */
+	static void SetSimdEnabled(const bool bInEnabled);
+
+	/**
+	 * SIMD 경로 사용 여부를 반환한다.
+	 */
+	static bool IsSimdEnabled();
+
+	/**
+	 * 이 빌드에서 사용하는 SIMD 백엔드 이름을 반환한다. ("AVX2", "SSE2", "NEON", "Scalar")
+	 */
+	static const TCHAR* GetBackendName();
+};
@@ -0,0 +1,93 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Class.h"
+
+/**
+ * 클래스 전용 로그 카테고리 선언
+ */
+JWNETWORKUTILITY_API DECLARE_LOG_CATEGORY_EXTERN(LogJWNU_JsonStructReader, Log, All);
+
+/**
+ * JSON 역직렬화 실패 정보를 담는 구조체.
+ */
+struct JWNETWORKUTILITY_API FJWNU_JsonReadError
+{
+	/**
+	 * JSON 문법 자체가 잘못되었는지 여부. (false라면 문법은 올바르지만 구조체로 변환하지 못한 경우)
+	 */
+	bool bSyntaxError = false;
+
+	/**
+	 * 실패 지점의 문자 오프셋.
+	 */
+	int32 Offset = INDEX_NONE;
+
+	/**
+	 * 실패 사유.
+	 */
+	FString Message;
+};
+
+/**
+ * FJsonObject DOM을 만들지 않고 JSON 텍스트를 UStruct 메모리에 직접 기록하는 스트리밍 역직렬화기.
+ * 키 조회와 값 기록에는 FJWNU_JsonStructSchema가 캐싱한 오프셋-타입 핸들러 테이블을 사용한다.
+ * UTF-8 바이트를 그대로 읽을 수 있으므로 리스폰스 전체를 TCHAR로 변환할 필요가 없다. (문자열 값만 개별 변환)
+ * 직접 처리하지 않는 프로퍼티 타입이나 값 형태(오브젝트 참조, 문자열로 표현된 구조체 등)는 해당 값만 FJsonObjectConverter로 위임한다.
+ * 구조체에 없는 키의 값도 문법을 검증하며, RFC 8259를 벗어나는 숫자, 이스케이프되지 않은 제어 문자, 짝이 맞지 않는 괄호, 부호 없는 필드의 음수는 실패로 처리한다.
+ * 여러 스레드에서 동시에 호출해도 안전하다.
+ */
+class JWNETWORKUTILITY_API FJWNU_JsonStructReader
+{
+public:
+	/**
+	 * UTF-8 JSON 바이트를 구조체로 역직렬화하는 함수.
+	 * @param InData UTF-8 JSON 바이트 (BOM 허용)
+	 * @param InNum 바이트 수
+	 * @param InStruct 대상 구조체 타입
+	 * @param OutStructData 대상 구조체 메모리
+	 * @param OutError 실패 정보 (선택)
+	 * @return 성공 여부
+	 */
+	static bool ReadUtf8(const UTF8CHAR* InData, const int32 InNum, const UStruct* InStruct, void* OutStructData, FJWNU_JsonReadError* OutError = nullptr);
+
+	/**
+	 * TCHAR JSON 문자열을 구조체로 역직렬화하는 함수.
+	 * @param InJson JSON 문자열
+	 * @param InStruct 대상 구조체 타입
+	 * @param OutStructData 대상 구조체 메모리
+	 * @param OutError 실패 정보 (선택)
+	 * @return 성공 여부
+	 */
+	static bool ReadString(const FStringView InJson, const UStruct* InStruct, void* OutStructData, FJWNU_JsonReadError* OutError = nullptr);
+
+	/**
+	 * UTF-8 JSON 바이트를 언리얼 구조체로 역직렬화하는 함수.
+	 * @tparam StructType 대상 언리얼 구조체 타입
+	 * @param InBytes UTF-8 JSON 바이트
+	 * @param OutStruct 대상 구조체
+	 * @param OutError 실패 정보 (선택)
+	 * @return 성공 여부
+	 */
+	template<typename StructType>
+	static bool ReadUtf8(const TArray<uint8>& InBytes, StructType& OutStruct, FJWNU_JsonReadError* OutError = nullptr)
+	{
+		return ReadUtf8(reinterpret_cast<const UTF8CHAR*>(InBytes.GetData()), InBytes.Num(), StructType::StaticStruct(), &OutStruct, OutError);
+	}
+
+	/**
+	 * TCHAR JSON 문자열을 언리얼 구조체로 역직렬화하는 함수.
+	 * @tparam StructType 대상 언리얼 구조체 타입
+	 * @param InJson JSON 문자열
+	 * @param OutStruct 대상 구조체
+	 * @param OutError 실패 정보 (선택)
+	 * @return 성공 여부
+	 */
+	template<typename StructType>
+	static bool ReadString(const FStringView InJson, StructType& OutStruct, FJWNU_JsonReadError* OutError = nullptr)
+	{
+		return ReadString(InJson, StructType::StaticStruct(), &OutStruct, OutError);
+	}
+};
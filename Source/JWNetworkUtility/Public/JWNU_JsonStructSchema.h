@@ -0,0 +1,222 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Class.h"
+
+class FNumericProperty;
+
+/**
+ * 클래스 전용 로그 카테고리 선언
+ */
+JWNETWORKUTILITY_API DECLARE_LOG_CATEGORY_EXTERN(LogJWNU_JsonStructSchema, Log, All);
+
+/**
+ * JSON 변환 시 프로퍼티 값을 다루는 방식을 나타내는 열거형.
+ */
+enum class EJWNU_JsonValueKind : uint8
+{
+	String,
+	Name,
+	Text,
+	Bool,
+	Enum,
+	SignedInteger,
+	UnsignedInteger,
+	FloatingPoint,
+	Struct,
+	Array,
+	Set,
+	Map,
+	/** 직접 처리하지 않는 타입. FJsonObjectConverter로 위임한다 */
+	Fallback,
+};
+
+/**
+ * 프로퍼티 하나의 JSON 변환 방식을 미리 분류해둔 타입 핸들러.
+ * 컨테이너 타입은 원소(Array/Set) 또는 키-값(Map) 핸들러를 자식으로 가진다.
+ */
+struct JWNETWORKUTILITY_API FJWNU_JsonTypeHandler
+{
+	/**
+	 * 값 처리 방식.
+	 */
+	EJWNU_JsonValueKind Kind = EJWNU_JsonValueKind::Fallback;
+
+	/**
+	 * 원본 프로퍼티.
+	 */
+	const FProperty* Property = nullptr;
+
+	/**
+	 * 열거형 타입. (Enum 전용)
+	 */
+	const UEnum* Enum = nullptr;
+
+	/**
+	 * 값을 읽고 쓸 숫자 프로퍼티. (Enum의 기반 정수 프로퍼티 또는 숫자 프로퍼티)
+	 */
+	const FNumericProperty* NumericProperty = nullptr;
+
+	/**
+	 * 중첩 구조체 타입. (Struct 전용)
+	 */
+	const UStruct* Struct = nullptr;
+
+	/**
+	 * 자식 핸들러. Array/Set은 [원소], Map은 [키, 값]
+	 */
+	TArray<FJWNU_JsonTypeHandler> Children;
+
+	/**
+	 * 프로퍼티를 분류해 핸들러를 만드는 함수.
+	 * @param InProperty 분류할 프로퍼티
+	 * @return 타입 핸들러
+	 */
+	static FJWNU_JsonTypeHandler Make(const FProperty* InProperty);
+};
+
+/**
+ * 구조체 필드 하나의 JSON 매핑 정보.
+ */
+struct JWNETWORKUTILITY_API FJWNU_JsonField
+{
+	/**
+	 * 직렬화 시 사용하는 JSON 키. FJsonObjectConverter::StandardizeCase를 적용한 camelCase 이름
+	 */
+	FString JsonKey;
+
+	/**
+	 * 구조체 메모리 기준 값 오프셋.
+	 */
+	int32 Offset = 0;
+
+	/**
+	 * 고정 크기 배열 원소 수. (일반 프로퍼티는 1)
+	 */
+	int32 ArrayDim = 1;
+
+	/**
+	 * 원소 하나의 바이트 크기.
+	 */
+	int32 ElementSize = 0;
+
+	/**
+	 * 타입 핸들러.
+	 */
+	FJWNU_JsonTypeHandler Handler;
+
+	FORCEINLINE void* GetValuePtr(void* InStructData, const int32 InIndex = 0) const
+	{
+		return static_cast<uint8*>(InStructData) + Offset + InIndex * ElementSize;
+	}
+
+	FORCEINLINE const void* GetValuePtr(const void* InStructData, const int32 InIndex = 0) const
+	{
+		return static_cast<const uint8*>(InStructData) + Offset + InIndex * ElementSize;
+	}
+};
+
+/**
+ * 구조체별 JSON 변환 스키마. JSON 키 → 오프셋/타입 핸들러 테이블을 최초 1회만 만들어 이후 변환에서 재사용한다.
+ * 키 조회는 FJsonObjectConverter와 동일하게 대소문자를 구분하지 않으므로 PascalCase 프로퍼티와 camelCase JSON 키가 그대로 매칭된다.
+ * 네이티브 구조체의 스키마는 프로세스 수명 동안 캐싱하며, BP 구조체는 재컴파일될 수 있으므로 매번 새로 만든다.
+ * 불변 객체이므로 여러 스레드에서 동시에 사용해도 안전하다.
+ */
+class JWNETWORKUTILITY_API FJWNU_JsonStructSchema
+{
+public:
+	/**
+	 * 구조체의 스키마를 획득하는 함수.
+	 * @param InStruct 대상 구조체 타입
+	 * @return 스키마
+	 */
+	static TSharedRef<const FJWNU_JsonStructSchema, ESPMode::ThreadSafe> Get(const UStruct* InStruct);
+
+	/**
+	 * 구조체 타입으로 스키마를 만드는 생성자. 직접 호출하지 말고 Get을 사용한다.
+	 * @param InStruct 대상 구조체 타입
+	 */
+	explicit FJWNU_JsonStructSchema(const UStruct* InStruct);
+
+	/**
+	 * 대상 구조체 타입을 반환한다.
+	 */
+	const UStruct* GetStruct() const { return Struct; }
+
+	/**
+	 * 선언 순서대로 정렬된 필드 목록을 반환한다.
+	 */
+	const TArray<FJWNU_JsonField>& GetFields() const { return Fields; }
+
+	/**
+	 * 이스케이프 없는 JSON 키 구간으로 필드를 찾는 함수.
+	 * @param InKey 키 시작 포인터 (UTF8CHAR 또는 TCHAR)
+	 * @param InLength 키 길이
+	 * @param InHash HashKeyChar로 누적한 키 해시
+	 * @return 필드 (없으면 nullptr)
+	 */
+	template<typename CharType>
+	const FJWNU_JsonField* FindField(const CharType* InKey, const int32 InLength, const uint32 InHash) const;
+
+	/**
+	 * 디코딩된 키 문자열로 필드를 찾는 함수.
+	 * @param InKey JSON 키
+	 * @return 필드 (없으면 nullptr)
+	 */
+	const FJWNU_JsonField* FindField(const FStringView InKey) const;
+
+	/**
+	 * 대소문자를 구분하지 않는 FNV-1a 키 해시의 초기값.
+	 */
+	static constexpr uint32 HashSeed = 2166136261u;
+
+	/**
+	 * 키 해시에 문자 하나를 누적하는 함수. (ASCII 범위만 소문자화)
+	 * @param InHash 누적 해시
+	 * @param InChar 문자 코드
+	 * @return 새 누적 해시
+	 */
+	static FORCEINLINE uint32 HashKeyChar(const uint32 InHash, uint32 InChar)
+	{
+		if (InChar >= 'A' && InChar <= 'Z')
+		{
+			InChar += 'a' - 'A';
+		}
+		return (InHash ^ InChar) * 16777619u;
+	}
+
+private:
+	static bool KeyEquals(const FString& InJsonKey, const UTF8CHAR* InKey, const int32 InLength);
+	static bool KeyEquals(const FString& InJsonKey, const TCHAR* InKey, const int32 InLength);
+
+	/**
+	 * 대상 구조체 타입.
+	 */
+	const UStruct* Struct = nullptr;
+
+	/**
+	 * 선언 순서대로 정렬된 필드 목록.
+	 */
+	TArray<FJWNU_JsonField> Fields;
+
+	/**
+	 * 키 해시 → 필드 인덱스 멀티맵.
+	 */
+	TMultiMap<uint32, int32> HashToField;
+};
+
+template<typename CharType>
+const FJWNU_JsonField* FJWNU_JsonStructSchema::FindField(const CharType* InKey, const int32 InLength, const uint32 InHash) const
+{
+	for (auto It = HashToField.CreateConstKeyIterator(InHash); It; ++It)
+	{
+		const FJWNU_JsonField& Field = Fields[It.Value()];
+		if (KeyEquals(Field.JsonKey, InKey, InLength))
+		{
+			return &Field;
+		}
+	}
+	return nullptr;
+}
@@ -0,0 +1,70 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Class.h"
+
+/**
+ * 클래스 전용 로그 카테고리 선언
+ */
+JWNETWORKUTILITY_API DECLARE_LOG_CATEGORY_EXTERN(LogJWNU_JsonStructWriter, Log, All);
+
+/**
+ * FJsonObject DOM을 만들지 않고 UStruct 메모리를 JSON 문자열로 직접 기록하는 직렬화기.
+ * FJWNU_JsonStructSchema가 캐싱한 camelCase 키와 타입 핸들러를 사용하며, 출력 규칙은 FJsonObjectConverter::UStructToJsonObjectString과 같다.
+ * 직접 처리하지 않는 프로퍼티 타입은 해당 값만 FJsonObjectConverter로 위임한다.
+ * 요청 바디용으로 FString을 거치지 않고 UTF-8 바이트 버퍼에 곧바로 기록하는 경로도 제공한다.
+ * 여러 스레드에서 동시에 호출해도 안전하다.
+ */
+class JWNETWORKUTILITY_API FJWNU_JsonStructWriter
+{
+public:
+	/**
+	 * 구조체를 JSON 문자열로 직렬화하는 함수.
+	 * @param InStruct 구조체 타입
+	 * @param InStructData 구조체 메모리
+	 * @param OutJson JSON 문자열
+	 * @param bInPrettyPrint 들여쓰기와 줄바꿈 포함 여부
+	 * @return 성공 여부
+	 */
+	static bool WriteString(const UStruct* InStruct, const void* InStructData, FString& OutJson, const bool bInPrettyPrint = false);
+
+	/**
+	 * 언리얼 구조체를 JSON 문자열로 직렬화하는 함수.
+	 * @tparam StructType 언리얼 구조체 타입
+	 * @param InStruct 구조체
+	 * @param OutJson JSON 문자열
+	 * @param bInPrettyPrint 들여쓰기와 줄바꿈 포함 여부
+	 * @return 성공 여부
+	 */
+	template<typename StructType>
+	static bool WriteString(const StructType& InStruct, FString& OutJson, const bool bInPrettyPrint = false)
+	{
+		return WriteString(StructType::StaticStruct(), &InStruct, OutJson, bInPrettyPrint);
+	}
+
+	/**
+	 * 구조체를 UTF-8 JSON 바이트로 직렬화하는 함수. 결과는 FString 중간 단계와 TCHAR→UTF-8 재변환 없이 그대로 HTTP 바디로 쓸 수 있다.
+	 * @param InStruct 구조체 타입
+	 * @param InStructData 구조체 메모리
+	 * @param OutJson UTF-8 JSON 바이트 (널 종료 없음)
+	 * @param bInPrettyPrint 들여쓰기와 줄바꿈 포함 여부
+	 * @return 성공 여부
+	 */
+	static bool WriteUtf8(const UStruct* InStruct, const void* InStructData, TArray<uint8>& OutJson, const bool bInPrettyPrint = false);
+
+	/**
+	 * 언리얼 구조체를 UTF-8 JSON 바이트로 직렬화하는 함수.
+	 * @tparam StructType 언리얼 구조체 타입
+	 * @param InStruct 구조체
+	 * @param OutJson UTF-8 JSON 바이트 (널 종료 없음)
+	 * @param bInPrettyPrint 들여쓰기와 줄바꿈 포함 여부
+	 * @return 성공 여부
+	 */
+	template<typename StructType>
+	static bool WriteUtf8(const StructType& InStruct, TArray<uint8>& OutJson, const bool bInPrettyPrint = false)
+	{
+		return WriteUtf8(StructType::StaticStruct(), &InStruct, OutJson, bInPrettyPrint);
+	}
+};
@@ -0,0 +1,127 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "JWNetworkUtilityTypes.h"
+
+class FJWNU_RequestDescriptor;
+
+/**
+ * 요청 바디 인자. 텍스트는 복사하지 않고 참조만 해 두었다가 기술자를 만들 때 UTF-8로 한 번만 변환하고, 이미 UTF-8로 직렬화된 바이트는 그대로 이동시킨다.
+ * 텍스트 참조는 호출이 끝날 때까지만 유효하므로 함수 인자로만 사용하고, 복사할 수 없다.
+ */
+class JWNETWORKUTILITY_API FJWNU_RequestBody
+{
+public:
+	FJWNU_RequestBody() = default;
+	FJWNU_RequestBody(const FString& InText) : Text(InText) {}
+	FJWNU_RequestBody(const FStringView InText) : Text(InText) {}
+	FJWNU_RequestBody(const TCHAR* InText) : Text(InText) {}
+	FJWNU_RequestBody(TArray<uint8>&& InUtf8Bytes) : Utf8Bytes(MoveTemp(InUtf8Bytes)), bIsUtf8(true) {}
+
+	FJWNU_RequestBody(FJWNU_RequestBody&&) = default;
+	FJWNU_RequestBody& operator=(FJWNU_RequestBody&&) = default;
+	FJWNU_RequestBody(const FJWNU_RequestBody&) = delete;
+	FJWNU_RequestBody& operator=(const FJWNU_RequestBody&) = delete;
+
+	FORCEINLINE bool IsEmpty() const { return bIsUtf8 ? Utf8Bytes.Num() == 0 : Text.IsEmpty(); }
+
+	/**
+	 * 바디를 UTF-8 바이트로 꺼내는 함수. 이미 UTF-8이라면 버퍼를 그대로 이동시키고, 텍스트라면 이때 한 번만 변환한다.
+	 * @return UTF-8 바이트 (호출 후 이 인자는 비어 있다)
+	 */
+	TArray<uint8> ConsumeUtf8();
+
+private:
+	FStringView Text;
+	TArray<uint8> Utf8Bytes;
+	bool bIsUtf8 = false;
+};
+
+/**
+ * 요청 기술자를 가리키는 스레드 안전 공유 참조. 서비스, 헬퍼, 프로세서, Job이 같은 인스턴스를 공유한다.
+ */
+using FJWNU_RequestDescriptorRef = TSharedRef<const FJWNU_RequestDescriptor, ESPMode::ThreadSafe>;
+
+/**
+ * 하나의 API 호출을 보내는 데 필요한 정보(메서드, 서비스 타입, 쿼리 패러미터까지 조합된 URL, UTF-8 바디, 동작 설정)를 한 번만 구축해 담아 두는 불변 기술자.
+ * 생성 후에는 바뀌지 않으므로, 401 이후 재전송이나 네트워크 재시도에서는 문자열과 맵을 다시 복사하지 않고 참조만 넘긴다.
+ * 엑세스 토큰은 리프레시마다 바뀌므로 기술자에 담지 않고 전송 시점에 따로 넘긴다.
+ */
+class JWNETWORKUTILITY_API FJWNU_RequestDescriptor
+{
+public:
+	/**
+	 * 기술자를 생성하는 함수. URL과 바디는 이동시키므로 기술자 생성 이후에는 복사가 일어나지 않는다.
+	 * @param InMethod HTTP 메서드
+	 * @param InServiceType 토큰 리프레시 대상 서비스 타입 (헬퍼를 직접 쓰는 Raw 호출에서는 의미 없음)
+	 * @param InBaseURL 쿼리 패러미터를 붙이기 전의 URL
+	 * @param InContentBody JSON 바디 (GET/DELETE는 비어 있음)
+	 * @param InQueryParams URL 쿼리 패러미터
+	 * @param InConfig 동작 설정 (재시도, 타임아웃 등)
+	 * @param InEndpointId 엔드포인트 식별자 (엔드포인트 선언 없이 문자열로 호출했다면 0)
+	 * @return 공유 참조
+	 */
+	static FJWNU_RequestDescriptorRef Create(
+		const EJWNU_HttpMethod InMethod,
+		const EJWNU_ServiceType InServiceType,
+		FString&& InBaseURL,
+		FJWNU_RequestBody&& InContentBody,
+		const TMap<FString, FString>& InQueryParams,
+		const FJWNU_RequestConfig& InConfig,
+		const uint64 InEndpointId = 0);
+
+	FJWNU_RequestDescriptor(
+		const EJWNU_HttpMethod InMethod,
+		const EJWNU_ServiceType InServiceType,
+		FString&& InURL,
+		TArray<uint8>&& InContentBytes,
+		const FJWNU_RequestConfig& InConfig,
+		const uint64 InEndpointId = 0);
+
+	FJWNU_RequestDescriptor(const FJWNU_RequestDescriptor&) = delete;
+	FJWNU_RequestDescriptor& operator=(const FJWNU_RequestDescriptor&) = delete;
+
+	FORCEINLINE EJWNU_HttpMethod GetMethod() const { return Method; }
+
+	FORCEINLINE EJWNU_ServiceType GetServiceType() const { return ServiceType; }
+
+	/**
+	 * 쿼리 패러미터까지 조합된 최종 URL을 반환한다.
+	 */
+	FORCEINLINE const FString& GetURL() const { return URL; }
+
+	/**
+	 * UTF-8로 한 번만 변환해 둔 바디를 반환한다. (없으면 빈 배열)
+	 */
+	FORCEINLINE const TArray<uint8>& GetContentBytes() const { return ContentBytes; }
+
+	FORCEINLINE const FJWNU_RequestConfig& GetConfig() const { return Config; }
+
+	/**
+	 * 엔드포인트 식별자를 반환한다. 메트릭은 URL 대신 이 값을 키로 집계한다. (엔드포인트 선언 없이 호출했다면 0)
+	 */
+	FORCEINLINE uint64 GetEndpointId() const { return EndpointId; }
+
+	/**
+	 * HTTP 메서드 문자열("GET", "POST" 등)을 반환한다.
+	 */
+	const TCHAR* GetVerb() const;
+
+	/**
+	 * 기본 URL에 쿼리 패리미터를 조합해서 최종 URL을 구축하는 함수. 기본 URL 버퍼에 이어 붙이므로 쿼리가 없으면 그대로 이동된다.
+	 * @param BaseURL 리퀘스트를 보낼 기본 URL
+	 * @param QueryParams URL 쿼리 패러미터
+	 * @return 쿼리 패러미터까지 조합된 최종 URL.
+	 */
+	static FString BuildURL(FString&& BaseURL, const TMap<FString, FString>& QueryParams);
+
+private:
+	const EJWNU_HttpMethod Method;
+	const EJWNU_ServiceType ServiceType;
+	const FString URL;
+	const TArray<uint8> ContentBytes;
+	const FJWNU_RequestConfig Config;
+	const uint64 EndpointId;
+};
@@ -0,0 +1,315 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "JWNU_Coroutine.h"
+
+/**
+ * 클래스 전용 로그 카테고리 선언
+ */
+JWNETWORKUTILITY_API DECLARE_LOG_CATEGORY_EXTERN(LogJWNU_RequestGraph, Log, All);
+
+/**
+ * 요청 그래프 노드의 진행 상태.
+ */
+enum class EJWNU_RequestGraphNodeState : uint8
+{
+	Pending,
+	Running,
+	Succeeded,
+	Failed,
+	Skipped,	// 선행 노드가 실패해 보내지 않음
+	Cancelled
+};
+
+/**
+ * 요청 그래프 노드 식별자. 의존 관계 선언에 사용한다.
+ */
+struct FJWNU_RequestGraphNodeId
+{
+	int32 Index = INDEX_NONE;
+};
+
+/**
+ * 응답 타입을 기억하는 요청 그래프 노드 식별자. 결과 조회 시 타입이 다르면 컴파일되지 않는다.
+ */
+template<typename StructType>
+struct TJWNU_RequestGraphNode : FJWNU_RequestGraphNodeId
+{
+};
+
+/**
+ * 노드 하나의 실행 기록. 시각은 모두 그래프 실행 시작 기준 초 단위다.
+ */
+struct FJWNU_RequestGraphNodeReport
+{
+	FName Name;
+	EJWNU_RequestGraphNodeState State = EJWNU_RequestGraphNodeState::Pending;
+
+	/**
+	 * 모든 선행 노드가 끝나 보낼 수 있게 된 시각.
+	 */
+	double ReadySeconds = 0.0;
+
+	/**
+	 * 실제로 보낸 시각. (동시 실행 한도 때문에 ReadySeconds보다 늦을 수 있다)
+	 */
+	double StartSeconds = 0.0;
+
+	double EndSeconds = 0.0;
+
+	/**
+	 * 실패 사유. (Failed일 때만 유효)
+	 */
+	FJWNU_ApiError Error;
+
+	double GetQueueSeconds() const { return StartSeconds - ReadySeconds; }
+	double GetDurationSeconds() const { return EndSeconds - StartSeconds; }
+};
+
+/**
+ * 그래프 실행 결과 보고서.
+ */
+struct FJWNU_RequestGraphReport
+{
+	TArray<FJWNU_RequestGraphNodeReport> Nodes;
+
+	/**
+	 * 실행 시작부터 마지막 노드가 끝날 때까지의 시간.
+	 */
+	double TotalSeconds = 0.0;
+
+	/**
+	 * 모든 노드의 요청 시간 합. (콜백으로 직렬 실행했다면 걸렸을 시간의 근사값)
+	 */
+	double SerialSeconds = 0.0;
+
+	/**
+	 * 마지막으로 끝난 노드에서 출발해, 매번 가장 늦게 끝난 선행 노드를 따라 거슬러 올라간 경로. (실행 순서대로)
+	 */
+	TArray<FName> CriticalPath;
+
+	int32 PeakConcurrency = 0;
+
+	/**
+	 * 모든 노드가 성공했는지 여부.
+	 */
+	bool bSucceeded = false;
+};
+
+/**
+ * UJWNU_GIS_ApiClientService 위에서 의존 관계가 있는 API 호출 묶음을 실행하는 그래프.
+ * 노드는 선행 노드 결과를 읽어 JWNU::CallApi / JWNU::CallEndpoint 대기 객체를 만드는 함수로 선언하고,
+ * 실행 시 선행 노드가 모두 성공한 노드를 동시 실행 한도 안에서 한꺼번에 보낸다. 노드가 실패하면 그 노드에 의존하는 노드는 보내지 않는다.
+ * 선행 노드는 항상 먼저 추가된 노드이므로 순환은 생길 수 없다. 게임 스레드 전용이다.
+ *
+ *	const auto Graph = FJWNU_RequestGraph::Create(4);
+ *	const auto Login = Graph->AddCall<FJWNU_RES_AuthLogin>(TEXT("Login"), {}, [this](const FJWNU_RequestGraph&) { return JWNU::CallApi<FJWNU_RES_AuthLogin>(this, ...); });
+ *	const auto Config = Graph->AddCall<FMyConfig>(TEXT("Config"), {}, ...);
+ *	Graph->AddCall<FMyInventory>(TEXT("Inventory"), { Login }, [this, Login](const FJWNU_RequestGraph& G) { ... G.GetResult(Login).UserId ... });
+ *	Graph->Run([](const FJWNU_RequestGraphReport& Report) { ... });
+ */
+class JWNETWORKUTILITY_API FJWNU_RequestGraph : public TSharedFromThis<FJWNU_RequestGraph, ESPMode::ThreadSafe>
+{
+public:
+	using FOnGraphCompleted = TFunction<void(const FJWNU_RequestGraphReport&)>;
+
+	/**
+	 * 그래프를 생성하는 함수.
+	 * @param InMaxConcurrency 동시에 진행할 최대 요청 수 (0 이하이면 제한 없음)
+	 * @return 그래프
+	 */
+	static TSharedRef<FJWNU_RequestGraph, ESPMode::ThreadSafe> Create(const int32 InMaxConcurrency = 4);
+
+	explicit FJWNU_RequestGraph(const int32 InMaxConcurrency);
+	~FJWNU_RequestGraph();
+
+	/**
+	 * API 호출 노드를 추가하는 함수. Run 이전에만 호출할 수 있다.
+	 * @tparam StructType 응답 구조체 타입
+	 * @param InName 보고서와 로그에 쓰는 노드 이름
+	 * @param InDependencies 선행 노드 (모두 성공해야 이 노드를 보낸다)
+	 * @param InMakeCall 선행 노드 결과로 호출을 만드는 함수 (노드를 보낼 때 한 번 호출)
+	 * @return 노드 식별자
+	 */
+	template<typename StructType>
+	TJWNU_RequestGraphNode<StructType> AddCall(const FName InName, const TConstArrayView<FJWNU_RequestGraphNodeId> InDependencies, TFunction<TJWNU_ApiAwaiter<StructType>(const FJWNU_RequestGraph&)>&& InMakeCall)
+	{
+		TJWNU_RequestGraphNode<StructType> NodeId;
+		NodeId.Index = AddNode(MakeUnique<TNode<StructType>>(MoveTemp(InMakeCall)), InName, InDependencies);
+		return NodeId;
+	}
+
+	/**
+	 * 성공한 노드의 응답을 반환하는 함수. 선행 노드로 선언한 노드의 결과는 항상 읽을 수 있다.
+	 * @param InNode 노드 식별자
+	 * @return 응답 구조체
+	 */
+	template<typename StructType>
+	const StructType& GetResult(const TJWNU_RequestGraphNode<StructType> InNode) const
+	{
+		check(Nodes.IsValidIndex(InNode.Index) && Nodes[InNode.Index]->Report.State == EJWNU_RequestGraphNodeState::Succeeded);
+		return static_cast<const TNode<StructType>&>(*Nodes[InNode.Index]).Value.GetValue();
+	}
+
+	/**
+	 * 노드의 현재 상태를 반환한다.
+	 */
+	EJWNU_RequestGraphNodeState GetNodeState(const FJWNU_RequestGraphNodeId InNode) const;
+
+	/**
+	 * 그래프를 실행하는 함수. 실행 중에는 그래프가 스스로를 유지하므로 반환값을 보관하지 않아도 된다.
+	 * @param InOnCompleted 모든 노드가 끝나거나 취소되면 한 번 호출되는 콜백
+	 */
+	void Run(FOnGraphCompleted&& InOnCompleted);
+
+	/**
+	 * 진행 중인 요청을 모두 취소하고 남은 노드를 보내지 않는다. 완료 콜백은 취소 상태의 보고서로 호출된다.
+	 */
+	void Cancel();
+
+	bool IsRunning() const { return bStarted && bFinished == false; }
+
+private:
+	/**
+	 * 응답 타입과 무관한 노드 공통 부분.
+	 */
+	struct FNode
+	{
+		virtual ~FNode() = default;
+
+		/**
+		 * 호출을 만들어 보낸다. 보내기 전에 실패했다면 이 안에서 완료 통지가 온다.
+		 */
+		virtual void Launch(FJWNU_RequestGraph& InGraph, const int32 InIndex) = 0;
+
+		/**
+		 * 끝난 호출의 결과를 노드에 옮긴다.
+		 * @return 성공 여부 (실패 시 OutError에 사유)
+		 */
+		virtual bool ConsumeResult(FJWNU_ApiError& OutError) = 0;
+
+		/**
+		 * 진행 중인 호출을 취소한다.
+		 */
+		virtual void CancelCall() = 0;
+
+		FJWNU_RequestGraphNodeReport Report;
+		TArray<int32> Dependencies;
+		TArray<int32> Dependents;
+		int32 PendingDependencyCount = 0;
+	};
+
+	template<typename StructType>
+	struct TNode : FNode
+	{
+		explicit TNode(TFunction<TJWNU_ApiAwaiter<StructType>(const FJWNU_RequestGraph&)>&& InMakeCall)
+			: MakeCall(MoveTemp(InMakeCall))
+		{
+		}
+
+		virtual void Launch(FJWNU_RequestGraph& InGraph, const int32 InIndex) override
+		{
+			Operation = TakeOperation(MakeCall(InGraph));
+			MakeCall = nullptr;
+			Operation->OnCompleted = [WeakGraph = InGraph.AsWeak(), InIndex]()
+			{
+				if (const TSharedPtr<FJWNU_RequestGraph, ESPMode::ThreadSafe> Graph = WeakGraph.Pin())
+				{
+					Graph->OnNodeCompleted(InIndex);
+				}
+			};
+			Operation->Start();
+		}
+
+		virtual bool ConsumeResult(FJWNU_ApiError& OutError) override
+		{
+			TJWNU_ApiResult<StructType> Result = Operation->TakeResult();
+			Operation.Reset();
+			if (Result.HasError())
+			{
+				OutError = Result.GetError();
+				return false;
+			}
+			Value.Emplace(Result.StealValue());
+			return true;
+		}
+
+		virtual void CancelCall() override
+		{
+			if (Operation.IsValid())
+			{
+				Operation->Cancel();
+				Operation.Reset();
+			}
+		}
+
+		TFunction<TJWNU_ApiAwaiter<StructType>(const FJWNU_RequestGraph&)> MakeCall;
+		TSharedPtr<TJWNU_ApiOperation<StructType>, ESPMode::ThreadSafe> Operation;
+		TOptional<StructType> Value;
+	};
+
+	/**
+	 * 대기 객체에서 호출을 꺼내는 함수. (대기 객체는 더 이상 호출을 취소하지 않는다)
+	 */
+	template<typename StructType>
+	static TSharedPtr<TJWNU_ApiOperation<StructType>, ESPMode::ThreadSafe> TakeOperation(TJWNU_ApiAwaiter<StructType>&& InAwaiter)
+	{
+		return MoveTemp(InAwaiter.Operation);
+	}
+
+	/**
+	 * 노드를 등록하고 인덱스를 반환한다.
+	 */
+	int32 AddNode(TUniquePtr<FNode>&& InNode, const FName InName, const TConstArrayView<FJWNU_RequestGraphNodeId> InDependencies);
+
+	/**
+	 * 준비된 노드를 동시 실행 한도 안에서 보낸다. 보내는 도중 동기적으로 끝난 노드가 있어도 같은 루프에서 이어서 처리한다.
+	 */
+	void DispatchReadyNodes();
+
+	/**
+	 * 노드 하나의 완료를 처리한다.
+	 */
+	void OnNodeCompleted(const int32 InIndex);
+
+	/**
+	 * 실패한 노드에 의존하는 노드를 모두 건너뛴다.
+	 */
+	void SkipDependents(const int32 InIndex);
+
+	/**
+	 * 보고서를 만들어 완료 콜백을 호출한다.
+	 */
+	void Finish();
+
+	FJWNU_RequestGraphReport BuildReport() const;
+
+	double GetElapsedSeconds() const;
+
+	TArray<TUniquePtr<FNode>> Nodes;
+
+	/**
+	 * 보낼 수 있게 된 노드 인덱스. (ReadyHead 이전은 이미 보낸 노드)
+	 */
+	TArray<int32> ReadyQueue;
+	int32 ReadyHead = 0;
+
+	FOnGraphCompleted OnCompleted;
+
+	/**
+	 * 실행 중 그래프를 유지하는 자기 참조.
+	 */
+	TSharedPtr<FJWNU_RequestGraph, ESPMode::ThreadSafe> SelfWhileRunning;
+
+	double StartTime = 0.0;
+	int32 MaxConcurrency = 0;
+	int32 RunningCount = 0;
+	int32 PeakConcurrency = 0;
+	int32 SettledCount = 0;
+	bool bStarted = false;
+	bool bFinished = false;
+	bool bCancelled = false;
+	bool bDispatching = false;
+};
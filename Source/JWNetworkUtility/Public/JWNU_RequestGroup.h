@@ -0,0 +1,139 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Engine/EngineTypes.h"
+#include "JWNU_RequestHandle.h"
+#include "JWNU_RequestGroup.generated.h"
+
+class UJWNU_HttpRequestJobHandle;
+
+/**
+ * 클래스 전용 로그 카테고리 선언
+ */
+JWNETWORKUTILITY_API DECLARE_LOG_CATEGORY_EXTERN(LogJWNU_RequestGroup, Log, All);
+
+/**
+ * 요청 핸들을 묶어 한꺼번에 취소하는 RAII 그룹. 그룹이 파괴되면 아직 끝나지 않은 요청을 모두 취소한다.
+ * 위젯이나 액터의 멤버로 두면 소유자가 사라질 때 진행 중인 요청과 401 리프레시를 기다리는 요청이 함께 취소되고, 결과 콜백은 호출되지 않는다.
+ * 복사할 수 없고 이동만 가능하다. 게임 스레드 전용이다.
+ *
+ *	// 멤버: FJWNU_RequestGroup Requests;
+ *	Requests.Add(UJWNU_GIS_ApiClientService::CallApi_Template<FMyResponse>(this, ..., [this](const FMyResponse& Response) { ... }));
+ */
+struct JWNETWORKUTILITY_API FJWNU_RequestGroup
+{
+	FJWNU_RequestGroup() = default;
+	~FJWNU_RequestGroup();
+
+	FJWNU_RequestGroup(const FJWNU_RequestGroup&) = delete;
+	FJWNU_RequestGroup& operator=(const FJWNU_RequestGroup&) = delete;
+	FJWNU_RequestGroup(FJWNU_RequestGroup&& Other);
+	FJWNU_RequestGroup& operator=(FJWNU_RequestGroup&& Other);
+
+	/**
+	 * 요청을 그룹에 넣는 함수. 보내기 전에 실패한 빈 핸들은 무시한다.
+	 * @param InHandle 요청 핸들
+	 * @return 넣은 핸들 (호출 결과를 그대로 감싸 쓸 수 있도록)
+	 */
+	FJWNU_RequestHandle Add(const FJWNU_RequestHandle& InHandle);
+
+	/**
+	 * 그룹의 요청을 모두 취소하고 그룹을 비우는 함수. 그룹은 이후에도 계속 사용할 수 있다.
+	 */
+	void CancelAll();
+
+	/**
+	 * 아직 끝나지 않은 요청 수를 반환한다.
+	 */
+	int32 GetRunningCount() const;
+
+private:
+	/**
+	 * 이미 끝난 요청의 핸들을 제거한다.
+	 */
+	void RemoveFinished();
+
+	TArray<FJWNU_RequestHandle> Handles;
+};
+
+/**
+ * 블루프린트용 요청 그룹. 소유자에 묶여, 소유자가 사라지면 그룹에 넣은 요청을 모두 취소한다.
+ * 소유자가 액터(또는 액터 컴포넌트)라면 EndPlay에서, 그 외에는 소유자 월드가 정리될 때(레벨 전환) 취소하며,
+ * 그룹 자체가 GC되는 경우에도 취소한다. 소유자의 변수에 보관해 두어야 소유자와 수명이 같아진다.
+ */
+UCLASS(BlueprintType)
+class JWNETWORKUTILITY_API UJWNU_RequestGroup : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * 소유자에 묶인 요청 그룹을 생성하는 함수.
+	 * @param InOwner 그룹 소유자 (위젯, 액터, 액터 컴포넌트 등)
+	 * @return 요청 그룹
+	 */
+	UFUNCTION(BlueprintCallable, Category="JWNU|Job Control", meta=(DefaultToSelf="InOwner"))
+	static UJWNU_RequestGroup* CreateRequestGroup(UObject* InOwner);
+
+	/**
+	 * 요청을 그룹에 넣는 함수.
+	 * @param InHandle Call Api 등이 반환한 요청 핸들
+	 */
+	UFUNCTION(BlueprintCallable, Category="JWNU|Job Control")
+	void AddRequest(UJWNU_HttpRequestJobHandle* InHandle);
+
+	/**
+	 * 그룹의 요청을 모두 취소하는 함수.
+	 */
+	UFUNCTION(BlueprintCallable, Category="JWNU|Job Control")
+	void CancelAll();
+
+	/**
+	 * 아직 끝나지 않은 요청 수를 반환하는 함수.
+	 * @return 실행 중인 요청 수
+	 */
+	UFUNCTION(BlueprintPure, Category="JWNU|Job Control")
+	int32 GetRunningCount() const;
+
+	/**
+	 * 네이티브 요청을 그룹에 넣는 함수. (Native CPP)
+	 * @param InHandle 요청 핸들
+	 * @return 넣은 핸들
+	 */
+	FJWNU_RequestHandle Add(const FJWNU_RequestHandle& InHandle);
+
+	/**
+	 * Overriding for cancelling members \n 그룹이 파괴될 때 남은 요청을 취소하는 로직 오버라이드.
+	 */
+	virtual void BeginDestroy() override;
+
+private:
+	/**
+	 * 소유자 액터의 EndPlay 이벤트를 받는 함수.
+	 */
+	UFUNCTION()
+	void HandleOwnerEndPlay(AActor* InActor, EEndPlayReason::Type InEndPlayReason);
+
+	/**
+	 * 월드 정리 이벤트를 받아, 소유자 월드라면 남은 요청을 취소하는 함수.
+	 */
+	void HandleWorldCleanup(UWorld* InWorld, bool bSessionEnded, bool bCleanupResources);
+
+	/**
+	 * 그룹에 넣은 요청.
+	 */
+	FJWNU_RequestGroup Group;
+
+	/**
+	 * 소유자가 속한 월드.
+	 */
+	TWeakObjectPtr<UWorld> OwnerWorld;
+
+	/**
+	 * 월드 정리 델리게이트 핸들.
+	 */
+	FDelegateHandle WorldCleanupHandle;
+};
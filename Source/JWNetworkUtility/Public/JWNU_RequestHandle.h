@@ -0,0 +1,160 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UJWNU_HttpRequestJob;
+class FJWNU_RequestHandleTable;
+
+/**
+ * 클래스 전용 로그 카테고리 선언
+ */
+JWNETWORKUTILITY_API DECLARE_LOG_CATEGORY_EXTERN(LogJWNU_RequestHandle, Log, All);
+
+/**
+ * 네이티브 호출자를 위한 요청 핸들. 프로세서가 소유한 진행 중 요청 테이블의 슬롯 인덱스와 세대 번호로 이루어진 값 타입이다.
+ * 복사해도 힙 할당이 없고, 요청이 끝나 슬롯이 재사용되면 세대 번호가 달라져 이전 핸들은 자동으로 무효가 된다.
+ * 401 리프레시로 내부 Job이 교체되더라도 같은 핸들로 요청을 제어할 수 있다. 게임 스레드 전용이다.
+ */
+struct JWNETWORKUTILITY_API FJWNU_RequestHandle
+{
+	FJWNU_RequestHandle() = default;
+
+	/**
+	 * 진행 중인 요청을 취소하는 함수. 이후 결과 콜백은 호출되지 않는다. (이미 끝난 요청이라면 무시)
+	 */
+	void Cancel() const;
+
+	/**
+	 * 요청이 아직 끝나지 않았는지 반환하는 함수. 401 리프레시 대기 중이거나 응답을 파싱하는 중에도 true이며, 결과 콜백 직전에 false가 된다.
+	 * @return 실행 중이면 true
+	 */
+	bool IsRunning() const;
+
+	/**
+	 * 이 핸들로 요청이 취소됐는지 반환하는 함수. 슬롯이 다른 요청에 재사용된 뒤에는 false를 반환한다.
+	 * @return 취소됐다면 true
+	 */
+	bool IsCancelled() const;
+
+	/**
+	 * 요청을 보내 슬롯을 할당받은 핸들인지 반환한다. (보내기 전에 실패한 호출은 빈 핸들을 반환)
+	 */
+	bool IsValid() const { return Generation != 0; }
+
+	void Reset() { *this = FJWNU_RequestHandle(); }
+
+	/**
+	 * 새 Job을 바인딩하는 내부 함수. 초기 생성 또는 401 리프레시 후 새 Job 바인딩에 사용한다.
+	 * @param InJob 바인딩할 Job
+	 */
+	void BindJob(UJWNU_HttpRequestJob* InJob) const;
+
+	/**
+	 * 요청이 끝나 슬롯을 반납하는 내부 함수. 결과 콜백 직전에 호출한다. (이미 반납했다면 무시)
+	 */
+	void Release() const;
+
+	bool operator==(const FJWNU_RequestHandle& Other) const { return Index == Other.Index && Generation == Other.Generation && Table == Other.Table; }
+
+private:
+	friend class FJWNU_RequestHandleTable;
+
+	FJWNU_RequestHandle(const TWeakPtr<FJWNU_RequestHandleTable, ESPMode::ThreadSafe>& InTable, const int32 InIndex, const uint32 InGeneration)
+		: Table(InTable), Index(InIndex), Generation(InGeneration)
+	{
+	}
+
+	TWeakPtr<FJWNU_RequestHandleTable, ESPMode::ThreadSafe> Table;
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+};
+
+/**
+ * 진행 중인 요청의 슬롯 테이블. 요청마다 UObject 핸들을 만드는 대신 슬롯 하나를 빌려주고, 반납된 슬롯은 세대 번호를 올려 재사용한다.
+ * 취소 플래그는 슬롯이 재사용될 때까지 남아 있으므로 반납 뒤에도 IsCancelled를 조회할 수 있다. 게임 스레드 전용이다.
+ */
+class JWNETWORKUTILITY_API FJWNU_RequestHandleTable : public TSharedFromThis<FJWNU_RequestHandleTable, ESPMode::ThreadSafe>
+{
+public:
+	/**
+	 * 빈 슬롯을 할당해 핸들을 반환하는 함수.
+	 * @return 새 핸들
+	 */
+	FJWNU_RequestHandle Allocate();
+
+	/**
+	 * 슬롯을 반납하는 함수. 세대 번호가 다르거나 이미 반납한 핸들이라면 무시한다.
+	 * @param InHandle 반납할 핸들
+	 */
+	void Release(const FJWNU_RequestHandle& InHandle);
+
+	/**
+	 * 요청을 취소하고 슬롯을 반납하는 함수. 바인딩된 Job이 실행 중이라면 함께 취소한다.
+	 * @param InHandle 취소할 핸들
+	 */
+	void Cancel(const FJWNU_RequestHandle& InHandle);
+
+	/**
+	 * 새 Job을 슬롯에 바인딩하는 함수.
+	 * @param InHandle 대상 핸들
+	 * @param InJob 바인딩할 Job
+	 */
+	void BindJob(const FJWNU_RequestHandle& InHandle, UJWNU_HttpRequestJob* InJob);
+
+	bool IsRunning(const FJWNU_RequestHandle& InHandle) const;
+	bool IsCancelled(const FJWNU_RequestHandle& InHandle) const;
+
+	/**
+	 * 진행 중인 요청을 모두 취소하는 함수. (종료 시 정리용)
+	 */
+	void CancelAll();
+
+	/**
+	 * 슬롯을 점유한 요청 수를 반환한다.
+	 */
+	int32 GetInFlightCount() const { return InFlightCount; }
+
+	/**
+	 * 지금까지 만들어진 슬롯 수를 반환한다. (동시 요청 수의 최대치)
+	 */
+	int32 GetCapacity() const { return Entries.Num(); }
+
+private:
+	struct FEntry
+	{
+		/**
+		 * 현재 바인딩된 HTTP 요청 Job. (401 리프레시 대기 중에는 끝난 이전 Job이거나 비어 있다)
+		 */
+		TWeakObjectPtr<UJWNU_HttpRequestJob> Job;
+
+		/**
+		 * 할당할 때마다 올라가는 세대 번호. (0은 빈 핸들용으로 건너뛴다)
+		 */
+		uint32 Generation = 0;
+
+		bool bInUse = false;
+		bool bCancelled = false;
+	};
+
+	/**
+	 * 핸들과 세대 번호가 일치하는 슬롯을 찾는다. (반납된 슬롯도 재사용 전이라면 찾는다)
+	 */
+	FEntry* FindEntry(const FJWNU_RequestHandle& InHandle);
+	const FEntry* FindEntry(const FJWNU_RequestHandle& InHandle) const;
+
+	/**
+	 * 슬롯을 비우고 빈 슬롯 목록에 넣는다.
+	 */
+	void FreeEntry(FEntry& InEntry, const int32 InIndex);
+
+	TArray<FEntry> Entries;
+
+	/**
+	 * 빈 슬롯 인덱스. 마지막에 반납된 슬롯부터 재사용한다.
+	 */
+	TArray<int32> FreeIndices;
+
+	int32 InFlightCount = 0;
+};
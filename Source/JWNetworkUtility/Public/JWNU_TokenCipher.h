@@ -0,0 +1,156 @@
+﻿// Copyright (c) 2026 Prayslaks. All rights reserved. Unauthorized copying, modification, or distribution of this file, via any medium is strictly prohibited. Proprietary and confidential.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 클래스 전용 로그 카테고리 선언
+ */
+JWNETWORKUTILITY_API DECLARE_LOG_CATEGORY_EXTERN(LogJWNU_TokenCipher, Log, All);
+
+/**
+ * 토큰 키스토어 파일에 기록되는 암호화 백엔드 식별자 열거형.
+ * 파일 헤더에 저장되므로 기존 값의 번호를 바꾸면 안 된다.
+ */
+enum class EJWNU_TokenCipherId : uint8
+{
+	None = 0,
+	WindowsDpapi = 1,
+	PortableAes = 2,
+};
+
+/**
+ * 리프레시 토큰 키스토어를 암호화-복호화하는 백엔드 인터페이스.
+ * 게임 스레드와 백그라운드 저장 작업에서 동시에 호출될 수 있으므로 구현체는 상태를 변경하지 않아야 한다.
+ */
+class JWNETWORKUTILITY_API IJWNU_TokenCipher
+{
+public:
+	virtual ~IJWNU_TokenCipher() = default;
+
+	/**
+	 * 키스토어 헤더에 기록할 백엔드 식별자를 반환하는 함수.
+	 * @return 백엔드 식별자
+	 */
+	virtual EJWNU_TokenCipherId GetCipherId() const = 0;
+
+	/**
+	 * 평문 바이트를 암호화하는 함수.
+	 * @param InPlainData 암호화할 평문 바이트
+	 * @param OutEncryptedData 암호화된 바이트
+	 * @return 성공 여부
+	 */
+	virtual bool Encrypt(const TArray<uint8>& InPlainData, TArray<uint8>& OutEncryptedData) const = 0;
+
+	/**
+	 * 암호문 바이트를 복호화하는 함수. 무결성 검증에 실패하면 false를 반환한다.
+	 * @param InEncryptedData 복호화할 암호문 바이트
+	 * @param OutPlainData 복호화된 평문 바이트
+	 * @return 성공 여부
+	 */
+	virtual bool Decrypt(const TArray<uint8>& InEncryptedData, TArray<uint8>& OutPlainData) const = 0;
+
+	/**
+	 * 이번 세션에 새 암호문을 만들 수 있는지 반환하는 함수. false라면 키스토어에 기록하지 않아야 한다.
+	 * @return 암호화 가능 여부
+	 */
+	virtual bool CanEncrypt() const { return true; }
+
+	/**
+	 * 현재 플랫폼의 기본 암호화 백엔드를 생성하는 함수.
+	 * 윈도우에서는 DPAPI, 그 외 플랫폼(리눅스 데디케이티드 서버, 헤드리스 클라이언트 등)에서는 포터블 AES 백엔드를 사용한다.
+	 * @return 기본 암호화 백엔드
+	 */
+	static TSharedRef<IJWNU_TokenCipher, ESPMode::ThreadSafe> CreateDefault();
+
+	/**
+	 * 식별자에 대응하는 암호화 백엔드를 생성하는 함수. 현재 플랫폼에서 사용할 수 없다면 nullptr을 반환한다.
+	 * @param InCipherId 백엔드 식별자
+	 * @return 암호화 백엔드
+	 */
+	static TSharedPtr<IJWNU_TokenCipher, ESPMode::ThreadSafe> CreateById(EJWNU_TokenCipherId InCipherId);
+};
+
+#if PLATFORM_WINDOWS
+/**
+ * 윈도우 DPAPI 기반 암호화 백엔드. 현재 로그인된 사용자 계정과 기기 ID 엔트로피에 묶인다.
+ */
+class JWNETWORKUTILITY_API FJWNU_DpapiTokenCipher : public IJWNU_TokenCipher
+{
+public:
+	virtual EJWNU_TokenCipherId GetCipherId() const override { return EJWNU_TokenCipherId::WindowsDpapi; }
+	virtual bool Encrypt(const TArray<uint8>& InPlainData, TArray<uint8>& OutEncryptedData) const override;
+	virtual bool Decrypt(const TArray<uint8>& InEncryptedData, TArray<uint8>& OutPlainData) const override;
+
+	/**
+	 * 기기 ID로부터 유도한 암호화 엔트로피 바이트를 반환하는 함수. 프로세스당 1회만 계산된다.
+	 * @return 암호화 엔트로피 바이트 배열
+	 */
+	static const TArray<uint8>& GetEntropyBytes();
+};
+#endif
+
+/**
+ * 플랫폼 독립 암호화 백엔드. AES-256-CTR로 암호화하고 HMAC-SHA1로 무결성을 검증한다. (Encrypt-then-MAC)
+ * 마스터 키를 직접 주입할 수 있어 데디케이티드 서버처럼 기기 식별자가 불안정한 환경에서도 사용할 수 있다.
+ * 암호문 레이아웃 : [Nonce 16 bytes][Ciphertext][HMAC 20 bytes]
+ *
+ * 보안 수준 : 키를 주입하지 않으면 마스터 키는 같은 기기의 같은 사용자가 언제든 다시 계산할 수 있는 값(솔트 파일, 로그인 ID, 기기 ID)에서 유도된다.
+ * 이 경우 키스토어 파일만 복사해 가는 것은 막지만 같은 계정 권한을 가진 공격자는 막지 못하므로, 암호화가 아닌 난독화 수준으로 취급해야 한다.
+ * 실제 기밀성이 필요하다면 JWNU_KEYSTORE_KEY로 외부 비밀 저장소의 키를 주입한다.
+ */
+class JWNETWORKUTILITY_API FJWNU_PortableTokenCipher : public IJWNU_TokenCipher
+{
+public:
+	/**
+	 * 주입한 마스터 키로 암호화 키와 인증 키를 유도하는 생성자.
+	 * @param InMasterKey 마스터 키 바이트 (길이 제한 없음)
+	 */
+	explicit FJWNU_PortableTokenCipher(const TArray<uint8>& InMasterKey);
+
+	/**
+	 * 기기에 묶인 마스터 키로 백엔드를 생성하는 함수.
+	 * 환경 변수 JWNU_KEYSTORE_KEY가 설정되어 있다면 그 값을, 없다면 기기 ID와 설치별 솔트 파일을 조합해 사용한다.
+	 * 솔트 파일은 키스토어와 분리된 사용자 설정 폴더(UserSettingsDir/JWNetworkUtility/<Project>/keystore.salt)에 보관한다.
+	 * 솔트가 없는데 난수 생성기도 쓸 수 없다면 예측 가능한 키로 기록하지 않도록, 이번 세션의 암호화를 막은 백엔드를 반환한다.
+	 * @return 포터블 암호화 백엔드
+	 */
+	static TSharedRef<FJWNU_PortableTokenCipher, ESPMode::ThreadSafe> CreateForThisMachine();
+
+	virtual EJWNU_TokenCipherId GetCipherId() const override { return EJWNU_TokenCipherId::PortableAes; }
+	virtual bool Encrypt(const TArray<uint8>& InPlainData, TArray<uint8>& OutEncryptedData) const override;
+	virtual bool Decrypt(const TArray<uint8>& InEncryptedData, TArray<uint8>& OutPlainData) const override;
+	virtual bool CanEncrypt() const override { return bEncryptionLocked == false; }
+
+private:
+#if WITH_DEV_AUTOMATION_TESTS
+	/** 공개 CTR 테스트 벡터로 키 스트림을 검증하기 위해 암호화 키를 직접 설정하는 테스트 */
+	friend class FJWNU_PortableTokenCipherKnownAnswerTest;
+#endif
+
+	/**
+	 * 논스로부터 키 스트림을 만들어 데이터에 XOR하는 함수. (CTR 모드는 암호화와 복호화가 동일하다)
+	 * @param InNonce 16바이트 논스
+	 * @param InOutData 변환할 데이터
+	 * @param InNum 데이터 길이
+	 */
+	void ApplyKeyStream(const uint8* InNonce, uint8* InOutData, int32 InNum) const;
+
+	/**
+	 * 논스와 암호문에 대한 HMAC을 계산하는 함수.
+	 * @param InData 인증할 데이터
+	 * @param InNum 데이터 길이
+	 * @param OutMac 20바이트 HMAC 출력 버퍼
+	 */
+	void ComputeMac(const uint8* InData, int32 InNum, uint8* OutMac) const;
+
+	/** AES-256 암호화 키 */
+	uint8 EncryptionKey[32];
+
+	/** HMAC-SHA1 인증 키 */
+	uint8 MacKey[20];
+
+	/** 설치별 솔트를 만들지 못해 이번 세션의 암호화를 막았는지 여부 */
+	bool bEncryptionLocked = false;
+};
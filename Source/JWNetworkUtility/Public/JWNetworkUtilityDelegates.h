@@ -22,21 +22,78 @@ DECLARE_DYNAMIC_DELEGATE_OneParam(FOnHttpRequestJobRetryBPEvent, const int32, At
  */
 DECLARE_DELEGATE_ThreeParams(FOnHttpRequestJobCompletedDelegate, const bool /*bNetworkAvailable*/, const int32 /*StatusCode*/, const FString& /*ResponseBody*/)
 
+/**
+ * 하위 레이어 : HTTP 리퀘스트의 (네트워크 상태, 상태 코드, UTF-8 리스폰스 바이트)를 패러미터로 받는 델리게이트. 바디를 TCHAR로 변환하지 않고, 바이트 버퍼는 복사 없이 넘겨받는다.
+ */
+DECLARE_DELEGATE_ThreeParams(FOnHttpRequestJobCompletedUtf8Delegate, const bool /*bNetworkAvailable*/, const int32 /*StatusCode*/, TArray<uint8>&& /*ResponseBytes*/)
+
+/**
+ * 하위 레이어 : 네트워크 실패, 타임아웃, 2XX가 아닌 최종 결과를 (상태 코드, 시도 횟수, 전송 원인)이 채워진 에러로 받는 델리게이트.
+ * 바인딩되어 있으면 실패 시 리스폰스 바디를 읽지 않고 완료 델리게이트 대신 호출된다.
+ */
+DECLARE_DELEGATE_OneParam(FOnHttpRequestJobFailedDelegate, const FJWNU_ApiError& /*Error*/)
+
+/**
+ * 하위 레이어 : 리스폰스 바디가 도착하는 대로 (바이트 조각, 바이트 수)를 받는 델리게이트. HTTP 스레드에서 호출될 수 있다.
+ * false를 반환하면 스트림 처리를 중단한다.
+ */
+DECLARE_DELEGATE_RetVal_TwoParams(bool, FOnHttpResponseStreamDelegate, const uint8* /*Data*/, const int64 /*Num*/)
+
 /**
  * 중위 레이어 : HTTP 리퀘스트의 (상태 코드, 리스폰스 바디)를 패러미터로 받는 델리게이트.
  */
 DECLARE_DELEGATE_TwoParams(FOnHttpRequestCompletedDelegate, const int32 /*StatusCode*/, const FString& /*ResponseBody*/)
 
+/**
+ * 중위 레이어 : HTTP 리퀘스트의 (상태 코드, UTF-8 리스폰스 바이트)를 패러미터로 받는 델리게이트. 구조체 파싱 경로가 바이트를 그대로 읽는 데 사용한다. (바이트 버퍼는 복사 없이 넘겨받는다)
+ */
+DECLARE_DELEGATE_TwoParams(FOnHttpRequestCompletedUtf8Delegate, const int32 /*StatusCode*/, TArray<uint8>&& /*ResponseBytes*/)
+
+/**
+ * 중위 레이어 : 커스텀 코드와 메시지까지 채워진 API 에러를 받는 델리게이트. 바인딩되어 있으면 가짜 JSON 리스폰스 바디를 만들지 않는다.
+ */
+DECLARE_DELEGATE_OneParam(FOnHttpRequestFailedDelegate, const FJWNU_ApiError& /*Error*/)
+
 /**
  * 상위 레이어 : HTTP 리퀘스트의 (HTTP 상태코드 열거형, 리스폰스 바디)를 패러미터로 받는 델리게이트.
  */
 DECLARE_DELEGATE_TwoParams(FOnHttpResponseDelegate, const EJWNU_HttpStatusCode /*StatusCode*/, const FString& /*ResponseBody*/)
 
+/**
+ * 상위 레이어 : API 호출 실패를 구조화된 에러로 받는 델리게이트. 바인딩되어 있으면 실패 시 리스폰스 콜백 대신 호출된다.
+ */
+DECLARE_DELEGATE_OneParam(FOnApiErrorDelegate, const FJWNU_ApiError& /*Error*/)
+
 /**
  * 상위 레이어 : HTTP 리퀘스트의 (HTTP 상태코드 열거형, 리스폰스 바디)를 패러미터로 받는 BP 이벤트.
  */
 DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnHttpResponseBPEvent, EJWNU_HttpStatusCode, StatusCode, FString, ResponseBody);
 
+/**
+ * 상위 레이어 : 배치 API 호출의 모든 요청이 끝났을 때 (요청 순서대로 정렬된 결과 배열)을 패러미터로 받는 BP 이벤트.
+ */
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnApiBatchCompletedBPEvent, const TArray<FJWNU_ApiBatchResult>&, Results);
+
+/**
+ * 상위 레이어 : 배치 API 호출에서 요청 하나가 끝날 때마다 (요청 인덱스, 결과, 지금까지 끝난 요청 수)를 패러미터로 받는 BP 이벤트.
+ */
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FOnApiBatchItemCompletedBPEvent, int32, Index, const FJWNU_ApiBatchResult&, Result, int32, CompletedCount);
+
+/**
+ * 하위 레이어 : 키스토어 백그라운드 로드가 끝나 메모리 사본이 준비되었을 때 호출되는 델리게이트.
+ */
+DECLARE_MULTICAST_DELEGATE(FOnKeystoreLoadedDelegate);
+
+/**
+ * 상위 레이어 : 시작 시 세션 복구(저장된 리프레시 토큰으로 모든 서비스 엑세스 토큰 갱신)가 끝났을 때 호출되는 델리게이트.
+ */
+DECLARE_MULTICAST_DELEGATE(FOnSessionReadyDelegate);
+
+/**
+ * 상위 레이어 : 시작 시 세션 복구가 끝났을 때 호출되는 BP 이벤트.
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnSessionReadyBPEvent);
+
 /**
  * 더미 구조체.
  */
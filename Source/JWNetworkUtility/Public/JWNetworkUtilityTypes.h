@@ -120,6 +120,32 @@ enum class EJWNU_HttpMethod : uint8
 	Delete,
 };
 
+/**
+ * HTTP 리퀘스트 완료 콜백의 디스패치 우선순위 열거형.
+ */
+UENUM(BlueprintType)
+enum class EJWNU_RequestPriority : uint8
+{
+	/** 프레임 예산 안에서 순서대로 디스패치 */
+	Normal,
+	/** 프레임 예산과 무관하게 일반 콜백보다 먼저 디스패치 (토큰 리프레시 등) */
+	Critical,
+};
+
+/**
+ * HTTP 리퀘스트 응답 처리 스레드 정책 열거형. 네이티브 C++ 전용이다.
+ */
+UENUM()
+enum class EJWNU_CompletionThread : uint8
+{
+	/** 게임 스레드에서 처리 (프레임 예산 완료 큐를 거친다) */
+	GameThread,
+	/** HTTP 스레드에서 곧바로 처리 (가벼운 처리 전용, HTTP 스레드를 오래 붙잡지 않아야 한다) */
+	HttpThread,
+	/** HTTP 스레드에서 받아 태스크 그래프 워커로 넘겨 처리 (바디 변환과 무거운 처리용) */
+	TaskGraph,
+};
+
 /**
  * HTTP 리퀘스트 설정 구조체.
  */
@@ -164,6 +190,19 @@ struct JWNETWORKUTILITY_API FJWNU_RequestConfig
 	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category="JWNetworkUtility|Config")
 	bool bRetryOnNetworkError;
 
+	/**
+	 * 완료 콜백 디스패치 우선순위.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category="JWNetworkUtility|Config")
+	EJWNU_RequestPriority Priority;
+
+	/**
+	 * 응답 처리와 완료 콜백을 실행할 스레드. 게임 스레드가 아니라면 재시도, 타임아웃 판단과 완료 콜백이 모두 그 스레드에서 실행된다.
+	 * 요청 기술자를 직접 만들어 헬퍼로 보내는 네이티브 호출자만 지정할 수 있다. (INI 정책과 블루프린트에는 노출하지 않으며,
+	 * 서비스 계층과 헬퍼의 URL 호출은 게임 스레드로 고정하고 다른 값이 지정되어 있으면 경고한다)
+	 */
+	EJWNU_CompletionThread CompletionThread;
+
 	/**
 	 * 기본 생성자.
 	 */
@@ -175,36 +214,114 @@ struct JWNETWORKUTILITY_API FJWNU_RequestConfig
 		bRetryOn5XX = true;
 		bRetryOnTimeout = true;
 		bRetryOnNetworkError = true;
+		Priority = EJWNU_RequestPriority::Normal;
+		CompletionThread = EJWNU_CompletionThread::GameThread;
 	}
 };
 
 /**
- * 401 발생 시 원래 요청을 재시도하기 위한 정보를 담는 구조체.
+ * 엔드포인트 경로 접두사별 HTTP 리퀘스트 설정 구조체. 가장 길게 일치하는 접두사의 설정이 기본 설정 대신 적용된다.
  */
 USTRUCT(BlueprintType)
-struct JWNETWORKUTILITY_API FJWNU_PendingApiRequest
+struct JWNETWORKUTILITY_API FJWNU_EndpointPolicy
 {
 	GENERATED_BODY()
 
-	EJWNU_ServiceType ServiceType;
-	EJWNU_HttpMethod Method;
-	FString URL;
-	FString ContentBody;
-	TMap<FString, FString> QueryParams;
+	/**
+	 * 호스트를 제외한 경로 접두사. (예: "/health", "/store/purchase")
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category="JWNetworkUtility|Config")
+	FString PathPrefix;
+
+	/**
+	 * 이 접두사로 시작하는 요청에 적용할 설정. (INI에서 생략한 필드는 FJWNU_RequestConfig의 기본값)
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category="JWNetworkUtility|Config")
+	FJWNU_RequestConfig Config;
 };
 
 /**
- * 토큰 리프레시 대기열에 적재되는 잡 구조체.
- * 리프레시 완료 시 OnTokenReady, 실패 시 OnTokenFailed가 호출된다.
+ * API 에러가 발생한 전송 계층 원인 열거형.
+ */
+UENUM(BlueprintType)
+enum class EJWNU_TransportReason : uint8
+{
+	/** 서버가 응답했다 (상태 코드로 실패 판단) */
+	None,
+	/** 연결 실패 등으로 응답을 받지 못함 */
+	ConnectionFailed,
+	/** 플러그인 타임아웃 */
+	Timeout,
+	/** 요청을 보내기 전에 로컬에서 실패 (호스트, 토큰, 직렬화, 리프레시 실패 등) */
+	NotSent,
+};
+
+/**
+ * API 호출 실패 정보를 담는 구조체.
+ * 실패 경로에서는 가짜 JSON 리스폰스 바디를 만들고 다시 파싱하는 대신 이 구조체를 그대로 전달한다.
  */
 USTRUCT(BlueprintType)
-struct JWNETWORKUTILITY_API FJWNU_PendingJob
+struct JWNETWORKUTILITY_API FJWNU_ApiError
 {
 	GENERATED_BODY()
-	
-	FJWNU_PendingApiRequest RequestInfo;
-	TFunction<void(const FString& /*NewAccessToken*/)> OnTokenReady;
-	TFunction<void(const FString& /*ErrorCode*/, const FString& /*ErrorMessage*/)> OnTokenFailed;
+
+	/**
+	 * 네트워크, 인증, 상태 코드를 나타내는 커스텀 코드 문자열 필드. (NETWORK_ERROR, UNAUTHORIZED, TOKEN_NOT_FOUND 등)
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="JWNetworkUtility")
+	FString Code;
+
+	/**
+	 * 실패 사유 메시지 문자열 필드.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="JWNetworkUtility")
+	FString Message;
+
+	/**
+	 * HTTP 상태 코드. (응답을 받지 못했다면 0, 타임아웃이라면 408)
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="JWNetworkUtility")
+	int32 StatusCode;
+
+	/**
+	 * 실패가 확정될 때까지 시도한 횟수. (보내기 전에 실패했다면 0)
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="JWNetworkUtility")
+	int32 AttemptCount;
+
+	/**
+	 * 전송 계층 원인.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="JWNetworkUtility")
+	EJWNU_TransportReason TransportReason;
+
+	/**
+	 * 기본 생성자
+	 */
+	FJWNU_ApiError()
+	{
+		StatusCode = 0;
+		AttemptCount = 0;
+		TransportReason = EJWNU_TransportReason::None;
+	}
+
+	/**
+	 * 요청을 보내기 전에 발생한 로컬 실패용 생성자
+	 */
+	FJWNU_ApiError(const FString& InCode, const FString& InMessage)
+		: Code(InCode), Message(InMessage)
+	{
+		StatusCode = 0;
+		AttemptCount = 0;
+		TransportReason = EJWNU_TransportReason::NotSent;
+	}
+
+	/**
+	 * 기존 바디 기반 콜백(블루프린트 등)을 위해 { success, code, message } 구조의 JSON 리스폰스 바디를 만드는 함수.
+	 * 바디를 요청한 호출자에게 전달할 때만 호출한다.
+	 * @return JSON 리스폰스 바디
+	 */
+	FString ToResponseBody() const;
 };
 
 
@@ -221,6 +338,85 @@ enum class EJWNU_ServiceType : uint8
 	AuthServer,
 };
 
+/**
+ * 블루프린트 배치 API 호출에 넣는 요청 하나를 기술하는 구조체.
+ */
+USTRUCT(BlueprintType)
+struct JWNETWORKUTILITY_API FJWNU_ApiBatchRequest
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="JWNetworkUtility")
+	EJWNU_ServiceType ServiceType;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="JWNetworkUtility")
+	EJWNU_HttpMethod Method;
+
+	/**
+	 * 호스트를 제외한 API 엔드포인트. (예: "/inventory")
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="JWNetworkUtility")
+	FString Endpoint;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="JWNetworkUtility")
+	FString ContentBody;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="JWNetworkUtility")
+	TMap<FString, FString> QueryParams;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="JWNetworkUtility")
+	bool bRequiresAuth;
+
+	/**
+	 * 기본 생성자
+	 */
+	FJWNU_ApiBatchRequest()
+	{
+		ServiceType = EJWNU_ServiceType::GameServer;
+		Method = EJWNU_HttpMethod::Get;
+		bRequiresAuth = true;
+	}
+};
+
+/**
+ * 블루프린트 배치 API 호출에서 요청 하나의 결과를 담는 구조체. 결과 배열은 요청 배열과 같은 순서다.
+ */
+USTRUCT(BlueprintType)
+struct JWNETWORKUTILITY_API FJWNU_ApiBatchResult
+{
+	GENERATED_BODY()
+
+	/**
+	 * 2XX 응답을 받았는지 여부.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="JWNetworkUtility")
+	bool bSucceeded;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="JWNetworkUtility")
+	EJWNU_HttpStatusCode StatusCode;
+
+	/**
+	 * 리스폰스 바디. 실패 시에는 단건 CallApi와 같은 { success, code, message } 구조의 JSON 바디.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="JWNetworkUtility")
+	FString ResponseBody;
+
+	/**
+	 * 실패 정보. (bSucceeded가 false일 때만 유효)
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="JWNetworkUtility")
+	FJWNU_ApiError Error;
+
+	/**
+	 * 기본 생성자
+	 */
+	FJWNU_ApiBatchResult()
+	{
+		bSucceeded = false;
+		StatusCode = EJWNU_HttpStatusCode::None;
+	}
+};
+
 /**
  * 엑세스 토큰 값과 해당 토큰의 만료 시간을 저장하는 언리얼 구조체.
  */